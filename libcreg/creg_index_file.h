@@ -0,0 +1,127 @@
+/*
+ * The index file definition of a Windows 9x/Me Registry File (CREG)
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CREG_INDEX_FILE_H )
+#define _CREG_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct creg_index_file_header creg_index_file_header_t;
+
+struct creg_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "cregidx\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the registry file
+	 * Consists of 8 bytes
+	 */
+	uint8_t registry_file_size[ 8 ];
+
+	/* The checksum of the registry file and key navigation headers
+	 * Consists of 4 bytes
+	 * Contains an Adler-32 checksum
+	 */
+	uint8_t registry_file_checksum[ 4 ];
+
+	/* The number of data block entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_data_block_entries[ 4 ];
+
+	/* The number of path index entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_path_index_entries[ 4 ];
+
+	/* The ASCII codepage used to calculate the path hashes
+	 * Consists of 4 bytes
+	 */
+	uint8_t ascii_codepage[ 4 ];
+
+	/* The checksum of the entries data
+	 * Consists of 4 bytes
+	 * Contains an Adler-32 checksum
+	 */
+	uint8_t entries_data_checksum[ 4 ];
+
+	/* The checksum of the preceding header data
+	 * Consists of 4 bytes
+	 * Contains an Adler-32 checksum
+	 */
+	uint8_t header_checksum[ 4 ];
+};
+
+typedef struct creg_index_file_data_block_entry creg_index_file_data_block_entry_t;
+
+struct creg_index_file_data_block_entry
+{
+	/* The data block offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The data block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+};
+
+typedef struct creg_index_file_path_index_entry creg_index_file_path_index_entry_t;
+
+struct creg_index_file_path_index_entry
+{
+	/* The key offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_offset[ 4 ];
+
+	/* The parent entry index
+	 * Consists of 4 bytes
+	 * Contains 0xffffffff if the entry has no parent
+	 */
+	uint8_t parent_entry_index[ 4 ];
+
+	/* The path hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_hash[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CREG_INDEX_FILE_H ) */
+
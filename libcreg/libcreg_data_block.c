@@ -25,11 +25,12 @@
 #include <types.h>
 
 #include "libcreg_data_block.h"
+#include "libcreg_definitions.h"
 #include "libcreg_key_name_entry.h"
 #include "libcreg_libbfio.h"
-#include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
+#include "libcreg_libcthreads.h"
 #include "libcreg_unused.h"
 
 #include "creg_data_block.h"
@@ -101,20 +102,23 @@ int libcreg_data_block_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *data_block )->entries_array ),
-	     0,
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *data_block )->mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries array.",
+		 "%s: unable to initialize mutex.",
 		 function );
 
 		goto on_error;
 	}
+#endif
+	( *data_block )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
@@ -129,6 +133,7 @@ on_error:
 }
 
 /* Frees a data block
+ * The data block is freed regardless of its number of references
  * Returns 1 if successful or -1 on error
  */
 int libcreg_data_block_free(
@@ -136,6 +141,7 @@ int libcreg_data_block_free(
      libcerror_error_t **error )
 {
 	static char *function = "libcreg_data_block_free";
+	int entry_index       = 0;
 	int result            = 1;
 
 	if( data_block == NULL )
@@ -151,25 +157,69 @@ int libcreg_data_block_free(
 	}
 	if( *data_block != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *data_block )->entries_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_key_name_entry_free,
+		if( ( *data_block )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *data_block )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *data_block )->entries[ entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( libcreg_key_name_entry_free(
+				     &( ( *data_block )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free key name entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *data_block )->entries );
+		}
+		if( ( *data_block )->entry_identifiers != NULL )
+		{
+			memory_free(
+			 ( *data_block )->entry_identifiers );
+		}
+		if( ( *data_block )->entry_data_offsets != NULL )
+		{
+			memory_free(
+			 ( *data_block )->entry_data_offsets );
+		}
+		if( ( *data_block )->entry_sizes != NULL )
+		{
+			memory_free(
+			 ( *data_block )->entry_sizes );
+		}
+		if( ( *data_block )->data != NULL )
+		{
+			memory_free(
+			 ( *data_block )->data );
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *data_block )->mutex ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the entries array.",
+			 "%s: unable to free mutex.",
 			 function );
 
 			result = -1;
 		}
-		if( ( *data_block )->data != NULL )
-		{
-			memory_free(
-			 ( *data_block )->data );
-		}
+#endif
 		memory_free(
 		 *data_block );
 
@@ -178,23 +228,86 @@ int libcreg_data_block_free(
 	return( result );
 }
 
-/* Reads a data block header
- * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+/* Grabs a reference to a data block
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_data_block_read_header(
+int libcreg_data_block_grab_reference(
      libcreg_data_block_t *data_block,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
      libcerror_error_t **error )
 {
-	creg_data_block_header_t data_block_header;
+	static char *function = "libcreg_data_block_grab_reference";
+	int result            = 1;
 
-	static char *function = "libcreg_data_block_read_header";
-	ssize_t read_count    = 0;
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t value_16bit  = 0;
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     data_block->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( data_block->number_of_references <= 0 )
+	 || ( data_block->number_of_references == INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		data_block->number_of_references += 1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     data_block->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
 #endif
+	return( result );
+}
+
+/* Releases a reference to a data block
+ * The data block is freed when its last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_release_reference(
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcreg_data_block_release_reference";
+	int number_of_references = 0;
 
 	if( data_block == NULL )
 	{
@@ -207,35 +320,113 @@ int libcreg_data_block_read_header(
 
 		return( -1 );
 	}
-	data_block->offset = file_offset;
+	if( *data_block == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     ( *data_block )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		return( -1 );
+	}
+#endif
+	if( ( *data_block )->number_of_references > 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading data block header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
+		( *data_block )->number_of_references -= 1;
+	}
+	number_of_references = ( *data_block )->number_of_references;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     ( *data_block )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              (uint8_t *) &data_block_header,
-	              sizeof( creg_data_block_header_t ),
-	              file_offset,
-	              error );
+	if( number_of_references == 0 )
+	{
+		if( libcreg_data_block_free(
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block.",
+			 function );
 
-	if( read_count != (ssize_t) sizeof( creg_data_block_header_t ) )
+			return( -1 );
+		}
+	}
+	*data_block = NULL;
+
+	return( 1 );
+}
+
+/* Reads a data block header
+ * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+ */
+int libcreg_data_block_read_header_data(
+     libcreg_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_data_block_read_header_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t value_16bit  = 0;
+#endif
+
+	if( data_block == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data block header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( creg_data_block_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
@@ -246,28 +437,28 @@ int libcreg_data_block_read_header(
 		 "%s: data block header:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &data_block_header,
+		 data,
 		 sizeof( creg_data_block_header_t ),
 		 0 );
 	}
 #endif
 	if( memory_compare(
-	     data_block_header.signature,
+	     ( (creg_data_block_header_t *) data )->signature,
 	     creg_data_block_signature,
 	     4 ) != 0 )
 	{
 		return( 0 );
 	}
 	byte_stream_copy_to_uint32_little_endian(
-	 data_block_header.size,
+	 ( (creg_data_block_header_t *) data )->size,
 	 data_block->size );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 data_block_header.unused_size,
+	 ( (creg_data_block_header_t *) data )->unused_size,
 	 data_block->unused_size );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 data_block_header.used_size,
+	 ( (creg_data_block_header_t *) data )->used_size,
 	 data_block->used_size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -276,10 +467,10 @@ int libcreg_data_block_read_header(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t: %c%c%c%c\n",
 		 function,
-		 data_block_header.signature[ 0 ],
-		 data_block_header.signature[ 1 ],
-		 data_block_header.signature[ 2 ],
-		 data_block_header.signature[ 3 ] );
+		 ( (creg_data_block_header_t *) data )->signature[ 0 ],
+		 ( (creg_data_block_header_t *) data )->signature[ 1 ],
+		 ( (creg_data_block_header_t *) data )->signature[ 2 ],
+		 ( (creg_data_block_header_t *) data )->signature[ 3 ] );
 
 		libcnotify_printf(
 		 "%s: size\t\t\t\t\t: %" PRIu32 "\n",
@@ -292,7 +483,7 @@ int libcreg_data_block_read_header(
 		 data_block->unused_size );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 data_block_header.unknown1,
+		 ( (creg_data_block_header_t *) data )->unknown1,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: unknown1\t\t\t\t: 0x%04" PRIx16 "\n",
@@ -300,7 +491,7 @@ int libcreg_data_block_read_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 data_block_header.index,
+		 ( (creg_data_block_header_t *) data )->index,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: index\t\t\t\t\t: %" PRIu16 "\n",
@@ -313,7 +504,7 @@ int libcreg_data_block_read_header(
 		 (int32_t) data_block->used_size );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 data_block_header.unknown2,
+		 ( (creg_data_block_header_t *) data )->unknown2,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: unknown2\t\t\t\t: %" PRIu16 "\n",
@@ -321,7 +512,7 @@ int libcreg_data_block_read_header(
 		 value_16bit );
 
 		byte_stream_copy_to_uint16_little_endian(
-		 data_block_header.unknown3,
+		 ( (creg_data_block_header_t *) data )->unknown3,
 		 value_16bit );
 		libcnotify_printf(
 		 "%s: unknown3\t\t\t\t: %" PRIu16 "\n",
@@ -332,7 +523,7 @@ int libcreg_data_block_read_header(
 		 "%s: unknown3:\n",
 		 function );
 		libcnotify_print_data(
-		 data_block_header.unknown4,
+		 ( (creg_data_block_header_t *) data )->unknown4,
 		 8,
 		 0 );
 	}
@@ -342,22 +533,96 @@ int libcreg_data_block_read_header(
 	return( 1 );
 }
 
+/* Reads a data block header
+ * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+ */
+int libcreg_data_block_read_header(
+     libcreg_data_block_t *data_block,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	creg_data_block_header_t data_block_header;
+
+	static char *function = "libcreg_data_block_read_header";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	data_block->offset = file_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data block header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &data_block_header,
+	              sizeof( creg_data_block_header_t ),
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( creg_data_block_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	result = libcreg_data_block_read_header_data(
+	          data_block,
+	          (uint8_t *) &data_block_header,
+	          sizeof( creg_data_block_header_t ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block header.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Reads a data block and determines its entries
+ * The entries are read at the offset following the data block header, which must be read first
  * Returns 1 if successful or -1 on error
  */
 int libcreg_data_block_read_entries(
      libcreg_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
-     int ascii_codepage,
      libcerror_error_t **error )
 {
-	libcreg_key_name_entry_t *key_name_entry = NULL;
-	static char *function                    = "libcreg_data_block_read_entries";
-	size_t data_offset                       = 0;
-	size_t key_name_entry_size               = 0;
-	ssize_t read_count                       = 0;
-	int entry_index                          = 0;
-	int result                               = 0;
+	static char *function = "libcreg_data_block_read_entries";
+	ssize_t read_count    = 0;
+	off64_t file_offset   = 0;
 
 	if( data_block == NULL )
 	{
@@ -397,7 +662,7 @@ int libcreg_data_block_read_entries(
 
 	data_block->data = (uint8_t *) memory_allocate(
 	                                sizeof( uint8_t ) * data_block->data_size );
-	
+
 	if( data_block->data == NULL )
 	{
 		libcerror_error_set(
@@ -409,10 +674,23 @@ int libcreg_data_block_read_entries(
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              data_block->data,
-	              data_block->data_size,
+	file_offset = data_block->offset + sizeof( creg_data_block_header_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data block entries at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data_block->data,
+	              data_block->data_size,
+	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) data_block->data_size )
@@ -426,122 +704,548 @@ int libcreg_data_block_read_entries(
 
 		goto on_error;
 	}
+	if( libcreg_data_block_read_key_name_entries(
+	     data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key name entries.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_block->data != NULL )
+	{
+		memory_free(
+		 data_block->data );
+
+		data_block->data = NULL;
+	}
+	data_block->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the data block data and determines its entries
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_read_entries_data(
+     libcreg_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_data_block_read_entries_data";
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_block->size == 0 )
+	 || ( data_block->size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block - size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_block->data_size = (size_t) data_block->size - sizeof( creg_data_block_header_t );
+
+	if( data_size < data_block->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		data_block->data_size = 0;
+
+		return( -1 );
+	}
+
+	data_block->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * data_block->data_size );
+
+	if( data_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data_block->data,
+	     data,
+	     data_block->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_data_block_read_key_name_entries(
+	     data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key name entries.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_block->data != NULL )
+	{
+		memory_free(
+		 data_block->data );
+
+		data_block->data = NULL;
+	}
+	data_block->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the key name entries of the data block data
+ * Only the identifier, data offset and size of the key name entries are determined,
+ * the key name entries are read on first access
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_read_key_name_entries(
+     libcreg_data_block_t *data_block,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcreg_data_block_read_key_name_entries";
+	size_t data_offset        = 0;
+	size_t entries_size       = 0;
+	uint32_t entry_size       = 0;
+	uint16_t entry_identifier = 0;
+	int entry_index           = 0;
+	int insert_index          = 0;
+	int number_of_entries     = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->entry_identifiers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block - entry identifiers already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass validates the key name entry sizes and determines the number of entries
+	 */
 	while( data_offset < data_block->data_size )
 	{
-		if( libcreg_key_name_entry_initialize(
-		     &key_name_entry,
-		     error ) != 1 )
+		if( ( data_block->data_size - data_offset ) < sizeof( creg_key_name_entry_t ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create key name entry.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key name entry: %d data size value out of bounds.",
+			 function,
+			 number_of_entries );
 
-			goto on_error;
+			return( -1 );
 		}
-		key_name_entry->offset = data_block->offset + sizeof( creg_data_block_header_t ) + data_offset;
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_name_entry_t *) &( ( data_block->data )[ data_offset ] ) )->size,
+		 entry_size );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: reading key name entry at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
-			 function,
-			 key_name_entry->offset,
-			 key_name_entry->offset );
-		}
-#endif
-		result = libcreg_key_name_entry_read_data(
-		          key_name_entry,
-		          &( ( data_block->data )[ data_offset ] ),
-		          data_block->data_size - data_offset,
-		          ascii_codepage,
-		          error );
-
-		if( result == -1 )
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (creg_key_name_entry_t *) &( ( data_block->data )[ data_offset ] ) )->index,
+		 entry_identifier );
+
+		if( ( entry_size < sizeof( creg_key_name_entry_t ) )
+		 || ( entry_size > ( data_block->data_size - data_offset ) ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read key name entry at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key name entry: %d size value out of bounds.",
 			 function,
-			 key_name_entry->offset,
-			 key_name_entry->offset );
-
-			goto on_error;
-		}
-		key_name_entry_size = key_name_entry->size;
+			 number_of_entries );
 
-		if( result == 0 )
-		{
-			if( key_name_entry_size <= ( data_block->data_size - data_offset ) )
-			{
-				result = 1;
-			}
-			if( libcreg_key_name_entry_free(
-			     &key_name_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free key name entry.",
-				 function );
-
-				goto on_error;
-			}
+			return( -1 );
 		}
-		if( result == 0 )
+		/* An identifier of 0xffff indicates an unused key name entry
+		 */
+		if( entry_identifier != 0xffff )
 		{
-			break;
+			number_of_entries++;
 		}
-		data_offset += key_name_entry_size;
+		data_offset += entry_size;
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( libcreg_key_name_entry_t * ) * (size_t) number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	data_block->entry_identifiers = (uint16_t *) memory_allocate(
+	                                              sizeof( uint16_t ) * (size_t) number_of_entries );
+
+	if( data_block->entry_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	data_block->entry_data_offsets = (uint32_t *) memory_allocate(
+	                                               sizeof( uint32_t ) * (size_t) number_of_entries );
+
+	if( data_block->entry_data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	data_block->entry_sizes = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * (size_t) number_of_entries );
+
+	if( data_block->entry_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry sizes.",
+		 function );
+
+		goto on_error;
+	}
+	data_block->entries = (libcreg_key_name_entry_t **) memory_allocate(
+	                                                     entries_size );
 
-		if( key_name_entry != NULL )
+	if( data_block->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     data_block->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* The second pass stores the key name entries sorted by identifier
+	 * The key name entries are typically stored in ascending order of identifier
+	 * hence the insertion sort mostly appends. Entries with the same identifier
+	 * retain their order in the data block.
+	 */
+	data_offset = 0;
+
+	while( data_offset < data_block->data_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_name_entry_t *) &( ( data_block->data )[ data_offset ] ) )->size,
+		 entry_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (creg_key_name_entry_t *) &( ( data_block->data )[ data_offset ] ) )->index,
+		 entry_identifier );
+
+		if( entry_identifier != 0xffff )
 		{
-			if( libcdata_array_append_entry(
-			     data_block->entries_array,
-			     &entry_index,
-			     (intptr_t *) key_name_entry,
-			     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append key name entry: %d.",
+				libcnotify_printf(
+				 "%s: key name entry: %" PRIu16 " at offset: %" PRIzd " (0x%08" PRIzx ") of size: %" PRIu32 "\n",
 				 function,
-				 key_name_entry );
+				 entry_identifier,
+				 data_offset,
+				 data_offset,
+				 entry_size );
+			}
+#endif
+			insert_index = entry_index;
+
+			while( ( insert_index > 0 )
+			    && ( data_block->entry_identifiers[ insert_index - 1 ] > entry_identifier ) )
+			{
+				data_block->entry_identifiers[ insert_index ]  = data_block->entry_identifiers[ insert_index - 1 ];
+				data_block->entry_data_offsets[ insert_index ] = data_block->entry_data_offsets[ insert_index - 1 ];
+				data_block->entry_sizes[ insert_index ]        = data_block->entry_sizes[ insert_index - 1 ];
 
-				goto on_error;
+				insert_index--;
 			}
-			key_name_entry = NULL;
+			data_block->entry_identifiers[ insert_index ]  = entry_identifier;
+			data_block->entry_data_offsets[ insert_index ] = (uint32_t) data_offset;
+			data_block->entry_sizes[ insert_index ]        = entry_size;
+
+			entry_index++;
 		}
+		data_offset += entry_size;
+	}
+	data_block->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( data_block->entries != NULL )
+	{
+		memory_free(
+		 data_block->entries );
+
+		data_block->entries = NULL;
+	}
+	if( data_block->entry_sizes != NULL )
+	{
+		memory_free(
+		 data_block->entry_sizes );
+
+		data_block->entry_sizes = NULL;
+	}
+	if( data_block->entry_data_offsets != NULL )
+	{
+		memory_free(
+		 data_block->entry_data_offsets );
+
+		data_block->entry_data_offsets = NULL;
+	}
+	if( data_block->entry_identifiers != NULL )
+	{
+		memory_free(
+		 data_block->entry_identifiers );
+
+		data_block->entry_identifiers = NULL;
 	}
+	return( -1 );
+}
+
+/* Reads a specific key name entry of the data block data
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_read_key_name_entry(
+     libcreg_data_block_t *data_block,
+     int entry_index,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	static char *function                    = "libcreg_data_block_read_key_name_entry";
+	int result                               = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= data_block->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->entries[ entry_index ] != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block - key name entry: %d already set.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libcreg_key_name_entry_initialize(
+	     &key_name_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key name entry.",
+		 function );
+
+		goto on_error;
+	}
+	key_name_entry->offset = (uint32_t) ( data_block->offset + sizeof( creg_data_block_header_t ) + data_block->entry_data_offsets[ entry_index ] );
+
+	/* The key name entries are owned by the data block and reference its data
+	 * instead of a copy of the key and value names and value data
+	 */
+	key_name_entry->flags |= LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The values of the key name entries are read on demand
+	 * which can be concurrent when the data block is shared
+	 */
+	key_name_entry->values_mutex = data_block->mutex;
+#endif
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( data_offset < data_block->data_size )
-		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( ( data_block->data )[ data_offset ] ),
-			 data_block->data_size - data_offset,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-		else
-		{
-			libcnotify_printf(
-			 "\n" );
-		}
+		libcnotify_printf(
+		 "%s: reading key name entry at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 function,
+		 key_name_entry->offset,
+		 key_name_entry->offset );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+#endif
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          &( ( data_block->data )[ data_block->entry_data_offsets[ entry_index ] ] ),
+	          (size_t) data_block->entry_sizes[ entry_index ],
+	          ascii_codepage,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key name entry at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_name_entry->offset,
+		 key_name_entry->offset );
+
+		goto on_error;
+	}
+	data_block->entries[ entry_index ] = key_name_entry;
 
 	return( 1 );
 
@@ -552,22 +1256,6 @@ on_error:
 		 &key_name_entry,
 		 NULL );
 	}
-	if( data_block->entries_array != NULL )
-	{
-		libcdata_array_clear(
-		 data_block->entries_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_key_name_entry_free,
-		 NULL );
-	}
-	if( data_block->data != NULL )
-	{
-		memory_free(
-		 data_block->data );
-
-		data_block->data = NULL;
-	}
-	data_block->data_size = 0;
-
 	return( -1 );
 }
 
@@ -592,24 +1280,24 @@ int libcreg_data_block_get_number_of_entries(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     data_block->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( number_of_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_entries = data_block->number_of_entries;
+
 	return( 1 );
 }
 
 /* Retrieves a specific key name entry
+ * The key name entry is read on first access
  * Returns 1 if successful, 0 if no such entry or -1 on error
  */
 int libcreg_data_block_get_entry_by_identifier(
@@ -619,10 +1307,11 @@ int libcreg_data_block_get_entry_by_identifier(
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	libcreg_key_name_entry_t *safe_key_name_entry = NULL;
-	static char *function                         = "libcreg_data_block_get_entry_by_identifier";
-	int entry_index                               = 0;
-	int number_of_entries                         = 0;
+	static char *function = "libcreg_data_block_get_entry_by_identifier";
+	int entry_index       = 0;
+	int lower_index       = 0;
+	int result            = 1;
+	int upper_index       = 0;
 
 	if( data_block == NULL )
 	{
@@ -657,59 +1346,83 @@ int libcreg_data_block_get_entry_by_identifier(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     data_block->entries_array,
-	     &number_of_entries,
+	/* Determine the first entry with an identifier that is equal or greater
+	 */
+	upper_index = data_block->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( data_block->entry_identifiers[ entry_index ] < identifier )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	if( ( lower_index >= data_block->number_of_entries )
+	 || ( data_block->entry_identifiers[ lower_index ] != identifier ) )
+	{
+		return( 0 );
+	}
+	entry_index = lower_index;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     data_block->mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+#endif
+	if( data_block->entries[ entry_index ] == NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     data_block->entries_array,
+		if( libcreg_data_block_read_key_name_entry(
+		     data_block,
 		     entry_index,
-		     (intptr_t **) &safe_key_name_entry,
+		     ascii_codepage,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key name entry: %d.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		if( safe_key_name_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block - missing key name entry: %d.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key name entry: %" PRIu16 ".",
 			 function,
-			 entry_index );
+			 identifier );
 
-			return( -1 );
+			result = -1;
 		}
-		if( safe_key_name_entry->index == identifier )
-		{
-			*key_name_entry = safe_key_name_entry;
+	}
+	if( result == 1 )
+	{
+		*key_name_entry = data_block->entries[ entry_index ];
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     data_block->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
 
-			return( 1 );
-		}
+		return( -1 );
 	}
-	return( 0 );
+#endif
+	return( result );
 }
 
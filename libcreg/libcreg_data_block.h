@@ -27,8 +27,8 @@
 
 #include "libcreg_key_name_entry.h"
 #include "libcreg_libbfio.h"
-#include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -62,9 +62,39 @@ struct libcreg_data_block
 	 */
 	size_t data_size;
 
-	/* The key name entries array
+	/* The number of key name entries
 	 */
-	libcdata_array_t *entries_array;
+	int number_of_entries;
+
+	/* The key name entry identifiers
+	 * The identifiers are sorted in ascending order
+	 */
+	uint16_t *entry_identifiers;
+
+	/* The key name entry offsets relative to the start of the data
+	 */
+	uint32_t *entry_data_offsets;
+
+	/* The key name entry sizes
+	 */
+	uint32_t *entry_sizes;
+
+	/* The key name entries
+	 * A key name entry is read on first access
+	 */
+	libcreg_key_name_entry_t **entries;
+
+	/* The number of references to the data block
+	 * The data block is freed when its last reference is released
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes reading the key name entries and their values on demand
+	 * and protects the number of references
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int libcreg_data_block_initialize(
@@ -75,6 +105,20 @@ int libcreg_data_block_free(
      libcreg_data_block_t **data_block,
      libcerror_error_t **error );
 
+int libcreg_data_block_grab_reference(
+     libcreg_data_block_t *data_block,
+     libcerror_error_t **error );
+
+int libcreg_data_block_release_reference(
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error );
+
+int libcreg_data_block_read_header_data(
+     libcreg_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libcreg_data_block_read_header(
      libcreg_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
@@ -84,6 +128,21 @@ int libcreg_data_block_read_header(
 int libcreg_data_block_read_entries(
      libcreg_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libcreg_data_block_read_entries_data(
+     libcreg_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcreg_data_block_read_key_name_entries(
+     libcreg_data_block_t *data_block,
+     libcerror_error_t **error );
+
+int libcreg_data_block_read_key_name_entry(
+     libcreg_data_block_t *data_block,
+     int entry_index,
      int ascii_codepage,
      libcerror_error_t **error );
 
@@ -0,0 +1,539 @@
+/*
+ * Data block loader functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_data_block_loader.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcnotify.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfdata.h"
+
+#include "creg_data_block.h"
+
+/* Creates a data block loader
+ * Make sure the value data_block_loader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_loader_initialize(
+     libcreg_data_block_loader_t **data_block_loader,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *data_blocks_list,
+     libcreg_data_block_t **data_blocks,
+     int number_of_data_blocks,
+     int first_data_block_index,
+     int data_block_index_increment,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_data_block_loader_initialize";
+	int result            = 0;
+
+	if( data_block_loader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block loader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_block_loader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block loader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_blocks_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data blocks list.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_blocks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of data blocks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_data_block_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first data block index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_index_increment <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid data block index increment value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*data_block_loader = memory_allocate_structure(
+	                      libcreg_data_block_loader_t );
+
+	if( *data_block_loader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block loader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_block_loader,
+	     0,
+	     sizeof( libcreg_data_block_loader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data block loader.",
+		 function );
+
+		memory_free(
+		 *data_block_loader );
+
+		*data_block_loader = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &( ( *data_block_loader )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *data_block_loader )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *data_block_loader )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		( *data_block_loader )->file_io_handle_opened_in_library = 1;
+	}
+	( *data_block_loader )->data_blocks_list           = data_blocks_list;
+	( *data_block_loader )->data_blocks                = data_blocks;
+	( *data_block_loader )->number_of_data_blocks      = number_of_data_blocks;
+	( *data_block_loader )->first_data_block_index     = first_data_block_index;
+	( *data_block_loader )->data_block_index_increment = data_block_index_increment;
+
+	return( 1 );
+
+on_error:
+	if( *data_block_loader != NULL )
+	{
+		if( ( *data_block_loader )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *data_block_loader )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *data_block_loader );
+
+		*data_block_loader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a data block loader
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_loader_free(
+     libcreg_data_block_loader_t **data_block_loader,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_data_block_loader_free";
+	int result            = 1;
+
+	if( data_block_loader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block loader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_block_loader != NULL )
+	{
+		/* The data_blocks_list and data_blocks references are freed elsewhere
+		 */
+		if( ( *data_block_loader )->file_io_handle_opened_in_library != 0 )
+		{
+			if( libbfio_handle_close(
+			     ( *data_block_loader )->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_handle_free(
+		     &( ( *data_block_loader )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *data_block_loader );
+
+		*data_block_loader = NULL;
+	}
+	return( result );
+}
+
+/* Reads a specific data block
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_loader_read_data_block(
+     libcreg_data_block_loader_t *data_block_loader,
+     int data_block_index,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *safe_data_block = NULL;
+	static char *function                 = "libcreg_data_block_loader_read_data_block";
+	size64_t data_block_size              = 0;
+	off64_t data_block_offset             = 0;
+	uint32_t data_block_flags             = 0;
+	int data_block_file_index             = 0;
+
+	if( data_block_loader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block loader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     data_block_loader->data_blocks_list,
+	     data_block_index,
+	     &data_block_file_index,
+	     &data_block_offset,
+	     &data_block_size,
+	     &data_block_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data blocks list element: %d.",
+		 function,
+		 data_block_index );
+
+		goto on_error;
+	}
+	if( ( data_block_size < (size64_t) sizeof( creg_data_block_header_t ) )
+	 || ( data_block_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block: %d size value out of bounds.",
+		 function,
+		 data_block_index );
+
+		goto on_error;
+	}
+	if( libcreg_data_block_initialize(
+	     &safe_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_data_block_read_header(
+	     safe_data_block,
+	     data_block_loader->file_io_handle,
+	     data_block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block: %d header.",
+		 function,
+		 data_block_index );
+
+		goto on_error;
+	}
+	if( (size64_t) safe_data_block->size != data_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in data block: %d size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
+		 function,
+		 data_block_index,
+		 safe_data_block->size,
+		 data_block_size );
+
+		goto on_error;
+	}
+	if( libcreg_data_block_read_entries(
+	     safe_data_block,
+	     data_block_loader->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block: %d key name entries.",
+		 function,
+		 data_block_index );
+
+		goto on_error;
+	}
+	*data_block = safe_data_block;
+
+	return( 1 );
+
+on_error:
+	if( safe_data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &safe_data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Loads the data blocks of the loader
+ * Data blocks that already have been loaded are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_loader_load_data_blocks(
+     libcreg_data_block_loader_t *data_block_loader,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_data_block_loader_load_data_blocks";
+	int data_block_index  = 0;
+
+	if( data_block_loader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block loader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_loader->data_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block loader - missing data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_block_index = data_block_loader->first_data_block_index;
+	     data_block_index < data_block_loader->number_of_data_blocks;
+	     data_block_index += data_block_loader->data_block_index_increment )
+	{
+		if( data_block_loader->data_blocks[ data_block_index ] != NULL )
+		{
+			continue;
+		}
+		if( libcreg_data_block_loader_read_data_block(
+		     data_block_loader,
+		     data_block_index,
+		     &( data_block_loader->data_blocks[ data_block_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block: %d.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Loads the data blocks of the loader
+ * Callback function for the loader thread, the result is stored in the loader
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_data_block_loader_load_callback(
+     libcreg_data_block_loader_t *data_block_loader )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libcreg_data_block_loader_load_callback";
+
+	if( data_block_loader == NULL )
+	{
+		return( -1 );
+	}
+	data_block_loader->result = libcreg_data_block_loader_load_data_blocks(
+	                             data_block_loader,
+	                             &error );
+
+	if( data_block_loader->result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to load data blocks.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( data_block_loader->result );
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Data block loader functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_DATA_BLOCK_LOADER_H )
+#define _LIBCREG_DATA_BLOCK_LOADER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_data_block_loader libcreg_data_block_loader_t;
+
+struct libcreg_data_block_loader
+{
+	/* The file IO handle
+	 * The handle is a clone of the file IO handle of the file so that loaders can read concurrently
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened by the loader
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The data blocks list
+	 */
+	libfdata_list_t *data_blocks_list;
+
+	/* The loaded data blocks
+	 * The array is shared by the loaders and each loader only sets its own entries
+	 */
+	libcreg_data_block_t **data_blocks;
+
+	/* The number of data blocks
+	 */
+	int number_of_data_blocks;
+
+	/* The index of the first data block to load
+	 */
+	int first_data_block_index;
+
+	/* The data block index increment
+	 */
+	int data_block_index_increment;
+
+	/* The result of loading the data blocks
+	 */
+	int result;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The thread that loads the data blocks
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int libcreg_data_block_loader_initialize(
+     libcreg_data_block_loader_t **data_block_loader,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *data_blocks_list,
+     libcreg_data_block_t **data_blocks,
+     int number_of_data_blocks,
+     int first_data_block_index,
+     int data_block_index_increment,
+     libcerror_error_t **error );
+
+int libcreg_data_block_loader_free(
+     libcreg_data_block_loader_t **data_block_loader,
+     libcerror_error_t **error );
+
+int libcreg_data_block_loader_read_data_block(
+     libcreg_data_block_loader_t *data_block_loader,
+     int data_block_index,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error );
+
+int libcreg_data_block_loader_load_data_blocks(
+     libcreg_data_block_loader_t *data_block_loader,
+     libcerror_error_t **error );
+
+int libcreg_data_block_loader_load_callback(
+     libcreg_data_block_loader_t *data_block_loader );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_DATA_BLOCK_LOADER_H ) */
+
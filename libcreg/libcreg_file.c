@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
+#include <wctype.h>
 #include <wide_string.h>
 
 #include "libcreg_codepage.h"
@@ -30,17 +31,21 @@
 #include "libcreg_debug.h"
 #include "libcreg_definitions.h"
 #include "libcreg_file.h"
+#include "libcreg_index_file.h"
 #include "libcreg_io_handle.h"
 #include "libcreg_key.h"
 #include "libcreg_key_item.h"
 #include "libcreg_key_navigation.h"
 #include "libcreg_key_tree.h"
+#include "libcreg_key_walker.h"
 #include "libcreg_libbfio.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
 #include "libcreg_libcthreads.h"
 #include "libcreg_libfcache.h"
 #include "libcreg_libuna.h"
+#include "libcreg_path_cache.h"
+#include "libcreg_path_index.h"
 
 #include "creg_file_header.h"
 #include "creg_key_navigation.h"
@@ -106,6 +111,8 @@ int libcreg_file_initialize(
 
 		goto on_error;
 	}
+	internal_file->path_cache_size = LIBCREG_MAXIMUM_CACHE_ENTRIES_PATHS;
+
 	if( libcreg_io_handle_initialize(
 	     &( internal_file->io_handle ),
 	     error ) != 1 )
@@ -206,6 +213,22 @@ int libcreg_file_free(
 			result = -1;
 		}
 #endif
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcreg_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -766,6 +789,227 @@ on_error:
 	return( -1 );
 }
 
+/* Opens a file from a buffer in memory
+ * The buffer is copied unless LIBCREG_MEMORY_FLAG_BORROW_BUFFER is set,
+ * in which case the buffer must remain valid until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_open_memory(
+     libcreg_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int memory_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_open_memory";
+	uint8_t *memory_buffer                 = NULL;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_flags & ~( LIBCREG_MEMORY_FLAG_BORROW_BUFFER ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory flags: 0x%02x.",
+		 function,
+		 memory_flags );
+
+		return( -1 );
+	}
+	if( ( memory_flags & LIBCREG_MEMORY_FLAG_BORROW_BUFFER ) == 0 )
+	{
+		if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		memory_buffer = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * buffer_size );
+
+		if( memory_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create memory buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     memory_buffer,
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track offsets read in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The memory range is only read from, the buffer is not modified
+	 */
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     ( memory_buffer != NULL ) ? memory_buffer : (uint8_t *) buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     LIBCREG_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->memory_buffer                     = memory_buffer;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+		internal_file->memory_buffer                     = NULL;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_buffer != NULL )
+	{
+		memory_free(
+		 memory_buffer );
+	}
+	return( -1 );
+}
+
 /* Closes a file
  * Returns 0 if successful or -1 on error
  */
@@ -871,6 +1115,14 @@ int libcreg_file_close(
 	}
 	internal_file->file_io_handle = NULL;
 
+	if( internal_file->memory_buffer != NULL )
+	{
+		memory_free(
+		 internal_file->memory_buffer );
+
+		internal_file->memory_buffer = NULL;
+	}
+
 	if( libcreg_io_handle_clear(
 	     internal_file->io_handle,
 	     error ) != 1 )
@@ -900,6 +1152,22 @@ int libcreg_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->path_cache != NULL )
+	{
+		if( libcreg_path_cache_free(
+		     &( internal_file->path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -1024,34 +1292,23 @@ int libcreg_internal_file_open_read(
 
 			goto on_error;
 		}
-		result = libcreg_key_navigation_read_file_io_handle(
-		          internal_file->key_navigation,
-		          file_io_handle,
-		          error );
-
-		if( result == -1 )
+		if( libcreg_key_navigation_set_read_ahead_size(
+		     internal_file->key_navigation,
+		     internal_file->read_ahead_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read key navigation.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead size.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading data blocks:\n" );
-		}
-#endif
-		result = libcreg_key_navigation_read_data_blocks(
+		result = libcreg_key_navigation_read_file_io_handle(
 		          internal_file->key_navigation,
 		          file_io_handle,
-		          (off64_t) internal_file->io_handle->data_blocks_list_offset,
-		          file_size,
 		          error );
 
 		if( result == -1 )
@@ -1060,44 +1317,123 @@ int libcreg_internal_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data blocks.",
+			 "%s: unable to read key navigation.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		result = 0;
+
+		if( internal_file->index_file_io_handle != NULL )
 		{
-			if( libcreg_key_navigation_get_number_of_data_blocks(
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading index file:\n" );
+			}
+#endif
+			result = libcreg_internal_file_read_index_file(
+			          internal_file,
+			          file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Scan the data blocks if there is no valid index file
+		 * When scanning on demand the number of data blocks is not verified
+		 */
+		if( ( result == 0 )
+		 && ( internal_file->scan_data_blocks_on_demand != 0 ) )
+		{
+			if( libcreg_key_navigation_initialize_data_blocks(
 			     internal_file->key_navigation,
-			     &number_of_data_blocks,
+			     (off64_t) internal_file->io_handle->data_blocks_list_offset,
+			     file_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of data blocks.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize data blocks.",
 				 function );
 
 				goto on_error;
 			}
-			if( number_of_data_blocks != (int) header_number_of_data_blocks )
+		}
+		else if( result == 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading data blocks:\n" );
+			}
+#endif
+			result = libcreg_key_navigation_read_data_blocks(
+			          internal_file->key_navigation,
+			          file_io_handle,
+			          (off64_t) internal_file->io_handle->data_blocks_list_offset,
+			          file_size,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid number of data blocks value out of bounds.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data blocks.",
 				 function );
 
 				goto on_error;
 			}
-/* TODO free & clone function */
 		}
-	}
-	return( 1 );
-
-on_error:
+		if( result != 0 )
+		{
+			if( libcreg_key_navigation_get_number_of_data_blocks(
+			     internal_file->key_navigation,
+			     file_io_handle,
+			     &number_of_data_blocks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of data blocks.",
+				 function );
+
+				goto on_error;
+			}
+			if( number_of_data_blocks != (int) header_number_of_data_blocks )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of data blocks value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+/* TODO free & clone function */
+		}
+	}
+	return( 1 );
+
+on_error:
 	if( internal_file->key_navigation != NULL )
 	{
 		libcreg_key_navigation_free(
@@ -1107,6 +1443,109 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the index file
+ * Returns 1 if successful, 0 if the index file does not exist or is not valid or -1 on error
+ */
+int libcreg_internal_file_read_index_file(
+     libcreg_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_internal_file_read_index_file";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          internal_file->index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if index file exists.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     internal_file->index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcreg_index_file_read_file_io_handle(
+	          internal_file->key_navigation,
+	          file_io_handle,
+	          internal_file->index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file.",
+		 function );
+
+		libbfio_handle_close(
+		 internal_file->index_file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     internal_file->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Determine if the file corrupted
  * Returns 1 if corrupted, 0 if not or -1 on error
  */
@@ -1270,6 +1709,7 @@ int libcreg_file_set_ascii_codepage(
 {
 	libcreg_internal_file_t *internal_file = NULL;
 	static char *function                  = "libcreg_file_set_ascii_codepage";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1337,6 +1777,60 @@ int libcreg_file_set_ascii_codepage(
 #endif
 	internal_file->io_handle->ascii_codepage = ascii_codepage;
 
+	/* The cached paths were resolved using the previous codepage
+	 */
+	if( internal_file->path_cache != NULL )
+	{
+		if( libcreg_path_cache_free(
+		     &( internal_file->path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->key_navigation != NULL )
+	{
+		if( libcreg_key_navigation_empty_offset_path_cache(
+		     internal_file->key_navigation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty offset path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The path hashes of the path index were calculated using the previous codepage,
+	 * the path index is rebuilt when it is needed next
+	 */
+	if( ( internal_file->key_navigation != NULL )
+	 && ( internal_file->key_navigation->path_index != NULL ) )
+	{
+		if( libcreg_path_index_free(
+		     &( internal_file->key_navigation->path_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path index.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -1352,7 +1846,7 @@ int libcreg_file_set_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the format version
@@ -1530,16 +2024,18 @@ int libcreg_file_get_type(
 	return( 1 );
 }
 
-/* Retrieves the root key
- * Returns 1 if successful, if no such key or -1 on error
+/* Builds the path index
+ * The path index is used to retrieve keys by path without following the path segment by segment
+ * The path index is kept until the file is closed
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_file_get_root_key(
+int libcreg_file_build_path_index(
      libcreg_file_t *file,
-     libcreg_key_t **root_key,
      libcerror_error_t **error )
 {
 	libcreg_internal_file_t *internal_file = NULL;
-	static char *function                  = "libcreg_file_get_root_key";
+	static char *function                  = "libcreg_file_build_path_index";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1554,63 +2050,81 @@ int libcreg_file_get_root_key(
 	}
 	internal_file = (libcreg_internal_file_t *) file;
 
-	if( root_key == NULL )
+	if( internal_file->key_navigation == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid root key.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
 		 function );
 
 		return( -1 );
 	}
-	if( *root_key != NULL )
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: root key already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement thread lock */
-	if( libcreg_key_initialize(
-	     root_key,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     internal_file->key_navigation,
-	     LIBCREG_ROOT_KEY_OFFSET,
+#endif
+	if( internal_file->key_navigation->path_index == NULL )
+	{
+		if( libcreg_key_navigation_build_path_index(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     LIBCREG_ROOT_KEY_OFFSET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build path index.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root key.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the key for the specific UTF-8 encoded path
- * The path separator is the \ character
- * Returns 1 if successful, 0 if no such key or -1 on error
+/* Reads the key hierarchy table
+ * The key hierarchy table contains all the key hierarchy entries, read with a single read,
+ * and is used instead of reading the key hierarchy entries individually
+ * The key hierarchy table is kept until the file is closed
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_file_get_key_by_utf8_path(
+int libcreg_file_read_key_hierarchy_table(
      libcreg_file_t *file,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libcreg_key_t **key,
      libcerror_error_t **error )
 {
 	libcreg_internal_file_t *internal_file = NULL;
-	static char *function                  = "libcreg_file_get_key_by_utf8_path";
-	int result                             = 0;
+	static char *function                  = "libcreg_file_read_key_hierarchy_table";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1625,57 +2139,111 @@ int libcreg_file_get_key_by_utf8_path(
 	}
 	internal_file = (libcreg_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->key_navigation == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing key navigation.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+#endif
+	if( internal_file->key_navigation->key_hierarchy_table == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
-		 function );
+		if( libcreg_key_navigation_read_key_hierarchy_table(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key hierarchy table.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	if( key == NULL )
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( *key != NULL )
-	{
-		libcerror_error_set(
+#endif
+	return( result );
+}
+
+/* Loads the data blocks ahead of their retrieval
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_load_data_blocks(
+     libcreg_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_load_data_blocks";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->key_navigation == NULL )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: key already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBCREG_MAXIMUM_NUMBER_OF_LOAD_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -1695,24 +2263,17 @@ int libcreg_file_get_key_by_utf8_path(
 		return( -1 );
 	}
 #endif
-	result = libcreg_key_tree_get_sub_key_by_utf8_path(
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          internal_file->key_navigation,
-	          (off64_t) LIBCREG_ROOT_KEY_OFFSET,
-	          utf8_string,
-	          utf8_string_length,
-	          internal_file->io_handle->ascii_codepage,
-	          key,
-		  error );
-
-	if( result == -1 )
+	if( libcreg_key_navigation_load_data_blocks(
+	     internal_file->key_navigation,
+	     internal_file->file_io_handle,
+	     number_of_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve key by UTF-8 path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to load data blocks.",
 		 function );
 
 		result = -1;
@@ -1735,20 +2296,21 @@ int libcreg_file_get_key_by_utf8_path(
 	return( result );
 }
 
-/* Retrieves the key for the specific UTF-16 encoded path
- * The path separator is the \ character
- * Returns 1 if successful, 0 if no such key or -1 on error
+/* Sets the filename of the index file
+ * The index file contains the data blocks and path index of the file
+ * If set before the file is opened, a valid index file is read instead of scanning the file
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_file_get_key_by_utf16_path(
+int libcreg_file_set_index_filename(
      libcreg_file_t *file,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libcreg_key_t **key,
+     const char *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *index_file_io_handle = NULL;
 	libcreg_internal_file_t *internal_file = NULL;
-	static char *function                  = "libcreg_file_get_key_by_utf16_path";
-	int result                             = 0;
+	static char *function                  = "libcreg_file_set_index_filename";
+	size_t filename_length                 = 0;
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -1763,61 +2325,210 @@ int libcreg_file_get_key_by_utf16_path(
 	}
 	internal_file = (libcreg_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_file->index_file_io_handle = index_file_io_handle;
+		index_file_io_handle                = NULL;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the index file
+ * The index file contains the data blocks and path index of the file
+ * If set before the file is opened, a valid index file is read instead of scanning the file
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_set_index_filename_wide(
+     libcreg_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_set_index_filename_wide";
+	size_t filename_length                 = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( key == NULL )
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *key != NULL )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: key already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
@@ -1830,30 +2541,2542 @@ int libcreg_file_get_key_by_utf16_path(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	result = libcreg_key_tree_get_sub_key_by_utf16_path(
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          internal_file->key_navigation,
-	          (off64_t) LIBCREG_ROOT_KEY_OFFSET,
-	          utf16_string,
-	          utf16_string_length,
-	          internal_file->io_handle->ascii_codepage,
-	          key,
-		  error );
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
 
-	if( result == -1 )
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_file->index_file_io_handle = index_file_io_handle;
+		index_file_io_handle                = NULL;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve key by UTF-16 path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		result = -1;
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the index file
+ * The path index is built if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_write_index_file(
+     libcreg_file_t *file,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_write_index_file";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->key_navigation->path_index == NULL )
+	{
+		if( libcreg_key_navigation_build_path_index(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     LIBCREG_ROOT_KEY_OFFSET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build path index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libbfio_handle_open(
+		     internal_file->index_file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcreg_index_file_write_file_io_handle(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     internal_file->index_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index file.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_close(
+		     internal_file->index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum number of entries in the path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_get_path_cache_size(
+     libcreg_file_t *file,
+     int *path_cache_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_path_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( path_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*path_cache_size = internal_file->path_cache_size;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of entries in the path cache
+ * A value of 0 disables the path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_set_path_cache_size(
+     libcreg_file_t *file,
+     int path_cache_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_set_path_cache_size";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( ( path_cache_size < 0 )
+	 || ( path_cache_size > ( 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path cache size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The path cache is recreated with the new size on the next retrieval by path
+	 */
+	if( internal_file->path_cache != NULL )
+	{
+		if( libcreg_path_cache_free(
+		     &( internal_file->path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->path_cache_size = path_cache_size;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the read-ahead window
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_get_read_ahead_size(
+     libcreg_file_t *file,
+     size_t *read_ahead_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_read_ahead_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( read_ahead_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*read_ahead_size = internal_file->read_ahead_size;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the size of the read-ahead window
+ * The read-ahead window is used to read several consecutive data blocks with a single read
+ * A value of 0 disables the read-ahead window
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_set_read_ahead_size(
+     libcreg_file_t *file,
+     size_t read_ahead_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_set_read_ahead_size";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( read_ahead_size > (size_t) LIBCREG_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->key_navigation != NULL )
+	{
+		if( libcreg_key_navigation_set_read_ahead_size(
+		     internal_file->key_navigation,
+		     read_ahead_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead size in key navigation.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_file->read_ahead_size = read_ahead_size;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves if the data blocks are scanned on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_get_scan_data_blocks_on_demand(
+     libcreg_file_t *file,
+     uint8_t *scan_on_demand,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_scan_data_blocks_on_demand";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( scan_on_demand == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan on demand.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*scan_on_demand = internal_file->scan_data_blocks_on_demand;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets if the data blocks are scanned on demand
+ * By default all data blocks are scanned when the file is opened
+ * When scanning on demand the data blocks are only scanned as far as needed to retrieve
+ * a specific data block and the data blocks that were scanned are kept until the file is closed
+ * This only affects files that are opened after it was set
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_set_scan_data_blocks_on_demand(
+     libcreg_file_t *file,
+     uint8_t scan_on_demand,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_set_scan_data_blocks_on_demand";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( scan_on_demand != 0 )
+	{
+		internal_file->scan_data_blocks_on_demand = 1;
+	}
+	else
+	{
+		internal_file->scan_data_blocks_on_demand = 0;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the root key
+ * Returns 1 if successful, if no such key or -1 on error
+ */
+int libcreg_file_get_root_key(
+     libcreg_file_t *file,
+     libcreg_key_t **root_key,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_root_key";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( root_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *root_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: root key already set.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO implement thread lock */
+	if( libcreg_key_initialize(
+	     root_key,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->key_navigation,
+	     LIBCREG_ROOT_KEY_OFFSET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the key at a specific offset
+ * The offset is the offset of the key hierarchy entry as returned by libcreg_key_get_offset
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_get_key_by_offset(
+     libcreg_file_t *file,
+     off64_t key_offset,
+     libcreg_key_t **key,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_key_by_offset";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( ( key_offset <= 0 )
+	 || ( key_offset >= (off64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_initialize(
+	     key,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->key_navigation,
+	     (uint32_t) key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libcreg_key_free(
+		 key,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the key offset for the specific UTF-8 encoded path using the path cache
+ * The path separator is the \ character
+ * The path is resolved from the longest cached parent path and the resolved paths are added to the cache
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libcreg_internal_file_get_key_offset_by_utf8_path(
+     libcreg_internal_file_t *internal_file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t *path             = NULL;
+	const uint8_t *utf8_string_segment           = NULL;
+	static char *function                        = "libcreg_internal_file_get_key_offset_by_utf8_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t path_index                            = 0;
+	size_t resume_path_index                     = 0;
+	size_t resume_utf8_string_index              = 0;
+	size_t utf8_string_character_index           = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_segment_length            = 0;
+	size_t utf8_string_start_index               = 0;
+	uint32_t cached_key_offset                   = 0;
+	uint32_t path_hash                           = 0;
+	uint32_t resume_path_hash                    = 0;
+	uint32_t safe_key_offset                     = (uint32_t) LIBCREG_ROOT_KEY_OFFSET;
+	uint8_t is_separator                         = 0;
+	int key_entry_index                          = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->path_cache_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - path cache size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length > (size_t) SSIZE_MAX )
+	 || ( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ 0 ] == (uint8_t) LIBCREG_SEPARATOR )
+		{
+			utf8_string_start_index++;
+		}
+	}
+	/* If the string is empty return the root key
+	 */
+	if( utf8_string_length == utf8_string_start_index )
+	{
+		*key_offset = safe_key_offset;
+
+		return( 1 );
+	}
+	if( internal_file->path_cache == NULL )
+	{
+		if( libcreg_path_cache_initialize(
+		     &( internal_file->path_cache ),
+		     internal_file->path_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create path cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Every Unicode character takes at least one UTF-8 character
+	 */
+	path = (libuna_unicode_character_t *) memory_allocate(
+	                                       sizeof( libuna_unicode_character_t ) * ( utf8_string_length - utf8_string_start_index ) );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the upper case path and look up the longest cached parent path
+	 */
+	resume_utf8_string_index = utf8_string_start_index;
+	utf8_string_index        = utf8_string_start_index;
+
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+		 || ( unicode_character == 0 ) )
+		{
+			if( path_index > 0 )
+			{
+				result = libcreg_path_cache_get_key_offset(
+				          internal_file->path_cache,
+				          path_hash,
+				          path,
+				          path_index,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve cached key offset.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					resume_utf8_string_index = utf8_string_index;
+					resume_path_index        = path_index + 1;
+					resume_path_hash         = ( path_hash * 37 ) + (uint32_t) LIBCREG_SEPARATOR;
+					safe_key_offset          = cached_key_offset;
+				}
+			}
+			unicode_character = (libuna_unicode_character_t) LIBCREG_SEPARATOR;
+		}
+		path[ path_index ] = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		path_hash *= 37;
+		path_hash += (uint32_t) path[ path_index ];
+
+		path_index++;
+	}
+	result = libcreg_path_cache_get_key_offset(
+	          internal_file->path_cache,
+	          path_hash,
+	          path,
+	          path_index,
+	          &cached_key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached key offset.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		memory_free(
+		 path );
+
+		*key_offset = cached_key_offset;
+
+		return( 1 );
+	}
+	result = 0;
+
+	if( internal_file->key_navigation->path_index != NULL )
+	{
+		result = libcreg_path_index_get_entry_index_by_key_offset(
+		          internal_file->key_navigation->path_index,
+		          safe_key_offset,
+		          &key_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path index entry for key offset: %" PRIu32 ".",
+			 function,
+			 safe_key_offset );
+
+			goto on_error;
+		}
+	}
+	/* Resolve the remainder of the path with the path index if the key is indexed
+	 */
+	if( result != 0 )
+	{
+		result = libcreg_key_navigation_get_sub_key_offset_by_utf8_path_from_path_index(
+		          internal_file->key_navigation,
+		          internal_file->file_io_handle,
+		          key_entry_index,
+		          &( utf8_string[ resume_utf8_string_index ] ),
+		          utf8_string_length - resume_utf8_string_index,
+		          internal_file->io_handle->ascii_codepage,
+		          &safe_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key offset by path from path index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcreg_path_cache_set_key_offset(
+			     internal_file->path_cache,
+			     path_hash,
+			     path,
+			     path_index,
+			     safe_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set cached key offset.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The path index does not contain keys that could not be indexed, such as keys
+	 * with a name that cannot be decoded, hence if the path index has no match
+	 * the remainder of the path is resolved segment by segment and every parent path is cached
+	 */
+	if( result == 0 )
+	{
+		result            = 1;
+		path_index        = resume_path_index;
+		path_hash         = resume_path_hash;
+		utf8_string_index = resume_utf8_string_index;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			utf8_string_segment         = &( utf8_string[ utf8_string_index ] );
+			utf8_string_segment_length  = utf8_string_index;
+			utf8_string_character_index = utf8_string_index;
+			is_separator                = 0;
+
+			while( utf8_string_index < utf8_string_length )
+			{
+				utf8_string_character_index = utf8_string_index;
+
+				if( libuna_unicode_character_copy_from_utf8(
+				     &unicode_character,
+				     utf8_string,
+				     utf8_string_length,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 string to Unicode character.",
+					 function );
+
+					goto on_error;
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					is_separator = 1;
+
+					break;
+				}
+				path_hash *= 37;
+				path_hash += (uint32_t) path[ path_index ];
+
+				path_index++;
+			}
+			if( is_separator != 0 )
+			{
+				utf8_string_segment_length = utf8_string_character_index - utf8_string_segment_length;
+			}
+			else
+			{
+				utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+			}
+			if( utf8_string_segment_length == 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libcreg_key_navigation_get_sub_key_offset_by_utf8_name(
+				          internal_file->key_navigation,
+				          internal_file->file_io_handle,
+				          safe_key_offset,
+				          utf8_string_segment,
+				          utf8_string_segment_length,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_key_offset,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcreg_path_cache_set_key_offset(
+			     internal_file->path_cache,
+			     path_hash,
+			     path,
+			     path_index,
+			     safe_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set cached key offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( is_separator != 0 )
+			{
+				path_hash *= 37;
+				path_hash += (uint32_t) LIBCREG_SEPARATOR;
+
+				path_index++;
+			}
+		}
+	}
+	memory_free(
+	 path );
+
+	if( result != 0 )
+	{
+		*key_offset = safe_key_offset;
+	}
+	return( result );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key for the specific UTF-8 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libcreg_file_get_key_by_utf8_path(
+     libcreg_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcreg_key_t **key,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_key_by_utf8_path";
+	uint32_t key_offset                    = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->path_cache_size > 0 )
+	{
+		result = libcreg_internal_file_get_key_offset_by_utf8_path(
+		          internal_file,
+		          utf8_string,
+		          utf8_string_length,
+		          &key_offset,
+		          error );
+
+		if( result == 1 )
+		{
+			if( libcreg_key_initialize(
+			     key,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     internal_file->key_navigation,
+			     key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create key.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	else
+	{
+		result = libcreg_key_tree_get_sub_key_by_utf8_path(
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->key_navigation,
+		          (off64_t) LIBCREG_ROOT_KEY_OFFSET,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_file->io_handle->ascii_codepage,
+		          key,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key by UTF-8 path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the key offset for the specific UTF-16 encoded path using the path cache
+ * The path separator is the \ character
+ * The path is resolved from the longest cached parent path and the resolved paths are added to the cache
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libcreg_internal_file_get_key_offset_by_utf16_path(
+     libcreg_internal_file_t *internal_file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t *path             = NULL;
+	const uint16_t *utf16_string_segment         = NULL;
+	static char *function                        = "libcreg_internal_file_get_key_offset_by_utf16_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t path_index                            = 0;
+	size_t resume_path_index                     = 0;
+	size_t resume_utf16_string_index             = 0;
+	size_t utf16_string_character_index          = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf16_string_segment_length           = 0;
+	size_t utf16_string_start_index              = 0;
+	uint32_t cached_key_offset                   = 0;
+	uint32_t path_hash                           = 0;
+	uint32_t resume_path_hash                    = 0;
+	uint32_t safe_key_offset                     = (uint32_t) LIBCREG_ROOT_KEY_OFFSET;
+	uint8_t is_separator                         = 0;
+	int key_entry_index                          = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->path_cache_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - path cache size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length > (size_t) SSIZE_MAX )
+	 || ( utf16_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ 0 ] == (uint16_t) LIBCREG_SEPARATOR )
+		{
+			utf16_string_start_index++;
+		}
+	}
+	/* If the string is empty return the root key
+	 */
+	if( utf16_string_length == utf16_string_start_index )
+	{
+		*key_offset = safe_key_offset;
+
+		return( 1 );
+	}
+	if( internal_file->path_cache == NULL )
+	{
+		if( libcreg_path_cache_initialize(
+		     &( internal_file->path_cache ),
+		     internal_file->path_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create path cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Every Unicode character takes at least one UTF-16 character
+	 */
+	path = (libuna_unicode_character_t *) memory_allocate(
+	                                       sizeof( libuna_unicode_character_t ) * ( utf16_string_length - utf16_string_start_index ) );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the upper case path and look up the longest cached parent path
+	 */
+	resume_utf16_string_index = utf16_string_start_index;
+	utf16_string_index        = utf16_string_start_index;
+
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+		 || ( unicode_character == 0 ) )
+		{
+			if( path_index > 0 )
+			{
+				result = libcreg_path_cache_get_key_offset(
+				          internal_file->path_cache,
+				          path_hash,
+				          path,
+				          path_index,
+				          &cached_key_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve cached key offset.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					resume_utf16_string_index = utf16_string_index;
+					resume_path_index        = path_index + 1;
+					resume_path_hash         = ( path_hash * 37 ) + (uint32_t) LIBCREG_SEPARATOR;
+					safe_key_offset          = cached_key_offset;
+				}
+			}
+			unicode_character = (libuna_unicode_character_t) LIBCREG_SEPARATOR;
+		}
+		path[ path_index ] = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		path_hash *= 37;
+		path_hash += (uint32_t) path[ path_index ];
+
+		path_index++;
+	}
+	result = libcreg_path_cache_get_key_offset(
+	          internal_file->path_cache,
+	          path_hash,
+	          path,
+	          path_index,
+	          &cached_key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached key offset.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		memory_free(
+		 path );
+
+		*key_offset = cached_key_offset;
+
+		return( 1 );
+	}
+	result = 0;
+
+	if( internal_file->key_navigation->path_index != NULL )
+	{
+		result = libcreg_path_index_get_entry_index_by_key_offset(
+		          internal_file->key_navigation->path_index,
+		          safe_key_offset,
+		          &key_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path index entry for key offset: %" PRIu32 ".",
+			 function,
+			 safe_key_offset );
+
+			goto on_error;
+		}
+	}
+	/* Resolve the remainder of the path with the path index if the key is indexed
+	 */
+	if( result != 0 )
+	{
+		result = libcreg_key_navigation_get_sub_key_offset_by_utf16_path_from_path_index(
+		          internal_file->key_navigation,
+		          internal_file->file_io_handle,
+		          key_entry_index,
+		          &( utf16_string[ resume_utf16_string_index ] ),
+		          utf16_string_length - resume_utf16_string_index,
+		          internal_file->io_handle->ascii_codepage,
+		          &safe_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key offset by path from path index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcreg_path_cache_set_key_offset(
+			     internal_file->path_cache,
+			     path_hash,
+			     path,
+			     path_index,
+			     safe_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set cached key offset.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The path index does not contain keys that could not be indexed, such as keys
+	 * with a name that cannot be decoded, hence if the path index has no match
+	 * the remainder of the path is resolved segment by segment and every parent path is cached
+	 */
+	if( result == 0 )
+	{
+		result            = 1;
+		path_index        = resume_path_index;
+		path_hash         = resume_path_hash;
+		utf16_string_index = resume_utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			utf16_string_segment         = &( utf16_string[ utf16_string_index ] );
+			utf16_string_segment_length  = utf16_string_index;
+			utf16_string_character_index = utf16_string_index;
+			is_separator                = 0;
+
+			while( utf16_string_index < utf16_string_length )
+			{
+				utf16_string_character_index = utf16_string_index;
+
+				if( libuna_unicode_character_copy_from_utf16(
+				     &unicode_character,
+				     utf16_string,
+				     utf16_string_length,
+				     &utf16_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string to Unicode character.",
+					 function );
+
+					goto on_error;
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					is_separator = 1;
+
+					break;
+				}
+				path_hash *= 37;
+				path_hash += (uint32_t) path[ path_index ];
+
+				path_index++;
+			}
+			if( is_separator != 0 )
+			{
+				utf16_string_segment_length = utf16_string_character_index - utf16_string_segment_length;
+			}
+			else
+			{
+				utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+			}
+			if( utf16_string_segment_length == 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libcreg_key_navigation_get_sub_key_offset_by_utf16_name(
+				          internal_file->key_navigation,
+				          internal_file->file_io_handle,
+				          safe_key_offset,
+				          utf16_string_segment,
+				          utf16_string_segment_length,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_key_offset,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcreg_path_cache_set_key_offset(
+			     internal_file->path_cache,
+			     path_hash,
+			     path,
+			     path_index,
+			     safe_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set cached key offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( is_separator != 0 )
+			{
+				path_hash *= 37;
+				path_hash += (uint32_t) LIBCREG_SEPARATOR;
+
+				path_index++;
+			}
+		}
+	}
+	memory_free(
+	 path );
+
+	if( result != 0 )
+	{
+		*key_offset = safe_key_offset;
+	}
+	return( result );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key for the specific UTF-16 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libcreg_file_get_key_by_utf16_path(
+     libcreg_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcreg_key_t **key,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	static char *function                  = "libcreg_file_get_key_by_utf16_path";
+	uint32_t key_offset                    = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->path_cache_size > 0 )
+	{
+		result = libcreg_internal_file_get_key_offset_by_utf16_path(
+		          internal_file,
+		          utf16_string,
+		          utf16_string_length,
+		          &key_offset,
+		          error );
+
+		if( result == 1 )
+		{
+			if( libcreg_key_initialize(
+			     key,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     internal_file->key_navigation,
+			     key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create key.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	else
+	{
+		result = libcreg_key_tree_get_sub_key_by_utf16_path(
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->key_navigation,
+		          (off64_t) LIBCREG_ROOT_KEY_OFFSET,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_file->io_handle->ascii_codepage,
+		          key,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key by UTF-16 path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the keys for specific UTF-8 encoded paths
+ * The path separator is the \ character
+ * The paths are resolved in a single pass in which the parent keys that the paths have in common are resolved only once
+ * The keys are stored in the same order as the paths, where a path without a corresponding key results in a NULL key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_get_keys_by_utf8_paths(
+     libcreg_file_t *file,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libcreg_key_t **keys,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	uint32_t *key_offsets                  = NULL;
+	static char *function                  = "libcreg_file_get_keys_by_utf8_paths";
+	int path_index                         = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( keys[ path_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: key: %d already set.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+	if( number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	key_offsets = (uint32_t *) memory_allocate(
+	                            sizeof( uint32_t ) * (size_t) number_of_paths );
+
+	if( key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key offsets.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 key_offsets );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_tree_get_sub_key_offsets_by_utf8_paths(
+	     internal_file->key_navigation,
+	     internal_file->file_io_handle,
+	     (uint32_t) LIBCREG_ROOT_KEY_OFFSET,
+	     utf8_strings,
+	     utf8_string_lengths,
+	     number_of_paths,
+	     internal_file->io_handle->ascii_codepage,
+	     key_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key offsets by UTF-8 paths.",
+		 function );
+
+		result = -1;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( result != 1 )
+		{
+			break;
+		}
+		if( key_offsets[ path_index ] == 0 )
+		{
+			continue;
+		}
+		if( libcreg_key_initialize(
+		     &( keys[ path_index ] ),
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->key_navigation,
+		     key_offsets[ path_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key: %d.",
+			 function,
+			 path_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	memory_free(
+	 key_offsets );
+
+	if( result != 1 )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			if( keys[ path_index ] != NULL )
+			{
+				libcreg_key_free(
+				 &( keys[ path_index ] ),
+				 NULL );
+			}
+		}
+	}
+	return( result );
+}
+
+/* Walks the keys of the file starting at the root key
+ * The keys are walked concurrently by the number of threads if multi-threading is supported,
+ * otherwise by a single thread, where every thread mostly walks a separate sub tree
+ * The key hierarchy table is read if it was not read before
+ * The data blocks are shared with libcreg_file_load_data_blocks, data blocks that were loaded before
+ * are not read again and data blocks read by the walk remain loaded until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_file_walk(
+     libcreg_file_t *file,
+     libcreg_walk_callbacks_t *callbacks,
+     int number_of_threads,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcreg_internal_file_t *internal_file = NULL;
+	libcreg_key_walker_t *key_walker       = NULL;
+	static char *function                  = "libcreg_file_walk";
+	int number_of_data_blocks              = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libcreg_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBCREG_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCREG_WALK_FLAG_SKIP_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The workers retrieve the key hierarchy entries from the key hierarchy table,
+	 * which unlike the key hierarchy cache is not modified on retrieval
+	 */
+	if( internal_file->key_navigation->key_hierarchy_table == NULL )
+	{
+		if( libcreg_key_navigation_read_key_hierarchy_table(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key hierarchy table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcreg_key_navigation_get_number_of_data_blocks(
+		     internal_file->key_navigation,
+		     internal_file->file_io_handle,
+		     &number_of_data_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data blocks.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcreg_key_walker_initialize(
+		     &key_walker,
+		     internal_file->file_io_handle,
+		     internal_file->key_navigation->key_hierarchy_table,
+		     internal_file->key_navigation,
+		     number_of_data_blocks,
+		     internal_file->io_handle->ascii_codepage,
+		     callbacks,
+		     number_of_threads,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key walker.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcreg_key_walker_walk(
+		     key_walker,
+		     (uint32_t) LIBCREG_ROOT_KEY_OFFSET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk keys.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( key_walker != NULL )
+	{
+		if( libcreg_key_walker_free(
+		     &key_walker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key walker.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -32,6 +32,7 @@
 #include "libcreg_libcerror.h"
 #include "libcreg_libcthreads.h"
 #include "libcreg_libfcache.h"
+#include "libcreg_path_cache.h"
 #include "libcreg_types.h"
 
 #if defined( __cplusplus )
@@ -54,6 +55,32 @@ struct libcreg_internal_file
 	 */
 	libcreg_key_navigation_t *key_navigation;
 
+	/* The index file IO handle
+	 */
+	libbfio_handle_t *index_file_io_handle;
+
+	/* The path cache
+	 */
+	libcreg_path_cache_t *path_cache;
+
+	/* The maximum number of entries in the path cache
+	 * A value of 0 disables the path cache
+	 */
+	int path_cache_size;
+
+	/* The copy of the buffer the file was opened from
+	 */
+	uint8_t *memory_buffer;
+
+	/* The size of the read-ahead window
+	 * A value of 0 disables the read-ahead window
+	 */
+	size_t read_ahead_size;
+
+	/* Value to indicate if the data blocks are scanned on demand
+	 */
+	uint8_t scan_data_blocks_on_demand;
+
 	/* Value to indicate if the file IO handle was created inside the library
 	 */
 	uint8_t file_io_handle_created_in_library;
@@ -113,6 +140,14 @@ int libcreg_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_file_open_memory(
+     libcreg_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int memory_flags,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_file_close(
      libcreg_file_t *file,
@@ -123,6 +158,11 @@ int libcreg_internal_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libcreg_internal_file_read_index_file(
+     libcreg_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_file_is_corrupted(
      libcreg_file_t *file,
@@ -153,12 +193,99 @@ int libcreg_file_get_type(
      uint32_t *file_type,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_file_build_path_index(
+     libcreg_file_t *file,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_read_key_hierarchy_table(
+     libcreg_file_t *file,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_load_data_blocks(
+     libcreg_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_set_index_filename(
+     libcreg_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCREG_EXTERN \
+int libcreg_file_set_index_filename_wide(
+     libcreg_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBCREG_EXTERN \
+int libcreg_file_write_index_file(
+     libcreg_file_t *file,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_get_path_cache_size(
+     libcreg_file_t *file,
+     int *path_cache_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_set_path_cache_size(
+     libcreg_file_t *file,
+     int path_cache_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_get_read_ahead_size(
+     libcreg_file_t *file,
+     size_t *read_ahead_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_set_read_ahead_size(
+     libcreg_file_t *file,
+     size_t read_ahead_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_get_scan_data_blocks_on_demand(
+     libcreg_file_t *file,
+     uint8_t *scan_on_demand,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_set_scan_data_blocks_on_demand(
+     libcreg_file_t *file,
+     uint8_t scan_on_demand,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_file_get_root_key(
      libcreg_file_t *file,
      libcreg_key_t **root_key,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_file_get_key_by_offset(
+     libcreg_file_t *file,
+     off64_t key_offset,
+     libcreg_key_t **key,
+     libcerror_error_t **error );
+
+int libcreg_internal_file_get_key_offset_by_utf8_path(
+     libcreg_internal_file_t *internal_file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_file_get_key_by_utf8_path(
      libcreg_file_t *file,
@@ -167,6 +294,13 @@ int libcreg_file_get_key_by_utf8_path(
      libcreg_key_t **key,
      libcerror_error_t **error );
 
+int libcreg_internal_file_get_key_offset_by_utf16_path(
+     libcreg_internal_file_t *internal_file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_file_get_key_by_utf16_path(
      libcreg_file_t *file,
@@ -175,6 +309,23 @@ int libcreg_file_get_key_by_utf16_path(
      libcreg_key_t **key,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_file_get_keys_by_utf8_paths(
+     libcreg_file_t *file,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libcreg_key_t **keys,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_file_walk(
+     libcreg_file_t *file,
+     libcreg_walk_callbacks_t *callbacks,
+     int number_of_threads,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,374 @@
+/*
+ * Case folded name functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_folded_name.h"
+#include "libcreg_libcerror.h"
+
+/* Upper cases the ASCII lower case letters in the 8 bytes of a 64-bit value
+ * The bytes must be less than 0x80, which prevents carries between the bytes
+ */
+#define libcreg_folded_name_upper_case_64bit( value ) \
+	( ( value ) - ( ( ( ( value ) + 0x1f1f1f1f1f1f1f1fULL ) & ~( ( value ) + 0x0505050505050505ULL ) & 0x8080808080808080ULL ) >> 2 ) )
+
+/* Creates a case folded name
+ * The case folded name is an upper case copy of a name that consists of ASCII characters,
+ * which are encoded the same in every supported codepage
+ * Make sure the value folded_name is referencing, is set to NULL
+ * Returns 1 if successful, 0 if the name contains non-ASCII characters or -1 on error
+ */
+int libcreg_folded_name_initialize(
+     uint8_t **folded_name,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_folded_name_initialize";
+	size_t name_index     = 0;
+	uint8_t byte_value    = 0;
+
+	if( folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *folded_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid folded name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		if( name[ name_index ] >= 0x80 )
+		{
+			return( 0 );
+		}
+	}
+	*folded_name = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * name_size );
+
+	if( *folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folded name.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		byte_value = name[ name_index ];
+
+		if( ( byte_value >= (uint8_t) 'a' )
+		 && ( byte_value <= (uint8_t) 'z' ) )
+		{
+			byte_value -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		( *folded_name )[ name_index ] = byte_value;
+	}
+	return( 1 );
+}
+
+/* Frees a case folded name
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_folded_name_free(
+     uint8_t **folded_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_folded_name_free";
+
+	if( folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *folded_name != NULL )
+	{
+		memory_free(
+		 *folded_name );
+
+		*folded_name = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares a case folded name with an UTF-8 encoded string
+ * The string is compared 8 bytes at a time while it consists of ASCII characters
+ * Returns 1 if the names match, 0 if not, 2 if the string contains non-ASCII characters or -1 on error
+ */
+int libcreg_folded_name_compare_with_utf8_string(
+     const uint8_t *folded_name,
+     size_t folded_name_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcreg_folded_name_compare_with_utf8_string";
+	size_t utf8_string_index    = 0;
+	uint64_t name_value_64bit   = 0;
+	uint64_t string_value_64bit = 0;
+	uint8_t name_value          = 0;
+	uint8_t string_value        = 0;
+	int result                  = 1;
+
+	if( folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( folded_name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid folded name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A string that contains non-ASCII characters can still match after upper casing,
+	 * hence the whole string is checked even if the sizes differ or a mismatch was found
+	 */
+	if( utf8_string_length != folded_name_size )
+	{
+		result = 0;
+	}
+	while( ( utf8_string_index + 8 ) <= utf8_string_length )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf8_string[ utf8_string_index ] ),
+		 string_value_64bit );
+
+		if( ( string_value_64bit & 0x8080808080808080ULL ) != 0 )
+		{
+			return( 2 );
+		}
+		if( result != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( folded_name[ utf8_string_index ] ),
+			 name_value_64bit );
+
+			if( libcreg_folded_name_upper_case_64bit( string_value_64bit ) != name_value_64bit )
+			{
+				result = 0;
+			}
+		}
+		utf8_string_index += 8;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		string_value = utf8_string[ utf8_string_index ];
+
+		if( string_value >= 0x80 )
+		{
+			return( 2 );
+		}
+		if( result != 0 )
+		{
+			if( ( string_value >= (uint8_t) 'a' )
+			 && ( string_value <= (uint8_t) 'z' ) )
+			{
+				string_value -= (uint8_t) 'a' - (uint8_t) 'A';
+			}
+			name_value = folded_name[ utf8_string_index ];
+
+			if( string_value != name_value )
+			{
+				result = 0;
+			}
+		}
+		utf8_string_index++;
+	}
+	return( result );
+}
+
+/* Compares a case folded name with an UTF-16 encoded string
+ * Returns 1 if the names match, 0 if not, 2 if the string contains non-ASCII characters or -1 on error
+ */
+int libcreg_folded_name_compare_with_utf16_string(
+     const uint8_t *folded_name,
+     size_t folded_name_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcreg_folded_name_compare_with_utf16_string";
+	size_t utf16_string_index = 0;
+	uint16_t string_value     = 0;
+	int result                = 1;
+
+	if( folded_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( folded_name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid folded name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length != folded_name_size )
+	{
+		result = 0;
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		string_value = utf16_string[ utf16_string_index ];
+
+		if( string_value >= 0x80 )
+		{
+			return( 2 );
+		}
+		if( result != 0 )
+		{
+			if( ( string_value >= (uint16_t) 'a' )
+			 && ( string_value <= (uint16_t) 'z' ) )
+			{
+				string_value -= (uint16_t) 'a' - (uint16_t) 'A';
+			}
+			if( string_value != (uint16_t) folded_name[ utf16_string_index ] )
+			{
+				result = 0;
+			}
+		}
+	}
+	return( result );
+}
+
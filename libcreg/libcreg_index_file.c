@@ -0,0 +1,1021 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_checksum.h"
+#include "libcreg_definitions.h"
+#include "libcreg_index_file.h"
+#include "libcreg_io_handle.h"
+#include "libcreg_key_navigation.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcnotify.h"
+#include "libcreg_libfdata.h"
+#include "libcreg_path_index.h"
+#include "libcreg_sharded_cache.h"
+
+#include "creg_file_header.h"
+#include "creg_index_file.h"
+#include "creg_key_navigation.h"
+
+const char *creg_index_file_signature = "cregidx\x00";
+
+/* Calculates the checksum of the registry file
+ * The checksum covers the file header and key navigation header, which
+ * contain the number of data blocks and the size of the key hierarchy
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_index_file_calculate_registry_file_checksum(
+     libbfio_handle_t *file_io_handle,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t headers_data[ sizeof( creg_file_header_t ) + sizeof( creg_key_navigation_header_t ) ];
+
+	static char *function = "libcreg_index_file_calculate_registry_file_checksum";
+	ssize_t read_count    = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              headers_data,
+	              sizeof( creg_file_header_t ) + sizeof( creg_key_navigation_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) ( sizeof( creg_file_header_t ) + sizeof( creg_key_navigation_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header and key navigation header data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_checksum_calculate_adler32(
+	     checksum,
+	     headers_data,
+	     sizeof( creg_file_header_t ) + sizeof( creg_key_navigation_header_t ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data blocks and path index of the key navigation from an index file
+ * Returns 1 if successful, 0 if the index file is not valid for the registry file or -1 on error
+ */
+int libcreg_index_file_read_file_io_handle(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	creg_index_file_header_t index_file_header;
+
+	libcreg_path_index_t *path_index      = NULL;
+	libfdata_list_t *data_blocks_list     = NULL;
+	uint8_t *entries_data                 = NULL;
+	static char *function                 = "libcreg_index_file_read_file_io_handle";
+	size64_t file_size                    = 0;
+	size64_t index_file_size              = 0;
+	size64_t maximum_number_of_entries    = 0;
+	size_t entries_data_offset            = 0;
+	size_t entries_data_size              = 0;
+	ssize_t read_count                    = 0;
+	uint64_t stored_file_size             = 0;
+	uint32_t calculated_checksum          = 0;
+	uint32_t data_block_offset            = 0;
+	uint32_t data_block_size              = 0;
+	uint32_t format_version               = 0;
+	uint32_t key_offset                   = 0;
+	uint32_t number_of_data_block_entries = 0;
+	uint32_t number_of_path_index_entries = 0;
+	uint32_t parent_entry_index           = 0;
+	uint32_t path_hash                    = 0;
+	uint32_t stored_ascii_codepage        = 0;
+	uint32_t stored_checksum              = 0;
+	uint32_t entry_index                  = 0;
+	int element_index                     = 0;
+	int path_index_entry_index            = 0;
+	int result                            = 1;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - data blocks list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - data blocks cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->path_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - path index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_size < sizeof( creg_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              (uint8_t *) &index_file_header,
+	              sizeof( creg_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( creg_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: index file header:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &index_file_header,
+		 sizeof( creg_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     index_file_header.signature,
+	     creg_index_file_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.header_checksum,
+	 stored_checksum );
+
+	if( libcreg_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     (uint8_t *) &index_file_header,
+	     sizeof( creg_index_file_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_file_header.registry_file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.registry_file_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_data_block_entries,
+	 number_of_data_block_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_path_index_entries,
+	 number_of_path_index_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.ascii_codepage,
+	 stored_ascii_codepage );
+
+	if( format_version != LIBCREG_INDEX_FILE_FORMAT_VERSION )
+	{
+		return( 0 );
+	}
+	/* The index file is stale if the registry file was changed after the index file was written
+	 */
+	if( stored_file_size != (uint64_t) file_size )
+	{
+		return( 0 );
+	}
+	if( libcreg_index_file_calculate_registry_file_checksum(
+	     file_io_handle,
+	     &calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate registry file checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	maximum_number_of_entries = ( key_navigation->key_hierarchy_data_size / sizeof( creg_key_hierarchy_entry_t ) ) + 1;
+
+	if( ( number_of_data_block_entries == 0 )
+	 || ( (size64_t) number_of_data_block_entries > ( file_size / sizeof( creg_index_file_data_block_entry_t ) ) )
+	 || ( (size64_t) number_of_path_index_entries > maximum_number_of_entries )
+	 || ( number_of_path_index_entries > (uint32_t) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	entries_data_size = ( (size_t) number_of_data_block_entries * sizeof( creg_index_file_data_block_entry_t ) )
+	                  + ( (size_t) number_of_path_index_entries * sizeof( creg_index_file_path_index_entry_t ) );
+
+	if( ( entries_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( (size64_t) entries_data_size != ( index_file_size - sizeof( creg_index_file_header_t ) ) ) )
+	{
+		return( 0 );
+	}
+	entries_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * entries_data_size );
+
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              entries_data,
+	              entries_data_size,
+	              (off64_t) sizeof( creg_index_file_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) entries_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file entries data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.entries_data_checksum,
+	 stored_checksum );
+
+	if( libcreg_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     entries_data,
+	     entries_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate entries data checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		if( libfdata_list_initialize(
+		     &data_blocks_list,
+		     (intptr_t *) key_navigation,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libcreg_key_navigation_read_data_block_element_data,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data blocks list.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_data_block_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (creg_index_file_data_block_entry_t *) &( entries_data[ entries_data_offset ] ) )->offset,
+			 data_block_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (creg_index_file_data_block_entry_t *) &( entries_data[ entries_data_offset ] ) )->size,
+			 data_block_size );
+
+			entries_data_offset += sizeof( creg_index_file_data_block_entry_t );
+
+			if( ( data_block_offset < key_navigation->io_handle->data_blocks_list_offset )
+			 || ( data_block_size == 0 )
+			 || ( (size64_t) data_block_offset > file_size )
+			 || ( (size64_t) data_block_size > ( file_size - data_block_offset ) ) )
+			{
+				result = 0;
+
+				break;
+			}
+			if( libfdata_list_append_element(
+			     data_blocks_list,
+			     &element_index,
+			     0,
+			     (off64_t) data_block_offset,
+			     (size64_t) data_block_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data block: %" PRIu32 " to data list.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The path hashes depend on the codepage, hence the path index is not read
+	 * if it was written using a different codepage and is rebuilt when needed
+	 */
+	if( ( result == 1 )
+	 && ( number_of_path_index_entries > 0 )
+	 && ( (int) stored_ascii_codepage == key_navigation->io_handle->ascii_codepage ) )
+	{
+		if( libcreg_path_index_initialize(
+		     &path_index,
+		     (int) number_of_path_index_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create path index.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_path_index_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->key_offset,
+			 key_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->parent_entry_index,
+			 parent_entry_index );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->path_hash,
+			 path_hash );
+
+			entries_data_offset += sizeof( creg_index_file_path_index_entry_t );
+
+			/* The parent of an entry is always stored before the entry itself
+			 */
+			if( ( parent_entry_index != 0xffffffffUL )
+			 && ( parent_entry_index >= entry_index ) )
+			{
+				result = 0;
+
+				break;
+			}
+			if( libcreg_path_index_append_entry(
+			     path_index,
+			     key_offset,
+			     ( parent_entry_index == 0xffffffffUL ) ? -1 : (int) parent_entry_index,
+			     path_hash,
+			     &path_index_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append path index entry: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libcreg_path_index_build_hash_tables(
+			     path_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build path index hash tables.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 entries_data );
+
+	entries_data = NULL;
+
+	if( result == 0 )
+	{
+		if( path_index != NULL )
+		{
+			if( libcreg_path_index_free(
+			     &path_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( data_blocks_list != NULL )
+		{
+			if( libfdata_list_free(
+			     &data_blocks_list,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data blocks list.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( 0 );
+	}
+	if( libcreg_sharded_cache_initialize(
+	     &( key_navigation->data_blocks_cache ),
+	     LIBCREG_NUMBER_OF_CACHE_SHARDS,
+	     LIBCREG_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data blocks cache.",
+		 function );
+
+		goto on_error;
+	}
+	key_navigation->data_blocks_list = data_blocks_list;
+	key_navigation->path_index       = path_index;
+
+	return( 1 );
+
+on_error:
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	if( data_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_blocks_list,
+		 NULL );
+	}
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( -1 );
+}
+
+/* Writes the data blocks and path index of the key navigation to an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_index_file_write_file_io_handle(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	creg_index_file_header_t index_file_header;
+
+	uint8_t *entries_data            = NULL;
+	static char *function            = "libcreg_index_file_write_file_io_handle";
+	size64_t element_size            = 0;
+	size64_t file_size               = 0;
+	size_t entries_data_offset       = 0;
+	size_t entries_data_size         = 0;
+	ssize_t write_count              = 0;
+	off64_t element_offset           = 0;
+	uint32_t checksum                = 0;
+	uint32_t element_flags           = 0;
+	uint32_t key_offset              = 0;
+	uint32_t path_hash               = 0;
+	int element_file_index           = 0;
+	int entry_index                  = 0;
+	int number_of_data_blocks        = 0;
+	int number_of_path_index_entries = 0;
+	int parent_entry_index           = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing data blocks list.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &index_file_header,
+	     0,
+	     sizeof( creg_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_key_navigation_get_number_of_data_blocks(
+	     key_navigation,
+	     file_io_handle,
+	     &number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_path_index_entries = key_navigation->path_index->number_of_entries;
+
+	entries_data_size = ( (size_t) number_of_data_blocks * sizeof( creg_index_file_data_block_entry_t ) )
+	                  + ( (size_t) number_of_path_index_entries * sizeof( creg_index_file_path_index_entry_t ) );
+
+	if( ( entries_data_size == 0 )
+	 || ( entries_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entries data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entries_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * entries_data_size );
+
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries data.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_data_blocks;
+	     entry_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     key_navigation->data_blocks_list,
+		     entry_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( element_offset < 0 )
+		 || ( element_offset > (off64_t) UINT32_MAX )
+		 || ( element_size > (size64_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %d range value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (creg_index_file_data_block_entry_t *) &( entries_data[ entries_data_offset ] ) )->offset,
+		 (uint32_t) element_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (creg_index_file_data_block_entry_t *) &( entries_data[ entries_data_offset ] ) )->size,
+		 (uint32_t) element_size );
+
+		entries_data_offset += sizeof( creg_index_file_data_block_entry_t );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_path_index_entries;
+	     entry_index++ )
+	{
+		if( libcreg_path_index_get_entry_values(
+		     key_navigation->path_index,
+		     entry_index,
+		     &key_offset,
+		     &parent_entry_index,
+		     &path_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path index entry: %d values.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->key_offset,
+		 key_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->parent_entry_index,
+		 ( parent_entry_index < 0 ) ? 0xffffffffUL : (uint32_t) parent_entry_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (creg_index_file_path_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->path_hash,
+		 path_hash );
+
+		entries_data_offset += sizeof( creg_index_file_path_index_entry_t );
+	}
+	if( memory_copy(
+	     index_file_header.signature,
+	     creg_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.format_version,
+	 LIBCREG_INDEX_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_file_header.registry_file_size,
+	 (uint64_t) file_size );
+
+	if( libcreg_index_file_calculate_registry_file_checksum(
+	     file_io_handle,
+	     &checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate registry file checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.registry_file_checksum,
+	 checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_data_block_entries,
+	 (uint32_t) number_of_data_blocks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_path_index_entries,
+	 (uint32_t) number_of_path_index_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.ascii_codepage,
+	 (uint32_t) key_navigation->io_handle->ascii_codepage );
+
+	if( libcreg_checksum_calculate_adler32(
+	     &checksum,
+	     entries_data,
+	     entries_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate entries data checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.entries_data_checksum,
+	 checksum );
+
+	if( libcreg_checksum_calculate_adler32(
+	     &checksum,
+	     (uint8_t *) &index_file_header,
+	     sizeof( creg_index_file_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.header_checksum,
+	 checksum );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               index_file_io_handle,
+	               (uint8_t *) &index_file_header,
+	               sizeof( creg_index_file_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( creg_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               index_file_io_handle,
+	               entries_data,
+	               entries_data_size,
+	               (off64_t) sizeof( creg_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) entries_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file entries data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entries_data );
+
+	return( 1 );
+
+on_error:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( -1 );
+}
+
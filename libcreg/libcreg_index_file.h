@@ -0,0 +1,62 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_INDEX_FILE_H )
+#define _LIBCREG_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_key_navigation.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The index file format version
+ */
+#define LIBCREG_INDEX_FILE_FORMAT_VERSION	2
+
+int libcreg_index_file_calculate_registry_file_checksum(
+     libbfio_handle_t *file_io_handle,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+int libcreg_index_file_read_file_io_handle(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libcreg_index_file_write_file_io_handle(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_INDEX_FILE_H ) */
+
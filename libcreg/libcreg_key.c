@@ -26,6 +26,7 @@
 #include "libcreg_definitions.h"
 #include "libcreg_io_handle.h"
 #include "libcreg_key.h"
+#include "libcreg_key_cursor.h"
 #include "libcreg_key_descriptor.h"
 #include "libcreg_key_item.h"
 #include "libcreg_key_name_entry.h"
@@ -37,6 +38,7 @@
 #include "libcreg_libuna.h"
 #include "libcreg_types.h"
 #include "libcreg_value.h"
+#include "libcreg_value_cursor.h"
 #include "libcreg_value_entry.h"
 #include "libcreg_value_type.h"
 
@@ -153,6 +155,19 @@ int libcreg_key_initialize(
 
 		goto on_error;
 	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_key->sub_keys_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub keys mutex.",
+		 function );
+
+		goto on_error;
+	}
 #endif
 	internal_key->file_io_handle = file_io_handle;
 	internal_key->io_handle      = io_handle;
@@ -166,6 +181,14 @@ int libcreg_key_initialize(
 on_error:
 	if( internal_key != NULL )
 	{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( internal_key->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_key->read_write_lock ),
+			 NULL );
+		}
+#endif
 		if( internal_key->key_item != NULL )
 		{
 			libcreg_key_item_free(
@@ -219,6 +242,19 @@ int libcreg_key_free(
 
 			result = -1;
 		}
+		if( libcthreads_mutex_free(
+		     &( internal_key->sub_keys_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub keys mutex.",
+			 function );
+
+			result = -1;
+		}
 #endif
 		/* The io_handle and file_io_handle references are freed elsewhere
 		 */
@@ -277,7 +313,7 @@ int libcreg_key_is_corrupted(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -285,7 +321,7 @@ int libcreg_key_is_corrupted(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -307,7 +343,7 @@ int libcreg_key_is_corrupted(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -315,7 +351,7 @@ int libcreg_key_is_corrupted(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -371,7 +407,7 @@ int libcreg_key_get_offset(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -379,7 +415,7 @@ int libcreg_key_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -391,7 +427,7 @@ int libcreg_key_get_offset(
 	*offset = internal_key->key_offset + internal_key->io_handle->data_blocks_list_offset + 4;
 
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -399,7 +435,7 @@ int libcreg_key_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -434,7 +470,7 @@ int libcreg_key_get_name_size(
 	internal_key = (libcreg_internal_key_t *) key;
 
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -442,7 +478,7 @@ int libcreg_key_get_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -463,7 +499,7 @@ int libcreg_key_get_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -471,7 +507,7 @@ int libcreg_key_get_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -507,7 +543,7 @@ int libcreg_key_get_name(
 	internal_key = (libcreg_internal_key_t *) key;
 
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -515,7 +551,7 @@ int libcreg_key_get_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -537,7 +573,83 @@ int libcreg_key_get_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a reference to the key name
+ * The name is codepage encoded, owned by the library and not copied
+ * The reference remains valid while the key and the file it was retrieved from are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_name_reference(
+     libcreg_key_t *key,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	static char *function                = "libcreg_key_get_name_reference";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_item_get_name_reference(
+	     internal_key->key_item,
+	     string,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -545,7 +657,7 @@ int libcreg_key_get_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -592,7 +704,7 @@ int libcreg_key_get_utf8_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -600,7 +712,7 @@ int libcreg_key_get_utf8_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -622,7 +734,7 @@ int libcreg_key_get_utf8_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -630,7 +742,7 @@ int libcreg_key_get_utf8_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -679,7 +791,7 @@ int libcreg_key_get_utf8_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -687,7 +799,7 @@ int libcreg_key_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -710,7 +822,7 @@ int libcreg_key_get_utf8_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -718,7 +830,7 @@ int libcreg_key_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -765,7 +877,7 @@ int libcreg_key_get_utf16_name_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -773,7 +885,7 @@ int libcreg_key_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -795,7 +907,7 @@ int libcreg_key_get_utf16_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -803,7 +915,7 @@ int libcreg_key_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -852,7 +964,7 @@ int libcreg_key_get_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -860,7 +972,7 @@ int libcreg_key_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -883,7 +995,7 @@ int libcreg_key_get_utf16_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -891,7 +1003,7 @@ int libcreg_key_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -900,16 +1012,20 @@ int libcreg_key_get_utf16_name(
 	return( result );
 }
 
-/* Retrieves the number of values
+/* Retrieves the size of the UTF-8 encoded path of the key
+ * The path is determined from the parent keys and starts with a separator
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libcreg_key_get_number_of_values(
+int libcreg_key_get_utf8_path_size(
      libcreg_key_t *key,
-     int *number_of_values,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libcreg_internal_key_t *internal_key = NULL;
-	static char *function                = "libcreg_key_get_number_of_values";
+	uint8_t *utf8_path                   = NULL;
+	static char *function                = "libcreg_key_get_utf8_path_size";
+	size_t utf8_path_size                = 0;
 	int result                           = 1;
 
 	if( key == NULL )
@@ -925,8 +1041,19 @@ int libcreg_key_get_number_of_values(
 	}
 	internal_key = (libcreg_internal_key_t *) key;
 
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -934,28 +1061,35 @@ int libcreg_key_get_number_of_values(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcreg_key_item_get_number_of_value_entries(
-	     internal_key->key_item,
-	     number_of_values,
+	if( libcreg_key_navigation_get_utf8_path_by_key_offset(
+	     internal_key->key_navigation,
+	     internal_key->file_io_handle,
+	     (uint32_t) internal_key->key_offset,
+	     &utf8_path,
+	     &utf8_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of value entries.",
+		 "%s: unable to retrieve UTF-8 path.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		*utf8_string_size = utf8_path_size;
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -963,27 +1097,43 @@ int libcreg_key_get_number_of_values(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
 	return( result );
+
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific value
+/* Retrieves the UTF-8 encoded path of the key
+ * The path is determined from the parent keys and starts with a separator
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libcreg_key_get_value_by_index(
+int libcreg_key_get_utf8_path(
      libcreg_key_t *key,
-     int value_index,
-     libcreg_value_t **value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libcreg_internal_key_t *internal_key = NULL;
-	libcreg_value_entry_t *value_entry   = NULL;
-	static char *function                = "libcreg_key_get_value_by_index";
+	uint8_t *utf8_path                   = NULL;
+	static char *function                = "libcreg_key_get_utf8_path";
+	size_t utf8_path_size                = 0;
 	int result                           = 1;
 
 	if( key == NULL )
@@ -999,30 +1149,19 @@ int libcreg_key_get_value_by_index(
 	}
 	internal_key = (libcreg_internal_key_t *) key;
 
-	if( value == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *value != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: value already set.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1030,45 +1169,56 @@ int libcreg_key_get_value_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcreg_key_item_get_value_entry_by_index(
-	     internal_key->key_item,
-	     value_index,
-	     &value_entry,
+	if( libcreg_key_navigation_get_utf8_path_by_key_offset(
+	     internal_key->key_navigation,
+	     internal_key->file_io_handle,
+	     (uint32_t) internal_key->key_offset,
+	     &utf8_path,
+	     &utf8_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value entry: %d.",
-		 function,
-		 value_index );
+		 "%s: unable to retrieve UTF-8 path.",
+		 function );
 
 		result = -1;
 	}
-	else if( libcreg_value_initialize(
-	          value,
-	          internal_key->io_handle,
-	          value_entry,
-	          error ) != 1 )
+	else if( utf8_string_size < utf8_path_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		result = -1;
+	}
+	else if( memory_copy(
+	          utf8_string,
+	          utf8_path,
+	          utf8_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 path.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1076,29 +1226,42 @@ int libcreg_key_get_value_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
 	return( result );
+
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	return( -1 );
 }
 
-/* Retrieves the value for the specific UTF-8 encoded name
- * To retrieve the default value specify value name as NULL and its length as 0
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Retrieves the size of the UTF-16 encoded path of the key
+ * The path is determined from the parent keys and starts with a separator
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_key_get_value_by_utf8_name(
+int libcreg_key_get_utf16_path_size(
      libcreg_key_t *key,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libcreg_value_t **value,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libcreg_internal_key_t *internal_key = NULL;
-	libcreg_value_entry_t *value_entry   = NULL;
-	static char *function                = "libcreg_key_get_value_by_utf8_name";
+	uint8_t *utf8_path                   = NULL;
+	static char *function                = "libcreg_key_get_utf16_path_size";
+	size_t utf8_path_size                = 0;
 	int result                           = 1;
 
 	if( key == NULL )
@@ -1114,41 +1277,19 @@ int libcreg_key_get_value_by_utf8_name(
 	}
 	internal_key = (libcreg_internal_key_t *) key;
 
-	if( internal_key->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid key - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( value == NULL )
+	if( utf16_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *value != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: value already set.",
+		 "%s: invalid UTF-16 string size.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1156,51 +1297,46 @@ int libcreg_key_get_value_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libcreg_key_item_get_value_by_utf8_name(
-	          internal_key->key_item,
-	          utf8_string,
-	          utf8_string_length,
-	          internal_key->io_handle->ascii_codepage,
-	          &value_entry,
-	          error );
-
-	if( result == -1 )
+	if( libcreg_key_navigation_get_utf8_path_by_key_offset(
+	     internal_key->key_navigation,
+	     internal_key->file_io_handle,
+	     (uint32_t) internal_key->key_offset,
+	     &utf8_path,
+	     &utf8_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value entry by UTF-8 name.",
+		 "%s: unable to retrieve UTF-8 path.",
 		 function );
 
 		result = -1;
 	}
-	else if( result != 0 )
+	else if( libuna_utf16_string_size_from_utf8(
+	          utf8_path,
+	          utf8_path_size,
+	          utf16_string_size,
+	          error ) != 1 )
 	{
-		if( libcreg_value_initialize(
-		     value,
-		     internal_key->io_handle,
-		     value_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize value.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
 
-			result = -1;
-		}
+		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1208,16 +1344,565 @@ int libcreg_key_get_value_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
 	return( result );
-}
 
-/* Retrieves the value for the specific UTF-16 encoded name
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-16 encoded path of the key
+ * The path is determined from the parent keys and starts with a separator
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_utf16_path(
+     libcreg_key_t *key,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	uint8_t *utf8_path                   = NULL;
+	static char *function                = "libcreg_key_get_utf16_path";
+	size_t utf8_path_size                = 0;
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_navigation_get_utf8_path_by_key_offset(
+	     internal_key->key_navigation,
+	     internal_key->file_io_handle,
+	     (uint32_t) internal_key->key_offset,
+	     &utf8_path,
+	     &utf8_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path.",
+		 function );
+
+		result = -1;
+	}
+	else if( libuna_utf16_string_copy_from_utf8(
+	          utf16_string,
+	          utf16_string_size,
+	          utf8_path,
+	          utf8_path_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	return( result );
+
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_number_of_values(
+     libcreg_key_t *key,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	static char *function                = "libcreg_key_get_number_of_values";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_item_get_number_of_value_entries(
+	     internal_key->key_item,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_value_by_index(
+     libcreg_key_t *key,
+     int value_index,
+     libcreg_value_t **value,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	libcreg_value_entry_t *value_entry   = NULL;
+	static char *function                = "libcreg_key_get_value_by_index";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_item_get_value_entry_by_index(
+	     internal_key->key_item,
+	     value_index,
+	     &value_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry: %d.",
+		 function,
+		 value_index );
+
+		result = -1;
+	}
+	else if( libcreg_value_initialize(
+	          value,
+	          internal_key->io_handle,
+	          internal_key->key_item->data_block,
+	          value_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a value cursor for the values
+ * The value cursor iterates the values without creating a value for every value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_value_cursor(
+     libcreg_key_t *key,
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	static char *function                = "libcreg_key_get_value_cursor";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value cursor already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_value_cursor_initialize(
+	     value_cursor,
+	     internal_key->io_handle,
+	     internal_key->key_item->data_block,
+	     internal_key->key_item->key_name_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value cursor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value for the specific UTF-8 encoded name
+ * To retrieve the default value specify value name as NULL and its length as 0
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcreg_key_get_value_by_utf8_name(
+     libcreg_key_t *key,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcreg_value_t **value,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	libcreg_value_entry_t *value_entry   = NULL;
+	static char *function                = "libcreg_key_get_value_by_utf8_name";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+	if( internal_key->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcreg_key_item_get_value_by_utf8_name(
+	          internal_key->key_item,
+	          utf8_string,
+	          utf8_string_length,
+	          internal_key->io_handle->ascii_codepage,
+	          &value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry by UTF-8 name.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libcreg_value_initialize(
+		     value,
+		     internal_key->io_handle,
+		     internal_key->key_item->data_block,
+		     value_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize value.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value for the specific UTF-16 encoded name
  * To retrieve the default value specify string as NULL
  * and its length as 0
  * Returns 1 if successful, 0 if no such value or -1 on error
@@ -1281,7 +1966,7 @@ int libcreg_key_get_value_by_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1289,7 +1974,7 @@ int libcreg_key_get_value_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1319,6 +2004,7 @@ int libcreg_key_get_value_by_utf16_name(
 		if( libcreg_value_initialize(
 		     value,
 		     internal_key->io_handle,
+		     internal_key->key_item->data_block,
 		     value_entry,
 		     error ) != 1 )
 		{
@@ -1333,7 +2019,7 @@ int libcreg_key_get_value_by_utf16_name(
 		}
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1341,7 +2027,102 @@ int libcreg_key_get_value_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the sub keys on demand
+ * All the sub key descriptors are read once, after which the key item no longer changes
+ * and the sub keys can be retrieved with the read/write lock grabbed for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_internal_key_read_sub_keys_on_demand(
+     libcreg_internal_key_t *internal_key,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcreg_internal_key_read_sub_keys_on_demand";
+	int number_of_sub_keys = 0;
+	int result             = 0;
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_key->sub_keys_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab sub keys mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcreg_key_item_get_cached_number_of_sub_key_descriptors(
+	          internal_key->key_item,
+	          &number_of_sub_keys,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached number of sub key descriptors.",
+		 function );
+	}
+	else if( result == 0 )
+	{
+		/* Retrieving the number of sub key descriptors reads all the sub key descriptors
+		 * and builds the sub key name hash table
+		 */
+		result = libcreg_key_item_get_number_of_sub_key_descriptors(
+		          internal_key->key_item,
+		          internal_key->file_io_handle,
+		          internal_key->key_navigation,
+		          &number_of_sub_keys,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub key descriptors.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_key->sub_keys_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release sub keys mutex.",
 		 function );
 
 		return( -1 );
@@ -1375,8 +2156,21 @@ int libcreg_key_get_number_of_sub_keys(
 	}
 	internal_key = (libcreg_internal_key_t *) key;
 
+	if( libcreg_internal_key_read_sub_keys_on_demand(
+	     internal_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1384,13 +2178,13 @@ int libcreg_key_get_number_of_sub_keys(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcreg_key_item_get_number_of_sub_key_descriptors(
+	if( libcreg_key_item_get_cached_number_of_sub_key_descriptors(
 	     internal_key->key_item,
 	     number_of_sub_keys,
 	     error ) != 1 )
@@ -1399,13 +2193,13 @@ int libcreg_key_get_number_of_sub_keys(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub key descriptors.",
+		 "%s: unable to retrieve cached number of sub key descriptors.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1413,7 +2207,7 @@ int libcreg_key_get_number_of_sub_keys(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1471,8 +2265,21 @@ int libcreg_key_get_sub_key_by_index(
 
 		return( -1 );
 	}
+	if( libcreg_internal_key_read_sub_keys_on_demand(
+	     internal_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1480,7 +2287,7 @@ int libcreg_key_get_sub_key_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1488,7 +2295,9 @@ int libcreg_key_get_sub_key_by_index(
 #endif
 	if( libcreg_key_item_get_sub_key_descriptor_by_index(
 	     internal_key->key_item,
-             sub_key_index,
+	     internal_key->file_io_handle,
+	     internal_key->key_navigation,
+	     sub_key_index,
 	     &sub_key_descriptor,
 	     error ) != 1 )
 	{
@@ -1532,7 +2341,105 @@ int libcreg_key_get_sub_key_by_index(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a key cursor for the sub keys
+ * The key cursor iterates the sub keys without creating a key for every sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_get_sub_key_cursor(
+     libcreg_key_t *key,
+     libcreg_key_cursor_t **sub_key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_t *internal_key = NULL;
+	static char *function                = "libcreg_key_get_sub_key_cursor";
+	int result                           = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libcreg_internal_key_t *) key;
+
+	if( sub_key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_key_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: sub key cursor already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_cursor_initialize(
+	     sub_key_cursor,
+	     internal_key->io_handle,
+	     internal_key->file_io_handle,
+	     internal_key->key_navigation,
+	     (uint32_t) internal_key->key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub key cursor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1540,7 +2447,7 @@ int libcreg_key_get_sub_key_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1588,8 +2495,21 @@ int libcreg_key_get_sub_key_by_utf8_name(
 
 		return( -1 );
 	}
+	if( libcreg_internal_key_read_sub_keys_on_demand(
+	     internal_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1597,7 +2517,7 @@ int libcreg_key_get_sub_key_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1656,7 +2576,7 @@ int libcreg_key_get_sub_key_by_utf8_name(
 		}
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1664,7 +2584,7 @@ int libcreg_key_get_sub_key_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1713,7 +2633,7 @@ int libcreg_key_get_sub_key_by_utf8_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1721,7 +2641,7 @@ int libcreg_key_get_sub_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1750,7 +2670,7 @@ int libcreg_key_get_sub_key_by_utf8_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1758,7 +2678,7 @@ int libcreg_key_get_sub_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1806,8 +2726,21 @@ int libcreg_key_get_sub_key_by_utf16_name(
 
 		return( -1 );
 	}
+	if( libcreg_internal_key_read_sub_keys_on_demand(
+	     internal_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1815,7 +2748,7 @@ int libcreg_key_get_sub_key_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1874,7 +2807,7 @@ int libcreg_key_get_sub_key_by_utf16_name(
 		}
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1882,7 +2815,7 @@ int libcreg_key_get_sub_key_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1931,7 +2864,7 @@ int libcreg_key_get_sub_key_by_utf16_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1939,7 +2872,7 @@ int libcreg_key_get_sub_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1968,7 +2901,7 @@ int libcreg_key_get_sub_key_by_utf16_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_key->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1976,7 +2909,7 @@ int libcreg_key_get_sub_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
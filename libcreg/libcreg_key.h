@@ -64,8 +64,15 @@ struct libcreg_internal_key
 
 #if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
+	 * The name and values of the key item do not change after initialization
+	 * and the sub keys do not change after they have been read on demand
+	 * hence the key item only requires the lock for reading
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that serializes reading the sub keys on demand
+	 */
+	libcthreads_mutex_t *sub_keys_mutex;
 #endif
 };
 
@@ -106,6 +113,13 @@ int libcreg_key_get_name(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_key_get_name_reference(
+     libcreg_key_t *key,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_key_get_utf8_name_size(
      libcreg_key_t *key,
@@ -132,6 +146,32 @@ int libcreg_key_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_key_get_utf8_path_size(
+     libcreg_key_t *key,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_get_utf8_path(
+     libcreg_key_t *key,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_get_utf16_path_size(
+     libcreg_key_t *key,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_get_utf16_path(
+     libcreg_key_t *key,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_key_get_number_of_values(
      libcreg_key_t *key,
@@ -145,6 +185,12 @@ int libcreg_key_get_value_by_index(
      libcreg_value_t **value,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_key_get_value_cursor(
+     libcreg_key_t *key,
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_key_get_value_by_utf8_name(
      libcreg_key_t *key,
@@ -161,6 +207,10 @@ int libcreg_key_get_value_by_utf16_name(
      libcreg_value_t **value,
      libcerror_error_t **error );
 
+int libcreg_internal_key_read_sub_keys_on_demand(
+     libcreg_internal_key_t *internal_key,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_key_get_number_of_sub_keys(
      libcreg_key_t *key,
@@ -174,6 +224,12 @@ int libcreg_key_get_sub_key_by_index(
      libcreg_key_t **sub_key,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_key_get_sub_key_cursor(
+     libcreg_key_t *key,
+     libcreg_key_cursor_t **sub_key_cursor,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_key_get_sub_key_by_utf8_name(
      libcreg_key_t *key,
@@ -0,0 +1,1830 @@
+/*
+ * Key cursor functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_definitions.h"
+#include "libcreg_data_block.h"
+#include "libcreg_io_handle.h"
+#include "libcreg_key.h"
+#include "libcreg_key_cursor.h"
+#include "libcreg_key_hierarchy_entry.h"
+#include "libcreg_key_name_entry.h"
+#include "libcreg_key_navigation.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_types.h"
+#include "libcreg_value_cursor.h"
+
+/* Creates a key cursor
+ * The cursor iterates the sub keys of the parent key and is initially positioned before the first sub key
+ * Make sure the value key_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_initialize(
+     libcreg_key_cursor_t **key_cursor,
+     libcreg_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     uint32_t parent_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_initialize";
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = memory_allocate_structure(
+	                       libcreg_internal_key_cursor_t );
+
+	if( internal_key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal key cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_key_cursor,
+	     0,
+	     sizeof( libcreg_internal_key_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal key cursor.",
+		 function );
+
+		memory_free(
+		 internal_key_cursor );
+
+		return( -1 );
+	}
+	internal_key_cursor->io_handle         = io_handle;
+	internal_key_cursor->file_io_handle    = file_io_handle;
+	internal_key_cursor->key_navigation    = key_navigation;
+	internal_key_cursor->parent_key_offset = parent_key_offset;
+	internal_key_cursor->sub_key_index     = -1;
+
+	if( libcreg_internal_key_cursor_get_first_sub_key_offset(
+	     internal_key_cursor,
+	     parent_key_offset,
+	     &( internal_key_cursor->first_sub_key_offset ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub key offset of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 parent_key_offset,
+		 parent_key_offset );
+
+		goto on_error;
+	}
+	internal_key_cursor->next_sub_key_offset = internal_key_cursor->first_sub_key_offset;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_key_cursor->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*key_cursor = (libcreg_key_cursor_t *) internal_key_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_key_cursor != NULL )
+	{
+		memory_free(
+		 internal_key_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a key cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_free(
+     libcreg_key_cursor_t **key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_free";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_cursor != NULL )
+	{
+		internal_key_cursor = (libcreg_internal_key_cursor_t *) *key_cursor;
+		*key_cursor         = NULL;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_key_cursor->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcreg_data_block_release_reference(
+		     &( internal_key_cursor->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
+
+			result = -1;
+		}
+		/* The io_handle, file_io_handle and key_navigation references are freed elsewhere
+		 */
+		memory_free(
+		 internal_key_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves the offset of the first sub key of a specific key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_internal_key_cursor_get_first_sub_key_offset(
+     libcreg_internal_key_cursor_t *internal_key_cursor,
+     uint32_t key_offset,
+     uint32_t *first_sub_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	static char *function = "libcreg_internal_key_cursor_get_first_sub_key_offset";
+
+	if( internal_key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+	     internal_key_cursor->key_navigation,
+	     internal_key_cursor->file_io_handle,
+	     (off64_t) key_offset,
+	     &key_hierarchy_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		return( -1 );
+	}
+	*first_sub_key_offset = key_hierarchy_entry.sub_key_offset;
+
+	return( 1 );
+}
+
+/* Reads the next sub key from the sub key chain
+ * Returns 1 if successful, 0 if there are no more sub keys or -1 on error
+ */
+int libcreg_internal_key_cursor_read_next_sub_key(
+     libcreg_internal_key_cursor_t *internal_key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	static char *function                    = "libcreg_internal_key_cursor_read_next_sub_key";
+	uint32_t sub_key_offset                  = 0;
+
+	if( internal_key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	sub_key_offset = internal_key_cursor->next_sub_key_offset;
+
+	internal_key_cursor->sub_key_offset               = 0;
+	internal_key_cursor->sub_key_first_sub_key_offset = 0;
+	internal_key_cursor->key_name_entry               = NULL;
+
+	if( libcreg_data_block_release_reference(
+	     &( internal_key_cursor->data_block ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_key_offset == 0 )
+	 || ( sub_key_offset == 0xffffffffUL ) )
+	{
+		return( 0 );
+	}
+	if( internal_key_cursor->sub_key_index >= ( LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub key index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+	     internal_key_cursor->key_navigation,
+	     internal_key_cursor->file_io_handle,
+	     (off64_t) sub_key_offset,
+	     &key_hierarchy_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_offset,
+		 sub_key_offset );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry.next_key_offset == sub_key_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid next key offset: %" PRIu32 " (0x%08" PRIx32 ") value refers to itself.",
+		 function,
+		 sub_key_offset,
+		 sub_key_offset );
+
+		return( -1 );
+	}
+	internal_key_cursor->next_sub_key_offset          = key_hierarchy_entry.next_key_offset;
+	internal_key_cursor->sub_key_first_sub_key_offset = key_hierarchy_entry.sub_key_offset;
+
+	if( libcreg_key_navigation_get_key_name_entry(
+	     internal_key_cursor->key_navigation,
+	     internal_key_cursor->file_io_handle,
+	     &key_hierarchy_entry,
+	     &data_block,
+	     &key_name_entry,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve key name entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_offset,
+		 sub_key_offset );
+
+		internal_key_cursor->next_sub_key_offset          = 0;
+		internal_key_cursor->sub_key_first_sub_key_offset = 0;
+
+		return( -1 );
+	}
+	internal_key_cursor->sub_key_offset  = sub_key_offset;
+	internal_key_cursor->key_name_entry  = key_name_entry;
+	internal_key_cursor->data_block      = data_block;
+	internal_key_cursor->sub_key_index  += 1;
+
+	return( 1 );
+}
+
+/* Moves the key cursor to the next sub key
+ * Returns 1 if successful, 0 if there are no more sub keys or -1 on error
+ */
+int libcreg_key_cursor_next(
+     libcreg_key_cursor_t *key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_next";
+	int result                                         = 0;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcreg_internal_key_cursor_read_next_sub_key(
+	          internal_key_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read next sub key.",
+		 function );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resets the key cursor to before the first sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_reset(
+     libcreg_key_cursor_t *key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_reset";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_key_cursor->sub_key_offset               = 0;
+	internal_key_cursor->sub_key_first_sub_key_offset = 0;
+	internal_key_cursor->next_sub_key_offset          = internal_key_cursor->first_sub_key_offset;
+	internal_key_cursor->sub_key_index                = -1;
+	internal_key_cursor->key_name_entry               = NULL;
+
+	if( libcreg_data_block_release_reference(
+	     &( internal_key_cursor->data_block ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data block.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the offset of the current sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_offset(
+     libcreg_key_cursor_t *key_cursor,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_offset";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( internal_key_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The offset is relative from the start of the data blocks list
+		 * and points to the start of the corresponding key name entry
+		 */
+		*offset = (off64_t) internal_key_cursor->sub_key_offset + internal_key_cursor->io_handle->data_blocks_list_offset + 4;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the name of the current sub key
+ * The name is codepage encoded and owned by the library, it remains valid
+ * as long as the file is open
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_name_reference(
+     libcreg_key_cursor_t *key_cursor,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_name_reference";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		*string      = NULL;
+		*string_size = 0;
+	}
+	else if( libcreg_key_name_entry_get_name_reference(
+	          internal_key_cursor->key_name_entry,
+	          string,
+	          string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 string size of the name of the current sub key
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_utf8_name_size(
+     libcreg_key_cursor_t *key_cursor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_utf8_name_size";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( internal_key_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		*utf8_string_size = 0;
+	}
+	else if( libcreg_key_name_entry_get_utf8_name_size(
+	          internal_key_cursor->key_name_entry,
+	          utf8_string_size,
+	          internal_key_cursor->io_handle->ascii_codepage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 string value of the name of the current sub key
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_utf8_name(
+     libcreg_key_cursor_t *key_cursor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_utf8_name";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( internal_key_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size < 1 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		utf8_string[ 0 ] = 0;
+	}
+	else if( libcreg_key_name_entry_get_utf8_name(
+	          internal_key_cursor->key_name_entry,
+	          utf8_string,
+	          utf8_string_size,
+	          internal_key_cursor->io_handle->ascii_codepage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 string size of the name of the current sub key
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_utf16_name_size(
+     libcreg_key_cursor_t *key_cursor,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_utf16_name_size";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( internal_key_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		*utf16_string_size = 0;
+	}
+	else if( libcreg_key_name_entry_get_utf16_name_size(
+	          internal_key_cursor->key_name_entry,
+	          utf16_string_size,
+	          internal_key_cursor->io_handle->ascii_codepage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 string value of the name of the current sub key
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_utf16_name(
+     libcreg_key_cursor_t *key_cursor,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_utf16_name";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( internal_key_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_size < 1 )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		utf16_string[ 0 ] = 0;
+	}
+	else if( libcreg_key_name_entry_get_utf16_name(
+	          internal_key_cursor->key_name_entry,
+	          utf16_string,
+	          utf16_string_size,
+	          internal_key_cursor->io_handle->ascii_codepage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of values of the current sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_number_of_values(
+     libcreg_key_cursor_t *key_cursor,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_number_of_values";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_key_cursor->key_name_entry == NULL )
+	{
+		*number_of_values = 0;
+	}
+	else if( libcreg_key_name_entry_get_number_of_entries(
+	          internal_key_cursor->key_name_entry,
+	          number_of_values,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of sub keys of the current sub key
+ * The sub keys are counted by following the sub key chain, no sub key descriptors are created
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_number_of_sub_keys(
+     libcreg_key_cursor_t *key_cursor,
+     int *number_of_sub_keys,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_number_of_sub_keys";
+	uint32_t sub_key_offset                            = 0;
+	int result                                         = 1;
+	int safe_number_of_sub_keys                        = 0;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( number_of_sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub keys.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		sub_key_offset = internal_key_cursor->sub_key_first_sub_key_offset;
+
+		while( ( sub_key_offset != 0 )
+		    && ( sub_key_offset != 0xffffffffUL ) )
+		{
+			if( safe_number_of_sub_keys >= LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of sub keys value out of bounds.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     internal_key_cursor->key_navigation,
+			     internal_key_cursor->file_io_handle,
+			     (off64_t) sub_key_offset,
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 sub_key_offset,
+				 sub_key_offset );
+
+				result = -1;
+
+				break;
+			}
+			if( key_hierarchy_entry.next_key_offset == sub_key_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 sub_key_offset,
+				 sub_key_offset );
+
+				result = -1;
+
+				break;
+			}
+			sub_key_offset = key_hierarchy_entry.next_key_offset;
+
+			safe_number_of_sub_keys++;
+		}
+		if( result == 1 )
+		{
+			*number_of_sub_keys = safe_number_of_sub_keys;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the current sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_sub_key(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_key_t **sub_key,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_sub_key";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( sub_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: sub key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_key_initialize(
+	          sub_key,
+	          internal_key_cursor->io_handle,
+	          internal_key_cursor->file_io_handle,
+	          internal_key_cursor->key_navigation,
+	          internal_key_cursor->sub_key_offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub key.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a key cursor for the sub keys of the current sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_sub_key_cursor(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_key_cursor_t **sub_key_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_sub_key_cursor";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( sub_key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_key_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: sub key cursor already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_key_cursor_initialize(
+	          sub_key_cursor,
+	          internal_key_cursor->io_handle,
+	          internal_key_cursor->file_io_handle,
+	          internal_key_cursor->key_navigation,
+	          internal_key_cursor->sub_key_offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub key cursor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a value cursor for the values of the current sub key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_cursor_get_value_cursor(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_key_cursor_t *internal_key_cursor = NULL;
+	static char *function                              = "libcreg_key_cursor_get_value_cursor";
+	int result                                         = 1;
+
+	if( key_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_cursor = (libcreg_internal_key_cursor_t *) key_cursor;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value cursor already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_key_cursor->sub_key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key cursor - not positioned on a sub key.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_value_cursor_initialize(
+	          value_cursor,
+	          internal_key_cursor->io_handle,
+	          internal_key_cursor->data_block,
+	          internal_key_cursor->key_name_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value cursor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_key_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
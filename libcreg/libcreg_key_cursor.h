@@ -0,0 +1,205 @@
+/*
+ * Key cursor functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_INTERNAL_KEY_CURSOR_H )
+#define _LIBCREG_INTERNAL_KEY_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_extern.h"
+#include "libcreg_io_handle.h"
+#include "libcreg_data_block.h"
+#include "libcreg_key_name_entry.h"
+#include "libcreg_key_navigation.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_internal_key_cursor libcreg_internal_key_cursor_t;
+
+struct libcreg_internal_key_cursor
+{
+	/* The IO handle
+	 */
+	libcreg_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The key navigation
+	 */
+	libcreg_key_navigation_t *key_navigation;
+
+	/* The offset of the parent key
+	 */
+	uint32_t parent_key_offset;
+
+	/* The offset of the first sub key of the parent key
+	 */
+	uint32_t first_sub_key_offset;
+
+	/* The offset of the current sub key or 0 if the cursor is not positioned on a sub key
+	 */
+	uint32_t sub_key_offset;
+
+	/* The offset of the first sub key of the current sub key
+	 */
+	uint32_t sub_key_first_sub_key_offset;
+
+	/* The offset of the next sub key
+	 */
+	uint32_t next_sub_key_offset;
+
+	/* The index of the current sub key
+	 */
+	int sub_key_index;
+
+	/* The key name entry of the current sub key
+	 * The key name entry is owned by the data block of the current sub key
+	 */
+	libcreg_key_name_entry_t *key_name_entry;
+
+	/* The data block of the current sub key
+	 */
+	libcreg_data_block_t *data_block;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libcreg_key_cursor_initialize(
+     libcreg_key_cursor_t **key_cursor,
+     libcreg_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     uint32_t parent_key_offset,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_free(
+     libcreg_key_cursor_t **key_cursor,
+     libcerror_error_t **error );
+
+int libcreg_internal_key_cursor_get_first_sub_key_offset(
+     libcreg_internal_key_cursor_t *internal_key_cursor,
+     uint32_t key_offset,
+     uint32_t *first_sub_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_internal_key_cursor_read_next_sub_key(
+     libcreg_internal_key_cursor_t *internal_key_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_next(
+     libcreg_key_cursor_t *key_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_reset(
+     libcreg_key_cursor_t *key_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_offset(
+     libcreg_key_cursor_t *key_cursor,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_name_reference(
+     libcreg_key_cursor_t *key_cursor,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_utf8_name_size(
+     libcreg_key_cursor_t *key_cursor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_utf8_name(
+     libcreg_key_cursor_t *key_cursor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_utf16_name_size(
+     libcreg_key_cursor_t *key_cursor,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_utf16_name(
+     libcreg_key_cursor_t *key_cursor,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_number_of_values(
+     libcreg_key_cursor_t *key_cursor,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_number_of_sub_keys(
+     libcreg_key_cursor_t *key_cursor,
+     int *number_of_sub_keys,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_sub_key(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_key_t **sub_key,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_sub_key_cursor(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_key_cursor_t **sub_key_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_key_cursor_get_value_cursor(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_INTERNAL_KEY_CURSOR_H ) */
+
@@ -38,6 +38,10 @@ struct libcreg_key_descriptor
 	/* The key offset
 	 */
 	uint32_t key_offset;
+
+	/* The name hash calculated from the key name entry
+	 */
+	uint32_t name_hash;
 };
 
 int libcreg_key_descriptor_initialize(
@@ -0,0 +1,598 @@
+/*
+ * Key hierarchy table functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_key_hierarchy_entry.h"
+#include "libcreg_key_hierarchy_table.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcnotify.h"
+
+#include "creg_key_navigation.h"
+
+/* Creates a key hierarchy table
+ * Make sure the value key_hierarchy_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_hierarchy_table_initialize(
+     libcreg_key_hierarchy_table_t **key_hierarchy_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_hierarchy_table_initialize";
+
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_hierarchy_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key hierarchy table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*key_hierarchy_table = memory_allocate_structure(
+	                        libcreg_key_hierarchy_table_t );
+
+	if( *key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key hierarchy table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_hierarchy_table,
+	     0,
+	     sizeof( libcreg_key_hierarchy_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key hierarchy table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *key_hierarchy_table != NULL )
+	{
+		memory_free(
+		 *key_hierarchy_table );
+
+		*key_hierarchy_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key hierarchy table
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_hierarchy_table_free(
+     libcreg_key_hierarchy_table_t **key_hierarchy_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_hierarchy_table_free";
+
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_hierarchy_table != NULL )
+	{
+		if( ( *key_hierarchy_table )->key_name_entry_numbers != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->key_name_entry_numbers );
+		}
+		if( ( *key_hierarchy_table )->data_block_numbers != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->data_block_numbers );
+		}
+		if( ( *key_hierarchy_table )->next_key_offsets != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->next_key_offsets );
+		}
+		if( ( *key_hierarchy_table )->sub_key_offsets != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->sub_key_offsets );
+		}
+		if( ( *key_hierarchy_table )->parent_key_offsets != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->parent_key_offsets );
+		}
+		if( ( *key_hierarchy_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *key_hierarchy_table )->name_hashes );
+		}
+		memory_free(
+		 *key_hierarchy_table );
+
+		*key_hierarchy_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the key hierarchy table
+ * The data contains the key hierarchy entries data, where a key hierarchy entry
+ * at key offset N is stored at data offset N. Only the entries from the first entry offset
+ * onwards, at multiples of the key hierarchy entry size, are stored in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_hierarchy_table_read_data(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_hierarchy_table_read_data";
+	size_t data_offset    = 0;
+	size_t entries_size   = 0;
+	int entry_index       = 0;
+	int number_of_entries = 0;
+
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_table->name_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key hierarchy table - name hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) first_entry_offset < data_size )
+	{
+		number_of_entries = (int) ( ( data_size - first_entry_offset ) / sizeof( creg_key_hierarchy_entry_t ) );
+	}
+	key_hierarchy_table->first_entry_offset = first_entry_offset;
+	key_hierarchy_table->number_of_entries  = 0;
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( uint32_t ) * (size_t) number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	key_hierarchy_table->name_hashes = (uint32_t *) memory_allocate(
+	                                                 entries_size );
+
+	if( key_hierarchy_table->name_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hashes.",
+		 function );
+
+		goto on_error;
+	}
+	key_hierarchy_table->parent_key_offsets = (uint32_t *) memory_allocate(
+	                                                        entries_size );
+
+	if( key_hierarchy_table->parent_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parent key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	key_hierarchy_table->sub_key_offsets = (uint32_t *) memory_allocate(
+	                                                     entries_size );
+
+	if( key_hierarchy_table->sub_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	key_hierarchy_table->next_key_offsets = (uint32_t *) memory_allocate(
+	                                                      entries_size );
+
+	if( key_hierarchy_table->next_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create next key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	entries_size = sizeof( uint16_t ) * (size_t) number_of_entries;
+
+	key_hierarchy_table->data_block_numbers = (uint16_t *) memory_allocate(
+	                                                        entries_size );
+
+	if( key_hierarchy_table->data_block_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block numbers.",
+		 function );
+
+		goto on_error;
+	}
+	key_hierarchy_table->key_name_entry_numbers = (uint16_t *) memory_allocate(
+	                                                            entries_size );
+
+	if( key_hierarchy_table->key_name_entry_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key name entry numbers.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = (size_t) first_entry_offset;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->name_hash,
+		 key_hierarchy_table->name_hashes[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->parent_key_offset,
+		 key_hierarchy_table->parent_key_offsets[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->sub_key_offset,
+		 key_hierarchy_table->sub_key_offsets[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->next_key_offset,
+		 key_hierarchy_table->next_key_offsets[ entry_index ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->data_block_number,
+		 key_hierarchy_table->data_block_numbers[ entry_index ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (creg_key_hierarchy_entry_t *) &( data[ data_offset ] ) )->key_name_entry_number,
+		 key_hierarchy_table->key_name_entry_numbers[ entry_index ] );
+
+		data_offset += sizeof( creg_key_hierarchy_entry_t );
+	}
+	key_hierarchy_table->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( key_hierarchy_table->key_name_entry_numbers != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->key_name_entry_numbers );
+
+		key_hierarchy_table->key_name_entry_numbers = NULL;
+	}
+	if( key_hierarchy_table->data_block_numbers != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->data_block_numbers );
+
+		key_hierarchy_table->data_block_numbers = NULL;
+	}
+	if( key_hierarchy_table->next_key_offsets != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->next_key_offsets );
+
+		key_hierarchy_table->next_key_offsets = NULL;
+	}
+	if( key_hierarchy_table->sub_key_offsets != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->sub_key_offsets );
+
+		key_hierarchy_table->sub_key_offsets = NULL;
+	}
+	if( key_hierarchy_table->parent_key_offsets != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->parent_key_offsets );
+
+		key_hierarchy_table->parent_key_offsets = NULL;
+	}
+	if( key_hierarchy_table->name_hashes != NULL )
+	{
+		memory_free(
+		 key_hierarchy_table->name_hashes );
+
+		key_hierarchy_table->name_hashes = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the key hierarchy table
+ * The key hierarchy entries data is read with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_hierarchy_table_read_file_io_handle(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t data_size,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libcreg_key_hierarchy_table_read_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading key hierarchy entries at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key hierarchy entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libcreg_key_hierarchy_table_read_data(
+	     key_hierarchy_table,
+	     data,
+	     (size_t) data_size,
+	     first_entry_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key hierarchy table.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key hierarchy entry at a specific key offset
+ * The values of the entry are copied into the key hierarchy entry
+ * Returns 1 if successful, 0 if the key offset is not in the table or -1 on error
+ */
+int libcreg_key_hierarchy_table_get_entry_by_offset(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     uint32_t key_offset,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     libcerror_error_t **error )
+{
+	static char *function        = "libcreg_key_hierarchy_table_get_entry_by_offset";
+	uint32_t relative_key_offset = 0;
+	uint32_t entry_index         = 0;
+
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset < key_hierarchy_table->first_entry_offset )
+	{
+		return( 0 );
+	}
+	relative_key_offset = key_offset - key_hierarchy_table->first_entry_offset;
+
+	if( ( relative_key_offset % sizeof( creg_key_hierarchy_entry_t ) ) != 0 )
+	{
+		return( 0 );
+	}
+	entry_index = relative_key_offset / sizeof( creg_key_hierarchy_entry_t );
+
+	if( entry_index >= (uint32_t) key_hierarchy_table->number_of_entries )
+	{
+		return( 0 );
+	}
+	key_hierarchy_entry->data_offset           = (size_t) key_offset;
+	key_hierarchy_entry->name_hash             = key_hierarchy_table->name_hashes[ entry_index ];
+	key_hierarchy_entry->parent_key_offset     = key_hierarchy_table->parent_key_offsets[ entry_index ];
+	key_hierarchy_entry->sub_key_offset        = key_hierarchy_table->sub_key_offsets[ entry_index ];
+	key_hierarchy_entry->next_key_offset       = key_hierarchy_table->next_key_offsets[ entry_index ];
+	key_hierarchy_entry->data_block_number     = key_hierarchy_table->data_block_numbers[ entry_index ];
+	key_hierarchy_entry->key_name_entry_number = key_hierarchy_table->key_name_entry_numbers[ entry_index ];
+
+	return( 1 );
+}
+
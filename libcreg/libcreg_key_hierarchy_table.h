@@ -0,0 +1,107 @@
+/*
+ * Key hierarchy table functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_KEY_HIERARCHY_TABLE_H )
+#define _LIBCREG_KEY_HIERARCHY_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_key_hierarchy_entry.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_key_hierarchy_table libcreg_key_hierarchy_table_t;
+
+struct libcreg_key_hierarchy_table
+{
+	/* The offset of the first key hierarchy entry
+	 */
+	uint32_t first_entry_offset;
+
+	/* The number of key hierarchy entries
+	 */
+	int number_of_entries;
+
+	/* The name hashes
+	 */
+	uint32_t *name_hashes;
+
+	/* The parent key (hierarchy entry) offsets
+	 */
+	uint32_t *parent_key_offsets;
+
+	/* The sub key (hierarchy entry) offsets
+	 */
+	uint32_t *sub_key_offsets;
+
+	/* The next key (hierarchy entry) offsets
+	 */
+	uint32_t *next_key_offsets;
+
+	/* The data block numbers
+	 */
+	uint16_t *data_block_numbers;
+
+	/* The key name entry numbers
+	 */
+	uint16_t *key_name_entry_numbers;
+};
+
+int libcreg_key_hierarchy_table_initialize(
+     libcreg_key_hierarchy_table_t **key_hierarchy_table,
+     libcerror_error_t **error );
+
+int libcreg_key_hierarchy_table_free(
+     libcreg_key_hierarchy_table_t **key_hierarchy_table,
+     libcerror_error_t **error );
+
+int libcreg_key_hierarchy_table_read_data(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_hierarchy_table_read_file_io_handle(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t data_size,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_hierarchy_table_get_entry_by_offset(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     uint32_t key_offset,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_KEY_HIERARCHY_TABLE_H ) */
+
@@ -40,6 +40,8 @@
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
 #include "libcreg_libuna.h"
+#include "libcreg_name_hash.h"
+#include "libcreg_name_hash_table.h"
 #include "libcreg_value_entry.h"
 
 #include "creg_key_navigation.h"
@@ -179,8 +181,21 @@ int libcreg_key_item_free(
 	}
 	if( *key_item != NULL )
 	{
-		/* The key_name_entry reference is freed elsewhere */
+		/* The key_name_entry reference is freed by releasing the data block
+		 */
+		if( libcreg_data_block_release_reference(
+		     &( ( *key_item )->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
 
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *key_item )->sub_key_descriptors_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_key_descriptor_free,
@@ -195,6 +210,22 @@ int libcreg_key_item_free(
 
 			result = -1;
 		}
+		if( ( *key_item )->sub_key_name_hash_table != NULL )
+		{
+			if( libcreg_name_hash_table_free(
+			     &( ( *key_item )->sub_key_name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub key name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_range_list_free(
 		     &( ( *key_item )->sub_key_range_list ),
 		     NULL,
@@ -227,14 +258,9 @@ int libcreg_key_item_read(
      off64_t key_offset,
      libcerror_error_t **error )
 {
-	libcreg_data_block_t *data_block                   = NULL;
-	libcreg_key_descriptor_t *sub_key_descriptor       = NULL;
-	libcreg_key_hierarchy_entry_t *key_hierarchy_entry = NULL;
-	static char *function                              = "libcreg_key_item_read";
-	off64_t sub_key_offset                             = 0;
-	int entry_index                                    = 0;
-	int recursion_depth                                = 0;
-	int result                                         = 0;
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	static char *function = "libcreg_key_item_read";
 
 	if( key_item == NULL )
 	{
@@ -295,238 +321,59 @@ int libcreg_key_item_read(
 		 function,
 		 key_offset );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( key_hierarchy_entry == NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing key hierarchy entry for offset: %" PRIi64 ".",
+		libcnotify_printf(
+		 "%s: offset\t\t\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
 		 function,
-		 key_offset );
-
-		goto on_error;
-	}
-	if( (int16_t) key_hierarchy_entry->data_block_number >= 0 )
-	{
-		if( libcreg_key_navigation_get_data_block_at_index(
-		     key_navigation,
-		     file_io_handle,
-		     (int) key_hierarchy_entry->data_block_number,
-		     &data_block,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to retrieve data block number: %" PRIu16 ".",
-			 function,
-			 key_hierarchy_entry->data_block_number );
-
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: offset\t\t\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-			 function,
-			 key_hierarchy_entry->data_offset,
-			 key_hierarchy_entry->data_offset );
-
-			libcnotify_printf(
-			 "%s: key name entry number\t\t\t: %" PRIi16 "\n",
-			 function,
-			 (int16_t) key_hierarchy_entry->key_name_entry_number );
-
-			libcnotify_printf(
-			 "%s: data block number\t\t\t: %" PRIi16 "\n",
-			 function,
-			 (int16_t) key_hierarchy_entry->data_block_number );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		 key_hierarchy_entry.data_offset,
+		 key_hierarchy_entry.data_offset );
 
-		if( libcreg_data_block_get_entry_by_identifier(
-		     data_block,
-		     key_hierarchy_entry->key_name_entry_number,
-		     &( key_item->key_name_entry ),
-		     key_navigation->io_handle->ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to retrieve key entry element number: %" PRIu16 ".",
-			 function,
-			 key_hierarchy_entry->key_name_entry_number );
+		libcnotify_printf(
+		 "%s: key name entry number\t\t\t: %" PRIi16 "\n",
+		 function,
+		 (int16_t) key_hierarchy_entry.key_name_entry_number );
 
-			goto on_error;
-		}
-		if( key_item->key_name_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing key name entry: %" PRIu16 ".",
-			 function,
-			 key_hierarchy_entry->key_name_entry_number );
+		libcnotify_printf(
+		 "%s: data block number\t\t\t: %" PRIi16 "\n",
+		 function,
+		 (int16_t) key_hierarchy_entry.data_block_number );
 
-			goto on_error;
-		}
+		libcnotify_printf(
+		 "\n" );
 	}
-	sub_key_offset = key_hierarchy_entry->sub_key_offset;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	while( ( sub_key_offset != 0 )
-	    && ( sub_key_offset != 0xffffffffUL ) )
+	if( libcreg_key_navigation_get_key_name_entry(
+	     key_navigation,
+	     file_io_handle,
+	     &key_hierarchy_entry,
+	     &( key_item->data_block ),
+	     &( key_item->key_name_entry ),
+	     error ) == -1 )
 	{
-		if( recursion_depth > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid recursion depth value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
-		     key_navigation,
-		     file_io_handle,
-		     sub_key_offset,
-		     &key_hierarchy_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 sub_key_offset,
-			 sub_key_offset );
-
-			goto on_error;
-		}
-		if( key_hierarchy_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing key hierarchy entry for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 sub_key_offset,
-			 sub_key_offset );
-
-			goto on_error;
-		}
-		if( libcreg_key_descriptor_initialize(
-		     &sub_key_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub key descriptor.",
-			 function );
-
-			goto on_error;
-		}
-		sub_key_descriptor->key_offset = (uint32_t) sub_key_offset;
-
-		if( libcdata_array_append_entry(
-		     key_item->sub_key_descriptors_array,
-		     &entry_index,
-		     (intptr_t *) sub_key_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sub key descriptor to array.",
-			 function );
-
-			goto on_error;
-		}
-		sub_key_descriptor = NULL;
-
-		if( libcdata_range_list_insert_range(
-		     key_item->sub_key_range_list,
-		     (uint64_t) sub_key_offset,
-		     (uint64_t) sizeof( creg_key_hierarchy_entry_t ),
-		     NULL,
-		     NULL,
-		     NULL,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert sub key navigation record range into range list.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( key_hierarchy_entry->next_key_offset != 0 )
-		 && ( key_hierarchy_entry->next_key_offset != 0xffffffffUL ) )
-		{
-			result = libcdata_range_list_range_has_overlapping_range(
-			          key_item->sub_key_range_list,
-			          (uint64_t) key_hierarchy_entry->next_key_offset,
-			          (uint64_t) sizeof( creg_key_hierarchy_entry_t ),
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if there is an overlapping key navigation record range in the range list.",
-				 function );
-
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid next key navigation record offset: %" PRIu32 " (0x%08" PRIu32 ") value already read.",
-				 function,
-				 key_hierarchy_entry->next_key_offset,
-				 key_hierarchy_entry->next_key_offset );
-
-				goto on_error;
-			}
-		}
-		sub_key_offset = (off64_t) key_hierarchy_entry->next_key_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve key name entry.",
+		 function );
 
-		recursion_depth++;
+		return( -1 );
 	}
-	return( 1 );
+	key_item->next_sub_key_offset = key_hierarchy_entry.sub_key_offset;
 
-on_error:
-	if( sub_key_descriptor != NULL )
+	/* The sub key descriptors are read on demand
+	 */
+	if( ( key_item->next_sub_key_offset == 0 )
+	 || ( key_item->next_sub_key_offset == 0xffffffffUL ) )
 	{
-		libcreg_key_descriptor_free(
-		 &sub_key_descriptor,
-		 NULL );
+		key_item->item_flags |= LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ;
 	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Determines if the key item is corrupted
@@ -681,6 +528,77 @@ int libcreg_key_item_get_name(
 	return( 1 );
 }
 
+/* Retrieves a reference to the key name
+ * The name is owned by the key name entry and is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_item_get_name_reference(
+     libcreg_key_item_t *key_item,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_item_get_name_reference";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->key_name_entry == NULL )
+	{
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid name.",
+			 function );
+
+			return( -1 );
+		}
+		if( name_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid name size.",
+			 function );
+
+			return( -1 );
+		}
+		*name      = NULL;
+		*name_size = 0;
+	}
+	else
+	{
+		if( libcreg_key_name_entry_get_name_reference(
+		     key_item->key_name_entry,
+		     name,
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name reference.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the UTF-8 string size of the key name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -1054,14 +972,11 @@ int libcreg_key_item_get_value_by_utf8_name(
      libcreg_value_entry_t **value_entry,
      libcerror_error_t **error )
 {
-	libcreg_value_entry_t *safe_value_entry      = NULL;
-	static char *function                        = "libcreg_key_item_get_value_by_utf8_name";
-	libuna_unicode_character_t unicode_character = 0;
-	size_t utf8_string_index                     = 0;
-	uint32_t name_hash                           = 0;
-	int number_of_values                         = 0;
-	int result                                   = 0;
-	int value_index                              = 0;
+	libcreg_value_entry_t *safe_value_entry = NULL;
+	static char *function                   = "libcreg_key_item_get_value_by_utf8_name";
+	int number_of_values                    = 0;
+	int result                              = 0;
+	int value_index                         = 0;
 
 	if( key_item == NULL )
 	{
@@ -1126,27 +1041,31 @@ int libcreg_key_item_get_value_by_utf8_name(
 	{
 		return( 0 );
 	}
-	while( utf8_string_index < utf8_string_length )
+	if( utf8_string != NULL )
 	{
-		if( libuna_unicode_character_copy_from_utf8(
-		     &unicode_character,
-		     utf8_string,
-		     utf8_string_length,
-		     &utf8_string_index,
-		     error ) != 1 )
+		result = libcreg_key_name_entry_get_entry_by_utf8_name(
+		          key_item->key_name_entry,
+		          utf8_string,
+		          utf8_string_length,
+		          ascii_codepage,
+		          value_entry,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry by UTF-8 name.",
 			 function );
 
 			return( -1 );
 		}
-		name_hash *= 37;
-		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+		return( result );
 	}
+	/* The default value is the value without a name
+	 */
 	for( value_index = 0;
 	     value_index < number_of_values;
 	     value_index++ )
@@ -1181,50 +1100,12 @@ int libcreg_key_item_get_value_by_utf8_name(
 		}
 		if( safe_value_entry->name == NULL )
 		{
-			if( ( utf8_string == NULL )
-			 && ( utf8_string_length == 0 ) )
-			{
-				result = 1;
-			}
-		}
-		else if( utf8_string == NULL )
-		{
-			continue;
-		}
-		else
-		{
-			result = libcreg_value_entry_compare_name_with_utf8_string(
-				  safe_value_entry,
-				  name_hash,
-				  utf8_string,
-				  utf8_string_length,
-				  ascii_codepage,
-				  error );
+			*value_entry = safe_value_entry;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare value name with UTF-8 string.",
-				 function );
-
-				return( -1 );
-			}
+			return( 1 );
 		}
-		if( result != 0 )
-		{
-			break;
-		}
-	}
-	if( value_index >= number_of_values )
-	{
-		return( 0 );
 	}
-	*value_entry = safe_value_entry;
-
-	return( 1 );
+	return( 0 );
 }
 
 /* Retrieves the value entry for the specific UTF-16 encoded name
@@ -1239,14 +1120,11 @@ int libcreg_key_item_get_value_by_utf16_name(
      libcreg_value_entry_t **value_entry,
      libcerror_error_t **error )
 {
-	libcreg_value_entry_t *safe_value_entry      = NULL;
-	static char *function                        = "libcreg_key_item_get_value_by_utf16_name";
-	libuna_unicode_character_t unicode_character = 0;
-	size_t utf16_string_index                    = 0;
-	uint32_t name_hash                           = 0;
-	int number_of_values                         = 0;
-	int result                                   = 0;
-	int value_index                              = 0;
+	libcreg_value_entry_t *safe_value_entry = NULL;
+	static char *function                   = "libcreg_key_item_get_value_by_utf16_name";
+	int number_of_values                    = 0;
+	int result                              = 0;
+	int value_index                         = 0;
 
 	if( key_item == NULL )
 	{
@@ -1311,27 +1189,31 @@ int libcreg_key_item_get_value_by_utf16_name(
 	{
 		return( 0 );
 	}
-	while( utf16_string_index < utf16_string_length )
+	if( utf16_string != NULL )
 	{
-		if( libuna_unicode_character_copy_from_utf16(
-		     &unicode_character,
-		     utf16_string,
-		     utf16_string_length,
-		     &utf16_string_index,
-		     error ) != 1 )
+		result = libcreg_key_name_entry_get_entry_by_utf16_name(
+		          key_item->key_name_entry,
+		          utf16_string,
+		          utf16_string_length,
+		          ascii_codepage,
+		          value_entry,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry by UTF-16 name.",
 			 function );
 
 			return( -1 );
 		}
-		name_hash *= 37;
-		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+		return( result );
 	}
+	/* The default value is the value without a name
+	 */
 	for( value_index = 0;
 	     value_index < number_of_values;
 	     value_index++ )
@@ -1366,61 +1248,33 @@ int libcreg_key_item_get_value_by_utf16_name(
 		}
 		if( safe_value_entry->name == NULL )
 		{
-			if( ( utf16_string == NULL )
-			 && ( utf16_string_length == 0 ) )
-			{
-				result = 1;
-			}
-		}
-		else if( utf16_string == NULL )
-		{
-			continue;
-		}
-		else
-		{
-			result = libcreg_value_entry_compare_name_with_utf16_string(
-				  safe_value_entry,
-				  name_hash,
-				  utf16_string,
-				  utf16_string_length,
-				  ascii_codepage,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare value name with UTF-8 string.",
-				 function );
+			*value_entry = safe_value_entry;
 
-				return( -1 );
-			}
-		}
-		if( result != 0 )
-		{
-			break;
+			return( 1 );
 		}
 	}
-	if( value_index >= number_of_values )
-	{
-		return( 0 );
-	}
-	*value_entry = safe_value_entry;
-
-	return( 1 );
+	return( 0 );
 }
 
-/* Retrieves the number of sub key descriptors
- * Returns 1 if successful or -1 on error
+/* Reads the next sub key descriptor from the sub key chain
+ * Returns 1 if successful, 0 if all sub key descriptors have been read or -1 on error
  */
-int libcreg_key_item_get_number_of_sub_key_descriptors(
+int libcreg_key_item_read_next_sub_key_descriptor(
      libcreg_key_item_t *key_item,
-     int *number_of_sub_key_descriptors,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
      libcerror_error_t **error )
 {
-	static char *function = "libcreg_key_item_get_number_of_sub_key_descriptors";
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_data_block_t *data_block             = NULL;
+	libcreg_key_descriptor_t *sub_key_descriptor = NULL;
+	libcreg_key_name_entry_t *key_name_entry     = NULL;
+	static char *function                        = "libcreg_key_item_read_next_sub_key_descriptor";
+	uint32_t sub_key_offset                      = 0;
+	int entry_index                              = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
 
 	if( key_item == NULL )
 	{
@@ -1433,9 +1287,13 @@ int libcreg_key_item_get_number_of_sub_key_descriptors(
 
 		return( -1 );
 	}
+	if( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) != 0 )
+	{
+		return( 0 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     key_item->sub_key_descriptors_array,
-	     number_of_sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1445,240 +1303,214 @@ int libcreg_key_item_get_number_of_sub_key_descriptors(
 		 "%s: unable to retrieve number of sub key descriptors from array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific sub key descriptor
- * Returns 1 if successful or -1 on error
- */
-int libcreg_key_item_get_sub_key_descriptor_by_index(
-     libcreg_key_item_t *key_item,
-     int sub_key_descriptor_index,
-     libcreg_key_descriptor_t **sub_key_descriptor,
-     libcerror_error_t **error )
-{
-	static char *function = "libcreg_key_item_get_sub_key_descriptor_by_index";
-
-	if( key_item == NULL )
+	if( number_of_sub_key_descriptors > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     key_item->sub_key_descriptors_array,
-             sub_key_descriptor_index,
-	     (intptr_t **) sub_key_descriptor,
+	sub_key_offset = key_item->next_sub_key_offset;
+
+	if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+	     key_navigation,
+	     file_io_handle,
+	     (off64_t) sub_key_offset,
+	     &key_hierarchy_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub key descriptor: %d from array.",
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
 		 function,
-		 sub_key_descriptor_index );
+		 sub_key_offset,
+		 sub_key_offset );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
-
-/* Retrieves the sub key descriptor for the specific UTF-8 encoded name
- * Returns 1 if successful, 0 if no such value or -1 on error
- */
-int libcreg_key_item_get_sub_key_descriptor_by_utf8_name(
-     libcreg_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libcreg_key_navigation_t *key_navigation,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     int ascii_codepage,
-     libcreg_key_descriptor_t **sub_key_descriptor,
-     libcerror_error_t **error )
-{
-	libcreg_key_descriptor_t *safe_sub_key_descriptor = NULL;
-	libcreg_key_item_t *sub_key_item                  = NULL;
-	static char *function                             = "libcreg_key_item_get_sub_key_descriptor_by_utf8_name";
-	int number_of_sub_key_descriptors                 = 0;
-	int result                                        = 0;
-	int sub_key_descriptor_index                      = 0;
-
-	if( key_item == NULL )
+	if( libcreg_key_descriptor_initialize(
+	     &sub_key_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub key descriptor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*sub_key_descriptor = NULL;
+	sub_key_descriptor->key_offset = sub_key_offset;
 
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors_array,
-	     &number_of_sub_key_descriptors,
-	     error ) != 1 )
+	/* The name hash stored in the key hierarchy entry is not guaranteed to be correct,
+	 * hence the name hash calculated from the key name entry is used
+	 */
+	result = libcreg_key_navigation_get_key_name_entry(
+	          key_navigation,
+	          file_io_handle,
+	          &key_hierarchy_entry,
+	          &data_block,
+	          &key_name_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from sub key descriptors array.",
-		 function );
+		 "%s: unable to retrieve key name entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_offset,
+		 sub_key_offset );
 
 		goto on_error;
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
+	else if( result != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     key_item->sub_key_descriptors_array,
-		     sub_key_descriptor_index,
-		     (intptr_t **) &safe_sub_key_descriptor,
+		sub_key_descriptor->name_hash = key_name_entry->name_hash;
+
+		if( libcreg_data_block_release_reference(
+		     &data_block,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key descriptor: %d from array.",
-			 function,
-			 sub_key_descriptor_index );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
 
 			goto on_error;
 		}
-		if( safe_sub_key_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub key descriptor: %d.",
-			 function,
-			 sub_key_descriptor_index );
+	}
+	if( libcdata_array_append_entry(
+	     key_item->sub_key_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) sub_key_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub key descriptor to array.",
+		 function );
 
-			goto on_error;
-		}
-		if( libcreg_key_item_initialize(
-		     &sub_key_item,
-		     error ) != 1 )
+		goto on_error;
+	}
+	sub_key_descriptor = NULL;
+
+	if( libcdata_range_list_insert_range(
+	     key_item->sub_key_range_list,
+	     (uint64_t) sub_key_offset,
+	     (uint64_t) sizeof( creg_key_hierarchy_entry_t ),
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert sub key navigation record range into range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( key_hierarchy_entry.next_key_offset != 0 )
+	 && ( key_hierarchy_entry.next_key_offset != 0xffffffffUL ) )
+	{
+		result = libcdata_range_list_range_has_overlapping_range(
+		          key_item->sub_key_range_list,
+		          (uint64_t) key_hierarchy_entry.next_key_offset,
+		          (uint64_t) sizeof( creg_key_hierarchy_entry_t ),
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub key item.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if there is an overlapping key navigation record range in the range list.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcreg_key_item_read(
-		     sub_key_item,
-		     file_io_handle,
-		     key_navigation,
-		     safe_sub_key_descriptor->key_offset,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next key navigation record offset: %" PRIu32 " (0x%08" PRIu32 ") value already read.",
 			 function,
-			 safe_sub_key_descriptor->key_offset,
-			 safe_sub_key_descriptor->key_offset );
+			 key_hierarchy_entry.next_key_offset,
+			 key_hierarchy_entry.next_key_offset );
 
 			goto on_error;
 		}
-/* TODO remove or pass name_hash */
-		result = libcreg_key_name_entry_compare_name_with_utf8_string(
-		          sub_key_item->key_name_entry,
-		          0,
-		          utf8_string,
-		          utf8_string_length,
-		          ascii_codepage,
-		          error );
+	}
+	key_item->next_sub_key_offset = key_hierarchy_entry.next_key_offset;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-8 string.",
-			 function );
+	if( ( key_item->next_sub_key_offset == 0 )
+	 || ( key_item->next_sub_key_offset == 0xffffffffUL ) )
+	{
+		key_item->item_flags |= LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ;
 
-			goto on_error;
-		}
-		if( libcreg_key_item_free(
-		     &sub_key_item,
+		if( libcreg_key_item_build_sub_key_name_hash_table(
+		     key_item,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub key item.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build sub key name hash table.",
 			 function );
 
 			goto on_error;
 		}
-		if( result != 0 )
-		{
-			break;
-		}
 	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
-
 	return( 1 );
 
 on_error:
-	if( sub_key_item != NULL )
+	if( data_block != NULL )
 	{
-		libcreg_key_item_free(
-		 &sub_key_item,
+		libcreg_data_block_release_reference(
+		 &data_block,
+		 NULL );
+	}
+	if( sub_key_descriptor != NULL )
+	{
+		libcreg_key_descriptor_free(
+		 &sub_key_descriptor,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the sub key descriptor for the specific UTF-16 encoded name
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Retrieves the number of sub key descriptors if it has been determined before
+ * Unlike libcreg_key_item_get_number_of_sub_key_descriptors this function does not modify the key item
+ * Returns 1 if successful, 0 if not yet determined or -1 on error
  */
-int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
+int libcreg_key_item_get_cached_number_of_sub_key_descriptors(
      libcreg_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libcreg_key_navigation_t *key_navigation,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     int ascii_codepage,
-     libcreg_key_descriptor_t **sub_key_descriptor,
+     int *number_of_sub_key_descriptors,
      libcerror_error_t **error )
 {
-	libcreg_key_descriptor_t *safe_sub_key_descriptor = NULL;
-	libcreg_key_item_t *sub_key_item                  = NULL;
-	static char *function                             = "libcreg_key_item_get_sub_key_descriptor_by_utf16_name";
-	int number_of_sub_key_descriptors                 = 0;
-	int result                                        = 0;
-	int sub_key_descriptor_index                      = 0;
+	static char *function = "libcreg_key_item_get_cached_number_of_sub_key_descriptors";
 
 	if( key_item == NULL )
 	{
@@ -1691,29 +1523,552 @@ int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
 
 		return( -1 );
 	}
-	*sub_key_descriptor = NULL;
-
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors_array,
-	     &number_of_sub_key_descriptors,
-	     error ) != 1 )
+	if( number_of_sub_key_descriptors == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from sub key descriptors array.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub key descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->item_flags & LIBCREG_ITEM_FLAG_NUMBER_OF_SUB_KEYS_SET ) == 0 )
+	{
+		return( 0 );
+	}
+	*number_of_sub_key_descriptors = key_item->number_of_sub_keys;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub key descriptors
+ * The sub key chain is followed without creating sub key descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_item_get_number_of_sub_key_descriptors(
+     libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     int *number_of_sub_key_descriptors,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	static char *function   = "libcreg_key_item_get_number_of_sub_key_descriptors";
+	uint32_t sub_key_offset = 0;
+	int number_of_sub_keys  = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_key_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub key descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->item_flags & LIBCREG_ITEM_FLAG_NUMBER_OF_SUB_KEYS_SET ) == 0 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     key_item->sub_key_descriptors_array,
+		     &number_of_sub_keys,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub key descriptors from array.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 )
+		{
+			sub_key_offset = key_item->next_sub_key_offset;
+
+			while( ( sub_key_offset != 0 )
+			    && ( sub_key_offset != 0xffffffffUL ) )
+			{
+				if( number_of_sub_keys > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid recursion depth value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+				     key_navigation,
+				     file_io_handle,
+				     (off64_t) sub_key_offset,
+				     &key_hierarchy_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					return( -1 );
+				}
+				sub_key_offset = key_hierarchy_entry.next_key_offset;
+
+				number_of_sub_keys++;
+			}
+		}
+		key_item->number_of_sub_keys = number_of_sub_keys;
+		key_item->item_flags        |= LIBCREG_ITEM_FLAG_NUMBER_OF_SUB_KEYS_SET;
+	}
+	*number_of_sub_key_descriptors = key_item->number_of_sub_keys;
+
+	return( 1 );
+}
+
+/* Retrieves a specific sub key descriptor
+ * The sub key chain is read up to the sub key descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_item_get_sub_key_descriptor_by_index(
+     libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     int sub_key_descriptor_index,
+     libcreg_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcreg_key_item_get_sub_key_descriptor_by_index";
+	int number_of_sub_key_descriptors = 0;
+	int result                        = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_descriptor_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub key descriptor index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors_array,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub key descriptors from array.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_sub_key_descriptors <= sub_key_descriptor_index )
+	{
+		result = libcreg_key_item_read_next_sub_key_descriptor(
+		          key_item,
+		          file_io_handle,
+		          key_navigation,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub key descriptor: %d.",
+			 function,
+			 number_of_sub_key_descriptors );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		number_of_sub_key_descriptors++;
+	}
+	if( libcdata_array_get_entry_by_index(
+	     key_item->sub_key_descriptors_array,
+	     sub_key_descriptor_index,
+	     (intptr_t **) sub_key_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key descriptor: %d from array.",
+		 function,
+		 sub_key_descriptor_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the sub key name hash table
+ * All the sub key descriptors must have been read
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_item_build_sub_key_name_hash_table(
+     libcreg_key_item_t *key_item,
+     libcerror_error_t **error )
+{
+	libcreg_key_descriptor_t *sub_key_descriptor = NULL;
+	static char *function                        = "libcreg_key_item_build_sub_key_name_hash_table";
+	int number_of_sub_key_descriptors            = 0;
+	int sub_key_descriptor_index                 = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->sub_key_name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item - sub key name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - sub key descriptors have not been read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors_array,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_name_hash_table_initialize(
+	     &( key_item->sub_key_name_hash_table ),
+	     number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub key name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors_array,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( libcreg_name_hash_table_insert_entry(
+		     key_item->sub_key_name_hash_table,
+		     sub_key_descriptor->name_hash,
+		     sub_key_descriptor_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub key descriptor: %d into name hash table.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( key_item->sub_key_name_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &( key_item->sub_key_name_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the sub key descriptor for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcreg_key_item_get_sub_key_descriptor_by_utf8_name(
+     libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcreg_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_key_descriptor_t *safe_sub_key_descriptor = NULL;
+	static char *function                             = "libcreg_key_item_get_sub_key_descriptor_by_utf8_name";
+	uint32_t name_hash                                = 0;
+	int number_of_sub_key_descriptors                 = 0;
+	int probe_index                                   = 0;
+	int result                                        = 0;
+	int sub_key_descriptor_index                      = 0;
+	int use_name_hash_table                           = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_key_descriptor = NULL;
+
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		name_hash = 0;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors_array,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name hash table contains the name hashes calculated from the key name entries
+	 * and is built when all the sub key descriptors have been read
+	 */
+	if( name_hash != 0 )
+	{
+		while( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 )
+		{
+			result = libcreg_key_item_read_next_sub_key_descriptor(
+			          key_item,
+			          file_io_handle,
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub key descriptor: %d.",
+				 function,
+				 number_of_sub_key_descriptors );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			number_of_sub_key_descriptors++;
+		}
+		/* Without sub key descriptors no name hash table is built
+		 */
+		if( key_item->sub_key_name_hash_table != NULL )
+		{
+			use_name_hash_table = 1;
+		}
+	}
+	/* Without the name hash table the sub key descriptors are compared in order
+	 * and the sub key chain is only read up to the matching sub key
+	 */
+	while( ( use_name_hash_table != 0 )
+	    || ( sub_key_descriptor_index < number_of_sub_key_descriptors )
+	    || ( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 ) )
+	{
+		if( use_name_hash_table != 0 )
+		{
+			result = libcreg_name_hash_table_get_next_entry_index(
+			          key_item->sub_key_name_hash_table,
+			          name_hash,
+			          &probe_index,
+			          &sub_key_descriptor_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next sub key descriptor index from name hash table.",
+				 function );
 
-		goto on_error;
-	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
-	{
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		else if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
+		{
+			result = libcreg_key_item_read_next_sub_key_descriptor(
+			          key_item,
+			          file_io_handle,
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub key descriptor: %d.",
+				 function,
+				 sub_key_descriptor_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			number_of_sub_key_descriptors++;
+		}
 		if( libcdata_array_get_entry_by_index(
 		     key_item->sub_key_descriptors_array,
 		     sub_key_descriptor_index,
@@ -1728,7 +2083,7 @@ int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
 			 function,
 			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( safe_sub_key_descriptor == NULL )
 		{
@@ -1740,42 +2095,303 @@ int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
 			 function,
 			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libcreg_key_item_initialize(
-		     &sub_key_item,
+		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+		     key_navigation,
+		     file_io_handle,
+		     (off64_t) safe_sub_key_descriptor->key_offset,
+		     &key_hierarchy_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub key item.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 safe_sub_key_descriptor->key_offset,
+			 safe_sub_key_descriptor->key_offset );
+
+			return( -1 );
+		}
+		result = libcreg_key_navigation_compare_key_name_with_utf8_string(
+		          key_navigation,
+		          file_io_handle,
+		          &key_hierarchy_entry,
+		          name_hash,
+		          0,
+		          utf8_string,
+		          utf8_string_length,
+		          ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub key name with UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libcreg_key_item_read(
-		     sub_key_item,
-		     file_io_handle,
+		else if( result != 0 )
+		{
+			*sub_key_descriptor = safe_sub_key_descriptor;
+
+			return( 1 );
+		}
+		if( use_name_hash_table == 0 )
+		{
+			sub_key_descriptor_index++;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the sub key descriptor for the specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
+     libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcreg_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_key_descriptor_t *safe_sub_key_descriptor = NULL;
+	static char *function                             = "libcreg_key_item_get_sub_key_descriptor_by_utf16_name";
+	uint32_t name_hash                                = 0;
+	int number_of_sub_key_descriptors                 = 0;
+	int probe_index                                   = 0;
+	int result                                        = 0;
+	int sub_key_descriptor_index                      = 0;
+	int use_name_hash_table                           = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_key_descriptor = NULL;
+
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		name_hash = 0;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors_array,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name hash table contains the name hashes calculated from the key name entries
+	 * and is built when all the sub key descriptors have been read
+	 */
+	if( name_hash != 0 )
+	{
+		while( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 )
+		{
+			result = libcreg_key_item_read_next_sub_key_descriptor(
+			          key_item,
+			          file_io_handle,
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub key descriptor: %d.",
+				 function,
+				 number_of_sub_key_descriptors );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			number_of_sub_key_descriptors++;
+		}
+		/* Without sub key descriptors no name hash table is built
+		 */
+		if( key_item->sub_key_name_hash_table != NULL )
+		{
+			use_name_hash_table = 1;
+		}
+	}
+	/* Without the name hash table the sub key descriptors are compared in order
+	 * and the sub key chain is only read up to the matching sub key
+	 */
+	while( ( use_name_hash_table != 0 )
+	    || ( sub_key_descriptor_index < number_of_sub_key_descriptors )
+	    || ( ( key_item->item_flags & LIBCREG_ITEM_FLAG_SUB_KEY_DESCRIPTORS_READ ) == 0 ) )
+	{
+		if( use_name_hash_table != 0 )
+		{
+			result = libcreg_name_hash_table_get_next_entry_index(
+			          key_item->sub_key_name_hash_table,
+			          name_hash,
+			          &probe_index,
+			          &sub_key_descriptor_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next sub key descriptor index from name hash table.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		else if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
+		{
+			result = libcreg_key_item_read_next_sub_key_descriptor(
+			          key_item,
+			          file_io_handle,
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub key descriptor: %d.",
+				 function,
+				 sub_key_descriptor_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			number_of_sub_key_descriptors++;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors_array,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		if( safe_sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub key descriptor: %d.",
+			 function,
+			 sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
 		     key_navigation,
-		     safe_sub_key_descriptor->key_offset,
+		     file_io_handle,
+		     (off64_t) safe_sub_key_descriptor->key_offset,
+		     &key_hierarchy_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
 			 function,
 			 safe_sub_key_descriptor->key_offset,
 			 safe_sub_key_descriptor->key_offset );
 
-			goto on_error;
+			return( -1 );
 		}
-/* TODO remove or pass name_hash */
-		result = libcreg_key_name_entry_compare_name_with_utf16_string(
-		          sub_key_item->key_name_entry,
+		result = libcreg_key_navigation_compare_key_name_with_utf16_string(
+		          key_navigation,
+		          file_io_handle,
+		          &key_hierarchy_entry,
+		          name_hash,
 		          0,
 		          utf16_string,
 		          utf16_string_length,
@@ -1788,44 +2404,23 @@ int libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-16 string.",
+			 "%s: unable to compare sub key name with UTF-16 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libcreg_key_item_free(
-		     &sub_key_item,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub key item.",
-			 function );
+			*sub_key_descriptor = safe_sub_key_descriptor;
 
-			goto on_error;
+			return( 1 );
 		}
-		if( result != 0 )
+		if( use_name_hash_table == 0 )
 		{
-			break;
+			sub_key_descriptor_index++;
 		}
 	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
-
-	return( 1 );
-
-on_error:
-	if( sub_key_item != NULL )
-	{
-		libcreg_key_item_free(
-		 &sub_key_item,
-		 NULL );
-	}
-	return( -1 );
+	return( 0 );
 }
 
+
@@ -25,12 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcreg_data_block.h"
 #include "libcreg_key_descriptor.h"
 #include "libcreg_key_name_entry.h"
 #include "libcreg_key_navigation.h"
 #include "libcreg_libbfio.h"
 #include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
+#include "libcreg_name_hash_table.h"
 #include "libcreg_value_entry.h"
 
 #if defined( __cplusplus )
@@ -45,14 +47,31 @@ struct libcreg_key_item
 	 */
 	libcreg_key_name_entry_t *key_name_entry;
 
+	/* The data block that contains the key name entry
+	 */
+	libcreg_data_block_t *data_block;
+
 	/* The sub key descriptors array
 	 */
 	libcdata_array_t *sub_key_descriptors_array;
 
+	/* The sub key name hash table
+	 * The table is built when all the sub key descriptors have been read
+	 */
+	libcreg_name_hash_table_t *sub_key_name_hash_table;
+
 	/* The sub key range list
 	 */
 	libcdata_range_list_t *sub_key_range_list;
 
+	/* The offset of the next sub key key hierarchy entry to read
+	 */
+	uint32_t next_sub_key_offset;
+
+	/* The number of sub keys
+	 */
+	int number_of_sub_keys;
+
 	/* Various item flags
 	 */
 	uint8_t item_flags;
@@ -88,6 +107,12 @@ int libcreg_key_item_get_name(
      size_t name_size,
      libcerror_error_t **error );
 
+int libcreg_key_item_get_name_reference(
+     libcreg_key_item_t *key_item,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
 int libcreg_key_item_get_utf8_name_size(
      libcreg_key_item_t *key_item,
      size_t *utf8_string_size,
@@ -141,17 +166,36 @@ int libcreg_key_item_get_value_by_utf16_name(
      libcreg_value_entry_t **value_entry,
      libcerror_error_t **error );
 
+int libcreg_key_item_read_next_sub_key_descriptor(
+     libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error );
+
+int libcreg_key_item_get_cached_number_of_sub_key_descriptors(
+     libcreg_key_item_t *key_item,
+     int *number_of_sub_key_descriptors,
+     libcerror_error_t **error );
+
 int libcreg_key_item_get_number_of_sub_key_descriptors(
      libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
      int *number_of_sub_key_descriptors,
      libcerror_error_t **error );
 
 int libcreg_key_item_get_sub_key_descriptor_by_index(
      libcreg_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_navigation_t *key_navigation,
      int sub_key_descriptor_index,
      libcreg_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error );
 
+int libcreg_key_item_build_sub_key_name_hash_table(
+     libcreg_key_item_t *key_item,
+     libcerror_error_t **error );
+
 int libcreg_key_item_get_sub_key_descriptor_by_utf8_name(
      libcreg_key_item_t *key_item,
      libbfio_handle_t *file_io_handle,
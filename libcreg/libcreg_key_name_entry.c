@@ -29,11 +29,16 @@
 #endif
 
 #include "libcreg_debug.h"
+#include "libcreg_definitions.h"
+#include "libcreg_folded_name.h"
 #include "libcreg_key_name_entry.h"
 #include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
+#include "libcreg_libcthreads.h"
 #include "libcreg_libuna.h"
+#include "libcreg_name_hash.h"
+#include "libcreg_name_hash_table.h"
 #include "libcreg_unused.h"
 #include "libcreg_value_entry.h"
 
@@ -154,11 +159,17 @@ int libcreg_key_name_entry_free(
 	}
 	if( *key_name_entry != NULL )
 	{
-		if( ( *key_name_entry )->name != NULL )
+		if( ( ( ( *key_name_entry )->flags & LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+		 && ( ( *key_name_entry )->name != NULL ) )
 		{
 			memory_free(
 			 ( *key_name_entry )->name );
 		}
+		if( ( *key_name_entry )->folded_name != NULL )
+		{
+			memory_free(
+			 ( *key_name_entry )->folded_name );
+		}
 		if( libcdata_array_free(
 		     &( ( *key_name_entry )->entries_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_value_entry_free,
@@ -173,6 +184,22 @@ int libcreg_key_name_entry_free(
 
 			result = -1;
 		}
+		if( ( *key_name_entry )->value_name_hash_table != NULL )
+		{
+			if( libcreg_name_hash_table_free(
+			     &( ( *key_name_entry )->value_name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *key_name_entry );
 
@@ -381,35 +408,71 @@ int libcreg_key_name_entry_read_data(
 
 			goto on_error;
 		}
-		key_name_entry->name = (uint8_t *) memory_allocate(
-		                                    sizeof( uint8_t ) * (size_t) key_name_entry->name_size );
+		if( ( key_name_entry->flags & LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA ) != 0 )
+		{
+			key_name_entry->name = (uint8_t *) &( data[ data_offset ] );
+		}
+		else
+		{
+			key_name_entry->name = (uint8_t *) memory_allocate(
+			                                    sizeof( uint8_t ) * (size_t) key_name_entry->name_size );
 
-		if( key_name_entry->name == NULL )
+			if( key_name_entry->name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     key_name_entry->name,
+			     &( data[ data_offset ] ),
+			     (size_t) key_name_entry->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcreg_name_hash_calculate_from_byte_stream(
+		     &( key_name_entry->name_hash ),
+		     key_name_entry->name,
+		     (size_t) key_name_entry->name_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate name hash.",
 			 function );
 
 			goto on_error;
 		}
-		if( memory_copy(
+		if( libcreg_folded_name_initialize(
+		     &( key_name_entry->folded_name ),
 		     key_name_entry->name,
-		     &( data[ data_offset ] ),
-		     (size_t) key_name_entry->name_size ) == NULL )
+		     (size_t) key_name_entry->name_size,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create folded name.",
 			 function );
 
 			goto on_error;
 		}
-		key_name_entry->name_hash = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -462,23 +525,38 @@ int libcreg_key_name_entry_read_data(
 		 0 );
 	}
 #endif
-	if( libcreg_key_name_entry_read_values(
-	     key_name_entry,
-	     number_of_values,
-	     key_name_entry->offset + data_offset,
-	     &( data[ data_offset ] ),
-	     value_entries_data_size,
-	     ascii_codepage,
-	     error ) != 1 )
+	key_name_entry->number_of_values     = number_of_values;
+	key_name_entry->value_entries_offset = key_name_entry->offset + (uint32_t) data_offset;
+	key_name_entry->ascii_codepage       = ascii_codepage;
+
+	/* If the data is referenced the values are read on first access
+	 */
+	if( ( key_name_entry->flags & LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read value entries.",
-		 function );
+		key_name_entry->value_entries_data      = &( data[ data_offset ] );
+		key_name_entry->value_entries_data_size = value_entries_data_size;
+	}
+	else
+	{
+		if( libcreg_key_name_entry_read_values(
+		     key_name_entry,
+		     number_of_values,
+		     key_name_entry->value_entries_offset,
+		     &( data[ data_offset ] ),
+		     value_entries_data_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value entries.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		key_name_entry->values_read = 1;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -498,14 +576,25 @@ int libcreg_key_name_entry_read_data(
 	return( 1 );
 
 on_error:
-	if( key_name_entry->name != NULL )
+	if( ( ( key_name_entry->flags & LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+	 && ( key_name_entry->name != NULL ) )
 	{
 		memory_free(
 		 key_name_entry->name );
+	}
+	key_name_entry->name = NULL;
+
+	if( key_name_entry->folded_name != NULL )
+	{
+		memory_free(
+		 key_name_entry->folded_name );
 
-		key_name_entry->name = NULL;
+		key_name_entry->folded_name = NULL;
 	}
-	key_name_entry->name_size = 0;
+	key_name_entry->name_size               = 0;
+	key_name_entry->number_of_values        = 0;
+	key_name_entry->value_entries_data      = NULL;
+	key_name_entry->value_entries_data_size = 0;
 
 	return( -1 );
 }
@@ -606,6 +695,11 @@ int libcreg_key_name_entry_read_values(
 #endif
 		value_entry->offset = file_offset + value_entries_offset;
 
+		if( ( key_name_entry->flags & LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA ) != 0 )
+		{
+			value_entry->flags |= LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA;
+		}
+
 		if( libcreg_value_entry_read_data(
 		     value_entry,
 		     &( value_entries_data[ value_entries_offset ] ),
@@ -662,6 +756,95 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the values of a key name entry if they have not been read before
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_name_entry_read_values_on_demand(
+     libcreg_key_name_entry_t *key_name_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_name_entry_read_values_on_demand";
+	int result            = 1;
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name_entry->value_entries_data == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( key_name_entry->values_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     key_name_entry->values_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab values mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( key_name_entry->values_read == 0 )
+	{
+		if( libcreg_key_name_entry_read_values(
+		     key_name_entry,
+		     (int) key_name_entry->number_of_values,
+		     key_name_entry->value_entries_offset,
+		     key_name_entry->value_entries_data,
+		     key_name_entry->value_entries_data_size,
+		     key_name_entry->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value entries.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			key_name_entry->values_read = 1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( key_name_entry->values_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     key_name_entry->values_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release values mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the key name size
  * Returns 1 if successful or -1 on error
  */
@@ -795,6 +978,64 @@ int libcreg_key_name_entry_get_name(
 	return( 1 );
 }
 
+/* Retrieves a reference to the key name
+ * The name is owned by the key name entry and is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_name_entry_get_name_reference(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_name_entry_get_name_reference";
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	*name = key_name_entry->name;
+
+	if( key_name_entry->name == NULL )
+	{
+		*name_size = 0;
+	}
+	else
+	{
+		*name_size = (size_t) key_name_entry->name_size;
+	}
+	return( 1 );
+}
+
 /* Retrieves the UTF-8 string size of the key name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -990,6 +1231,25 @@ int libcreg_key_name_entry_get_number_of_entries(
 
 		return( -1 );
 	}
+	/* The number of values is known without reading the values
+	 */
+	if( key_name_entry->value_entries_data != NULL )
+	{
+		if( number_of_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_entries = (int) key_name_entry->number_of_values;
+
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     key_name_entry->entries_array,
 	     number_of_entries,
@@ -1029,6 +1289,19 @@ int libcreg_key_name_entry_get_entry_by_index(
 
 		return( -1 );
 	}
+	if( libcreg_key_name_entry_read_values_on_demand(
+	     key_name_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     key_name_entry->entries_array,
 	     entry_index,
@@ -1048,22 +1321,18 @@ int libcreg_key_name_entry_get_entry_by_index(
 	return( 1 );
 }
 
-/* Compares the key name with UTF-8 string
- * Returns 1 if the names match, 0 if not or -1 on error
+/* Builds the value name hash table if it has not been built before
+ * The value name hash table is built once, with the codepage of the first lookup,
+ * since the key name entry can be shared by multiple keys and threads
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_key_name_entry_compare_name_with_utf8_string(
+int libcreg_key_name_entry_build_value_name_hash_table(
      libcreg_key_name_entry_t *key_name_entry,
-     uint32_t name_hash,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	static char *function                       = "libcreg_key_name_entry_compare_name_with_utf8_string";
-	libuna_unicode_character_t name_character   = 0;
-	libuna_unicode_character_t string_character = 0;
-	size_t name_index                           = 0;
-	size_t utf8_string_index                    = 0;
+	static char *function = "libcreg_key_name_entry_build_value_name_hash_table";
+	int result            = 1;
 
 	if( key_name_entry == NULL )
 	{
@@ -1076,34 +1345,769 @@ int libcreg_key_name_entry_compare_name_with_utf8_string(
 
 		return( -1 );
 	}
-	if( key_name_entry->name == NULL )
+	if( libcreg_key_name_entry_read_values_on_demand(
+	     key_name_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid key name entry - missing name.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( key_name_entry->values_mutex != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
-		 function );
+		if( libcthreads_mutex_grab(
+		     key_name_entry->values_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab values mutex.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+#endif
+	if( key_name_entry->value_name_hash_table == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		if( libcreg_key_name_entry_calculate_value_name_hashes(
+		     key_name_entry,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to calculate value name hashes.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( key_name_entry->values_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     key_name_entry->values_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release values mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Calculates the value name hashes and creates the value name hash table
+ * The value name hashes are calculated using the codepage
+ * The values must have been read and the caller must hold the values mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_name_entry_calculate_value_name_hashes(
+     libcreg_key_name_entry_t *key_name_entry,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcreg_value_entry_t *value_entry = NULL;
+	static char *function              = "libcreg_key_name_entry_calculate_value_name_hashes";
+	int number_of_entries              = 0;
+	int entry_index                    = 0;
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name_entry->value_name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key name entry - value name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_name_entry->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_name_hash_table_initialize(
+	     &( key_name_entry->value_name_hash_table ),
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_name_entry->entries_array,
+		     entry_index,
+		     (intptr_t **) &value_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( value_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* The default value has no name and is not looked up by name
+		 */
+		if( value_entry->name == NULL )
+		{
+			continue;
+		}
+		if( libcreg_value_entry_calculate_name_hash(
+		     value_entry,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate value entry: %d name hash.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libcreg_name_hash_table_insert_entry(
+		     key_name_entry->value_name_hash_table,
+		     value_entry->name_hash,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert value entry: %d into name hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	key_name_entry->value_name_hash_table_ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( key_name_entry->value_name_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &( key_name_entry->value_name_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the value entry for the specific UTF-8 encoded name
+ * The value name hash table is built on the first lookup
+ * Returns 1 if successful, 0 if no such value entry or -1 on error
+ */
+int libcreg_key_name_entry_get_entry_by_utf8_name(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcreg_value_entry_t **value_entry,
+     libcerror_error_t **error )
+{
+	libcreg_value_entry_t *safe_value_entry      = NULL;
+	static char *function                        = "libcreg_key_name_entry_get_entry_by_utf8_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t name_hash                           = 0;
+	int entry_index                              = 0;
+	int number_of_entries                        = 0;
+	int probe_index                              = 0;
+	int result                                   = 0;
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_name_entry_build_value_name_hash_table(
+	     key_name_entry,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build value name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value name hash table is not rebuilt when the codepage changes,
+	 * instead the names of all values are compared
+	 */
+	if( key_name_entry->value_name_hash_table_ascii_codepage != ascii_codepage )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     key_name_entry->entries_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_name_entry->entries_array,
+			     entry_index,
+			     (intptr_t **) &safe_value_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( ( safe_value_entry == NULL )
+			 || ( safe_value_entry->name == NULL ) )
+			{
+				continue;
+			}
+			result = libcreg_value_entry_compare_name_with_utf8_string(
+			          safe_value_entry,
+			          0,
+			          utf8_string,
+			          utf8_string_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare value name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*value_entry = safe_value_entry;
+
+				return( 1 );
+			}
+		}
+		return( 0 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		name_hash *= 37;
+		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	do
+	{
+		result = libcreg_name_hash_table_get_next_entry_index(
+		          key_name_entry->value_name_hash_table,
+		          name_hash,
+		          &probe_index,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next value entry index from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     key_name_entry->entries_array,
+		     entry_index,
+		     (intptr_t **) &safe_value_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libcreg_value_entry_compare_name_with_utf8_string(
+		          safe_value_entry,
+		          name_hash,
+		          utf8_string,
+		          utf8_string_length,
+		          ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare value name with UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( result == 0 );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	*value_entry = safe_value_entry;
+
+	return( 1 );
+}
+
+/* Retrieves the value entry for the specific UTF-16 encoded name
+ * The value name hash table is built on the first lookup
+ * Returns 1 if successful, 0 if no such value entry or -1 on error
+ */
+int libcreg_key_name_entry_get_entry_by_utf16_name(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcreg_value_entry_t **value_entry,
+     libcerror_error_t **error )
+{
+	libcreg_value_entry_t *safe_value_entry      = NULL;
+	static char *function                        = "libcreg_key_name_entry_get_entry_by_utf16_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t name_hash                           = 0;
+	int entry_index                              = 0;
+	int number_of_entries                        = 0;
+	int probe_index                              = 0;
+	int result                                   = 0;
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_name_entry_build_value_name_hash_table(
+	     key_name_entry,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build value name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value name hash table is not rebuilt when the codepage changes,
+	 * instead the names of all values are compared
+	 */
+	if( key_name_entry->value_name_hash_table_ascii_codepage != ascii_codepage )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     key_name_entry->entries_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_name_entry->entries_array,
+			     entry_index,
+			     (intptr_t **) &safe_value_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( ( safe_value_entry == NULL )
+			 || ( safe_value_entry->name == NULL ) )
+			{
+				continue;
+			}
+			result = libcreg_value_entry_compare_name_with_utf16_string(
+			          safe_value_entry,
+			          0,
+			          utf16_string,
+			          utf16_string_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare value name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*value_entry = safe_value_entry;
+
+				return( 1 );
+			}
+		}
+		return( 0 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		name_hash *= 37;
+		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	do
+	{
+		result = libcreg_name_hash_table_get_next_entry_index(
+		          key_name_entry->value_name_hash_table,
+		          name_hash,
+		          &probe_index,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next value entry index from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     key_name_entry->entries_array,
+		     entry_index,
+		     (intptr_t **) &safe_value_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libcreg_value_entry_compare_name_with_utf16_string(
+		          safe_value_entry,
+		          name_hash,
+		          utf16_string,
+		          utf16_string_length,
+		          ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare value name with UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( result == 0 );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	*value_entry = safe_value_entry;
+
+	return( 1 );
+}
+
+/* Compares the key name with UTF-8 string
+ * Returns 1 if the names match, 0 if not or -1 on error
+ */
+int libcreg_key_name_entry_compare_name_with_utf8_string(
+     libcreg_key_name_entry_t *key_name_entry,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libcreg_key_name_entry_compare_name_with_utf8_string";
+	libuna_unicode_character_t name_character   = 0;
+	libuna_unicode_character_t string_character = 0;
+	size_t name_index                           = 0;
+	size_t utf8_string_index                    = 0;
+	int result                                  = 0;
+
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name_entry->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key name entry - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
 		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
@@ -1115,6 +2119,33 @@ int libcreg_key_name_entry_compare_name_with_utf8_string(
 	 || ( key_name_entry->name_hash == 0 )
 	 || ( key_name_entry->name_hash == name_hash ) )
 	{
+		if( key_name_entry->folded_name != NULL )
+		{
+			result = libcreg_folded_name_compare_with_utf8_string(
+			          key_name_entry->folded_name,
+			          (size_t) key_name_entry->name_size,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare folded name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			/* A string that contains non-ASCII characters requires a full compare
+			 */
+			else if( result != 2 )
+			{
+				return( result );
+			}
+		}
 		while( name_index < (size_t) key_name_entry->name_size )
 		{
 			if( utf8_string_index >= utf8_string_length )
@@ -1184,6 +2215,7 @@ int libcreg_key_name_entry_compare_name_with_utf16_string(
 	libuna_unicode_character_t string_character = 0;
 	size_t name_index                           = 0;
 	size_t utf16_string_index                   = 0;
+	int result                                  = 0;
 
 	if( key_name_entry == NULL )
 	{
@@ -1235,6 +2267,33 @@ int libcreg_key_name_entry_compare_name_with_utf16_string(
 	 || ( key_name_entry->name_hash == 0 )
 	 || ( key_name_entry->name_hash == name_hash ) )
 	{
+		if( key_name_entry->folded_name != NULL )
+		{
+			result = libcreg_folded_name_compare_with_utf16_string(
+			          key_name_entry->folded_name,
+			          (size_t) key_name_entry->name_size,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare folded name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			/* A string that contains non-ASCII characters requires a full compare
+			 */
+			else if( result != 2 )
+			{
+				return( result );
+			}
+		}
 		while( name_index < (size_t) key_name_entry->name_size )
 		{
 			if( utf16_string_index >= utf16_string_length )
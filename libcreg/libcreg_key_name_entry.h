@@ -27,6 +27,8 @@
 
 #include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_name_hash_table.h"
 #include "libcreg_value_entry.h"
 
 #if defined( __cplusplus )
@@ -61,13 +63,60 @@ struct libcreg_key_name_entry
 	 */
 	uint16_t name_size;
 
+	/* The case folded name
+	 * The case folded name is only set if the name consists of ASCII characters
+	 */
+	uint8_t *folded_name;
+
+	/* The number of values
+	 */
+	uint16_t number_of_values;
+
+	/* The value entries data
+	 * The value entries data is only set if the values are read on demand
+	 */
+	const uint8_t *value_entries_data;
+
+	/* The value entries data size
+	 */
+	size_t value_entries_data_size;
+
+	/* The file offset of the value entries data
+	 */
+	uint32_t value_entries_offset;
+
+	/* The codepage used to read the values
+	 */
+	int ascii_codepage;
+
+	/* Value to indicate the values have been read
+	 */
+	uint8_t values_read;
+
 	/* The value entries array
 	 */
 	libcdata_array_t *entries_array;
 
+	/* The value name hash table
+	 * The table is created once on the first value lookup by name
+	 * and is not rebuilt when the codepage changes
+	 */
+	libcreg_name_hash_table_t *value_name_hash_table;
+
+	/* The codepage of the value name hashes in the value name hash table
+	 */
+	int value_name_hash_table_ascii_codepage;
+
 	/* Various flags
 	 */
 	uint8_t flags;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes reading the values on demand
+	 * The mutex is owned by the data block
+	 */
+	libcthreads_mutex_t *values_mutex;
+#endif
 };
 
 int libcreg_key_name_entry_initialize(
@@ -94,6 +143,10 @@ int libcreg_key_name_entry_read_values(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libcreg_key_name_entry_read_values_on_demand(
+     libcreg_key_name_entry_t *key_name_entry,
+     libcerror_error_t **error );
+
 int libcreg_key_name_entry_get_name_size(
      libcreg_key_name_entry_t *key_name_entry,
      size_t *name_size,
@@ -105,6 +158,12 @@ int libcreg_key_name_entry_get_name(
      size_t name_size,
      libcerror_error_t **error );
 
+int libcreg_key_name_entry_get_name_reference(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint8_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
 int libcreg_key_name_entry_get_utf8_name_size(
      libcreg_key_name_entry_t *key_name_entry,
      size_t *utf8_string_size,
@@ -142,6 +201,32 @@ int libcreg_key_name_entry_get_entry_by_index(
      libcreg_value_entry_t **value_entry,
      libcerror_error_t **error );
 
+int libcreg_key_name_entry_build_value_name_hash_table(
+     libcreg_key_name_entry_t *key_name_entry,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libcreg_key_name_entry_calculate_value_name_hashes(
+     libcreg_key_name_entry_t *key_name_entry,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libcreg_key_name_entry_get_entry_by_utf8_name(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcreg_value_entry_t **value_entry,
+     libcerror_error_t **error );
+
+int libcreg_key_name_entry_get_entry_by_utf16_name(
+     libcreg_key_name_entry_t *key_name_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcreg_value_entry_t **value_entry,
+     libcerror_error_t **error );
+
 int libcreg_key_name_entry_compare_name_with_utf8_string(
      libcreg_key_name_entry_t *key_name_entry,
      uint32_t name_hash,
@@ -25,17 +25,28 @@
 #include <types.h>
 
 #include "libcreg_data_block.h"
+#include "libcreg_data_block_loader.h"
 #include "libcreg_definitions.h"
 #include "libcreg_io_handle.h"
+#include "libcreg_key_hierarchy_table.h"
 #include "libcreg_key_name_entry.h"
 #include "libcreg_key_navigation.h"
 #include "libcreg_libbfio.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
+#include "libcreg_libcthreads.h"
 #include "libcreg_libfcache.h"
 #include "libcreg_libfdata.h"
+#include "libcreg_libuna.h"
+#include "libcreg_name_hash.h"
+#include "libcreg_name_hash_table.h"
+#include "libcreg_offset_path_cache.h"
+#include "libcreg_path_index.h"
+#include "libcreg_read_ahead_buffer.h"
+#include "libcreg_sharded_cache.h"
 #include "libcreg_unused.h"
 
+#include "creg_data_block.h"
 #include "creg_file_header.h"
 #include "creg_key_navigation.h"
 
@@ -100,8 +111,67 @@ int libcreg_key_navigation_initialize(
 		 "%s: unable to clear key navigation.",
 		 function );
 
+		memory_free(
+		 *key_navigation );
+
+		*key_navigation = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *key_navigation )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_navigation )->offset_path_cache_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize offset path cache mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_navigation )->read_ahead_buffer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read-ahead buffer mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_navigation )->loaded_data_blocks_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize loaded data blocks mutex.",
+		 function );
+
 		goto on_error;
 	}
+#endif
 	( *key_navigation )->io_handle = io_handle;
 
 	return( 1 );
@@ -109,6 +179,26 @@ int libcreg_key_navigation_initialize(
 on_error:
 	if( *key_navigation != NULL )
 	{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( ( *key_navigation )->read_ahead_buffer_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *key_navigation )->read_ahead_buffer_mutex ),
+			 NULL );
+		}
+		if( ( *key_navigation )->offset_path_cache_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *key_navigation )->offset_path_cache_mutex ),
+			 NULL );
+		}
+		if( ( *key_navigation )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *key_navigation )->read_write_lock ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 *key_navigation );
 
@@ -125,6 +215,7 @@ int libcreg_key_navigation_free(
      libcerror_error_t **error )
 {
 	static char *function = "libcreg_key_navigation_free";
+	int data_block_index  = 0;
 	int result            = 1;
 
 	if( key_navigation == NULL )
@@ -160,7 +251,7 @@ int libcreg_key_navigation_free(
 		}
 		if( ( *key_navigation )->key_hierarchy_cache != NULL )
 		{
-			if( libfcache_cache_free(
+			if( libcreg_sharded_cache_free(
 			     &( ( *key_navigation )->key_hierarchy_cache ),
 			     error ) != 1 )
 			{
@@ -174,6 +265,62 @@ int libcreg_key_navigation_free(
 				result = -1;
 			}
 		}
+		if( ( *key_navigation )->loaded_data_blocks != NULL )
+		{
+			for( data_block_index = 0;
+			     data_block_index < ( *key_navigation )->number_of_loaded_data_blocks;
+			     data_block_index++ )
+			{
+				if( libcreg_data_block_release_reference(
+				     &( ( *key_navigation )->loaded_data_blocks[ data_block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release loaded data block: %d.",
+					 function,
+					 data_block_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *key_navigation )->loaded_data_blocks );
+		}
+		if( ( *key_navigation )->read_ahead_buffer != NULL )
+		{
+			if( libcreg_read_ahead_buffer_free(
+			     &( ( *key_navigation )->read_ahead_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read-ahead buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_navigation )->key_hierarchy_table != NULL )
+		{
+			if( libcreg_key_hierarchy_table_free(
+			     &( ( *key_navigation )->key_hierarchy_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key hierarchy table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *key_navigation )->data_blocks_list != NULL )
 		{
 			if( libfdata_list_free(
@@ -192,7 +339,7 @@ int libcreg_key_navigation_free(
 		}
 		if( ( *key_navigation )->data_blocks_cache != NULL )
 		{
-			if( libfcache_cache_free(
+			if( libcreg_sharded_cache_free(
 			     &( ( *key_navigation )->data_blocks_cache ),
 			     error ) != 1 )
 			{
@@ -206,6 +353,104 @@ int libcreg_key_navigation_free(
 				result = -1;
 			}
 		}
+		if( ( *key_navigation )->path_index != NULL )
+		{
+			if( libcreg_path_index_free(
+			     &( ( *key_navigation )->path_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_navigation )->offset_path_cache != NULL )
+		{
+			if( libcreg_offset_path_cache_free(
+			     &( ( *key_navigation )->offset_path_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free offset path cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( ( *key_navigation )->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_free(
+			     &( ( *key_navigation )->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_navigation )->offset_path_cache_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_navigation )->offset_path_cache_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free offset path cache mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_navigation )->read_ahead_buffer_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_navigation )->read_ahead_buffer_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read-ahead buffer mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_navigation )->loaded_data_blocks_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_navigation )->loaded_data_blocks_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free loaded data blocks mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *key_navigation );
 
@@ -215,6 +460,7 @@ int libcreg_key_navigation_free(
 }
 
 /* Reads a key navigation record
+ * The key navigation record is read at the offset following the file header
  * Returns 1 if successful, 0 if no key navigation signature was found or -1 on error
  */
 int libcreg_key_navigation_read_file_io_handle(
@@ -277,10 +523,11 @@ int libcreg_key_navigation_read_file_io_handle(
 		 sizeof( creg_file_header_t ) );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer(
+	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              (uint8_t *) &key_navigation_header,
 	              sizeof( creg_key_navigation_header_t ),
+	              (off64_t) sizeof( creg_file_header_t ),
 	              error );
 
 	if( read_count != (ssize_t) sizeof( creg_key_navigation_header_t ) )
@@ -404,14 +651,17 @@ int libcreg_key_navigation_read_file_io_handle(
 	}
 	data_size -= sizeof( creg_key_navigation_header_t );
 
+	key_navigation->key_hierarchy_data_offset = (off64_t) key_hierarchy_entries_data_offset;
+	key_navigation->key_hierarchy_data_size   = (size64_t) data_size;
+
 /* TODO clone function ? */
 	if( libfdata_area_initialize(
 	     &( key_navigation->key_hierarchy_area ),
 	     (size64_t) sizeof( creg_key_hierarchy_entry_t ),
+	     (intptr_t *) key_navigation,
 	     NULL,
 	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_area_t *, libfdata_cache_t *, off64_t, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libcreg_io_handle_read_key_hierarchy_entry,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_area_t *, libfdata_cache_t *, off64_t, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libcreg_key_navigation_read_key_hierarchy_entry_element_data,
 	     NULL,
 	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
 	     error ) != 1 )
@@ -443,8 +693,9 @@ int libcreg_key_navigation_read_file_io_handle(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libcreg_sharded_cache_initialize(
 	     &( key_navigation->key_hierarchy_cache ),
+	     LIBCREG_NUMBER_OF_CACHE_SHARDS,
 	     LIBCREG_MAXIMUM_CACHE_ENTRIES_KEYS,
 	     error ) != 1 )
 	{
@@ -462,7 +713,7 @@ int libcreg_key_navigation_read_file_io_handle(
 on_error:
 	if( key_navigation->key_hierarchy_cache != NULL )
 	{
-		libfcache_cache_free(
+		libcreg_sharded_cache_free(
 		 &( key_navigation->key_hierarchy_cache ),
 		 NULL );
 	}
@@ -475,20 +726,18 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the data block
- * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+/* Sets the size of the read-ahead window
+ * The read-ahead window is used to read the data of several consecutive data blocks with a single read
+ * A value of 0 disables the read-ahead window
+ * Returns 1 if successful or -1 on error
  */
-int libcreg_key_navigation_read_data_blocks(
+int libcreg_key_navigation_set_read_ahead_size(
      libcreg_key_navigation_t *key_navigation,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     size64_t file_size,
+     size_t read_ahead_size,
      libcerror_error_t **error )
 {
-	libcreg_data_block_t *data_block = NULL;
-	static char *function            = "libcreg_key_navigation_read_data_blocks";
-	int data_block_index             = 0;
-	int result                       = 0;
+	static char *function = "libcreg_key_navigation_set_read_ahead_size";
+	int result            = 1;
 
 	if( key_navigation == NULL )
 	{
@@ -501,164 +750,4184 @@ int libcreg_key_navigation_read_data_blocks(
 
 		return( -1 );
 	}
-	if( key_navigation->data_blocks_list != NULL )
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->read_ahead_buffer_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key navigation - data blocks list already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead buffer mutex.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_navigation->data_blocks_cache != NULL )
+#endif
+	if( key_navigation->read_ahead_buffer != NULL )
+	{
+		if( libcreg_read_ahead_buffer_free(
+		     &( key_navigation->read_ahead_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( read_ahead_size > 0 ) )
+	{
+		if( libcreg_read_ahead_buffer_initialize(
+		     &( key_navigation->read_ahead_buffer ),
+		     read_ahead_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->read_ahead_buffer_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid key navigation - data blocks list already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead buffer mutex.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_navigation->io_handle == NULL )
+#endif
+	return( result );
+}
+
+/* Reads a data block header
+ * The header is read from the read-ahead window if available
+ * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+ */
+int libcreg_key_navigation_read_data_block_header(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_data_block_t *data_block,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	static char *function = "libcreg_key_navigation_read_data_block_header";
+	int result            = 0;
+
+	if( key_navigation == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid key navigation - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_offset < 0 )
+	if( data_block == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
-		 "%s: invalid file offset value less than zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_initialize(
-	     &( key_navigation->data_blocks_list ),
-	     (intptr_t *) key_navigation->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libcreg_key_navigation_read_data_block_element_data,
-	     NULL,
-	     0,
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->read_ahead_buffer_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data blocks list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead buffer mutex.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( (size64_t) file_offset < file_size )
+#endif
+	if( key_navigation->read_ahead_buffer == NULL )
 	{
-		if( libcreg_data_block_initialize(
-		     &data_block,
-		     error ) != 1 )
+		result = libcreg_data_block_read_header(
+		          data_block,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	else
+	{
+		result = libcreg_read_ahead_buffer_get_data_at_offset(
+		          key_navigation->read_ahead_buffer,
+		          file_io_handle,
+		          file_offset,
+		          sizeof( creg_data_block_header_t ),
+		          &data,
+		          error );
+
+		if( result == 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data block.",
+			data_block->offset = file_offset;
+
+			result = libcreg_data_block_read_header_data(
+			          data_block,
+			          data,
+			          sizeof( creg_data_block_header_t ),
+			          error );
+		}
+		else if( result == 0 )
+		{
+			result = libcreg_data_block_read_header(
+			          data_block,
+			          file_io_handle,
+			          file_offset,
+			          error );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->read_ahead_buffer_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead buffer mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Initializes the data blocks without scanning them
+ * The data blocks are scanned on demand, as far as needed to retrieve a specific data block
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_initialize_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_navigation_initialize_data_blocks";
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - data blocks list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - data blocks cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_initialize(
+	     &( key_navigation->data_blocks_list ),
+	     (intptr_t *) key_navigation,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libcreg_key_navigation_read_data_block_element_data,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data blocks list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_sharded_cache_initialize(
+	     &( key_navigation->data_blocks_cache ),
+	     LIBCREG_NUMBER_OF_CACHE_SHARDS,
+	     LIBCREG_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data blocks cache.",
+		 function );
+
+		goto on_error;
+	}
+	key_navigation->data_blocks_scan_offset = file_offset;
+	key_navigation->data_blocks_scan_size   = file_size;
+	key_navigation->flags                  |= LIBCREG_KEY_NAVIGATION_FLAG_DATA_BLOCKS_SCAN_PENDING;
+
+	return( 1 );
+
+on_error:
+	if( key_navigation->data_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &( key_navigation->data_blocks_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the data blocks up to and including a specific data block
+ * A data block index of -1 represents all remaining data blocks
+ * The data blocks that were already scanned are kept
+ * The scan is serialized by the read/write lock of the key navigation
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_scan_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int data_block_index,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *data_block = NULL;
+	static char *function            = "libcreg_key_navigation_scan_data_blocks";
+	off64_t file_offset              = 0;
+	int number_of_data_blocks        = 0;
+	int result                       = 0;
+	int scan_data_blocks             = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->data_blocks_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing data blocks list.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( key_navigation->flags & LIBCREG_KEY_NAVIGATION_FLAG_DATA_BLOCKS_SCAN_PENDING ) != 0 )
+	{
+		if( data_block_index == -1 )
+		{
+			scan_data_blocks = 1;
+		}
+		else
+		{
+			result = libfdata_list_get_number_of_elements(
+			          key_navigation->data_blocks_list,
+			          &number_of_data_blocks,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of data blocks list elements.",
+				 function );
+			}
+			else if( data_block_index >= number_of_data_blocks )
+			{
+				scan_data_blocks = 1;
+			}
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	if( scan_data_blocks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The data blocks could have been scanned while waiting for the lock
+	 */
+	if( libfdata_list_get_number_of_elements(
+	     key_navigation->data_blocks_list,
+	     &number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks list elements.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = key_navigation->data_blocks_scan_offset;
+
+	while( ( key_navigation->flags & LIBCREG_KEY_NAVIGATION_FLAG_DATA_BLOCKS_SCAN_PENDING ) != 0 )
+	{
+		if( ( data_block_index >= 0 )
+		 && ( data_block_index < number_of_data_blocks ) )
+		{
+			break;
+		}
+		if( (size64_t) file_offset >= key_navigation->data_blocks_scan_size )
+		{
+			key_navigation->flags &= ~( LIBCREG_KEY_NAVIGATION_FLAG_DATA_BLOCKS_SCAN_PENDING );
+
+			break;
+		}
+		if( libcreg_data_block_initialize(
+		     &data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading data block: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 number_of_data_blocks,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		result = libcreg_key_navigation_read_data_block_header(
+		          key_navigation,
+		          file_io_handle,
+		          data_block,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block header.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+/* TODO mark file as corrupted */
+			if( number_of_data_blocks != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: missing data block at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
+
+				goto on_error;
+			}
+			key_navigation->flags &= ~( LIBCREG_KEY_NAVIGATION_FLAG_DATA_BLOCKS_SCAN_PENDING );
+		}
+		else
+		{
+			if( data_block->size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: invalid data block: %d size.",
+				 function,
+				 number_of_data_blocks );
+
+				goto on_error;
+			}
+			if( libfdata_list_append_element(
+			     key_navigation->data_blocks_list,
+			     &number_of_data_blocks,
+			     0,
+			     (off64_t) data_block->offset,
+			     (size64_t) data_block->size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data block: %d to data list.",
+				 function,
+				 number_of_data_blocks );
+
+				goto on_error;
+			}
+			number_of_data_blocks++;
+
+			file_offset += data_block->size;
+
+			key_navigation->data_blocks_scan_offset = file_offset;
+		}
+		if( libcreg_data_block_free(
+		     &data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 key_navigation->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads the data blocks
+ * Returns 1 if successful, 0 if no data block signature was found or -1 on error
+ */
+int libcreg_key_navigation_read_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcreg_key_navigation_read_data_blocks";
+	int number_of_data_blocks = 0;
+
+	if( libcreg_key_navigation_initialize_data_blocks(
+	     key_navigation,
+	     file_offset,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_scan_data_blocks(
+	     key_navigation,
+	     file_io_handle,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan data blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     key_navigation->data_blocks_list,
+	     &number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks list elements.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_data_blocks == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( key_navigation->data_blocks_cache != NULL )
+	{
+		libcreg_sharded_cache_free(
+		 &( key_navigation->data_blocks_cache ),
+		 NULL );
+	}
+	if( key_navigation->data_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &( key_navigation->data_blocks_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resizes the loaded data blocks to a specific number of data blocks
+ * The loaded data blocks are never shrunk, the new entries are set to NULL
+ * The caller must hold the loaded data blocks mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_resize_loaded_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     int number_of_data_blocks,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t **reallocation = NULL;
+	static char *function               = "libcreg_key_navigation_resize_loaded_data_blocks";
+	size_t loaded_data_blocks_size      = 0;
+	size_t previous_size                = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_blocks <= key_navigation->number_of_loaded_data_blocks )
+	{
+		return( 1 );
+	}
+	loaded_data_blocks_size = sizeof( libcreg_data_block_t * ) * number_of_data_blocks;
+
+	if( loaded_data_blocks_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid loaded data blocks size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (libcreg_data_block_t **) memory_reallocate(
+	                                          key_navigation->loaded_data_blocks,
+	                                          loaded_data_blocks_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize loaded data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	key_navigation->loaded_data_blocks = reallocation;
+
+	previous_size = sizeof( libcreg_data_block_t * ) * key_navigation->number_of_loaded_data_blocks;
+
+	if( memory_set(
+	     &( ( (uint8_t *) key_navigation->loaded_data_blocks )[ previous_size ] ),
+	     0,
+	     loaded_data_blocks_size - previous_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear loaded data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	key_navigation->number_of_loaded_data_blocks = number_of_data_blocks;
+
+	return( 1 );
+}
+
+/* Runs the data block loaders
+ * The caller must hold the loaded data blocks mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_run_data_block_loaders(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int number_of_data_blocks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_loader_t **data_block_loaders = NULL;
+	static char *function                            = "libcreg_key_navigation_run_data_block_loaders";
+	size_t data_block_loaders_size                   = 0;
+	int data_block_loader_index                      = 0;
+	int result                                       = 1;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_data_blocks < 0 )
+	 || ( number_of_data_blocks > key_navigation->number_of_loaded_data_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of data blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > number_of_data_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_block_loaders_size = sizeof( libcreg_data_block_loader_t * ) * number_of_threads;
+
+	data_block_loaders = (libcreg_data_block_loader_t **) memory_allocate(
+	                                                       data_block_loaders_size );
+
+	if( data_block_loaders == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block loaders.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     data_block_loaders,
+	     0,
+	     data_block_loaders_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data block loaders.",
+		 function );
+
+		goto on_error;
+	}
+	/* Each loader loads every number of threads data block starting at its own index
+	 */
+	for( data_block_loader_index = 0;
+	     data_block_loader_index < number_of_threads;
+	     data_block_loader_index++ )
+	{
+		if( libcreg_data_block_loader_initialize(
+		     &( data_block_loaders[ data_block_loader_index ] ),
+		     file_io_handle,
+		     key_navigation->data_blocks_list,
+		     key_navigation->loaded_data_blocks,
+		     number_of_data_blocks,
+		     data_block_loader_index,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block loader: %d.",
+			 function,
+			 data_block_loader_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	for( data_block_loader_index = 0;
+	     data_block_loader_index < number_of_threads;
+	     data_block_loader_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( data_block_loaders[ data_block_loader_index ]->thread ),
+		     NULL,
+		     (int (*)(void *)) &libcreg_data_block_loader_load_callback,
+		     (void *) data_block_loaders[ data_block_loader_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of data block loader: %d.",
+			 function,
+			 data_block_loader_index );
+
+			goto on_error;
+		}
+	}
+	for( data_block_loader_index = 0;
+	     data_block_loader_index < number_of_threads;
+	     data_block_loader_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( data_block_loaders[ data_block_loader_index ]->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of data block loader: %d.",
+			 function,
+			 data_block_loader_index );
+
+			goto on_error;
+		}
+	}
+#else
+	for( data_block_loader_index = 0;
+	     data_block_loader_index < number_of_threads;
+	     data_block_loader_index++ )
+	{
+		libcreg_data_block_loader_load_callback(
+		 data_block_loaders[ data_block_loader_index ] );
+	}
+#endif /* defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+
+	for( data_block_loader_index = 0;
+	     data_block_loader_index < number_of_threads;
+	     data_block_loader_index++ )
+	{
+		if( data_block_loaders[ data_block_loader_index ]->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to load data blocks with data block loader: %d.",
+			 function,
+			 data_block_loader_index );
+
+			result = -1;
+		}
+		if( libcreg_data_block_loader_free(
+		     &( data_block_loaders[ data_block_loader_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block loader: %d.",
+			 function,
+			 data_block_loader_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 data_block_loaders );
+
+	/* Data blocks that were loaded remain available if loading other data blocks failed
+	 */
+	return( result );
+
+on_error:
+	if( data_block_loaders != NULL )
+	{
+		for( data_block_loader_index = 0;
+		     data_block_loader_index < number_of_threads;
+		     data_block_loader_index++ )
+		{
+			if( data_block_loaders[ data_block_loader_index ] != NULL )
+			{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+				if( data_block_loaders[ data_block_loader_index ]->thread != NULL )
+				{
+					libcthreads_thread_join(
+					 &( data_block_loaders[ data_block_loader_index ]->thread ),
+					 NULL );
+				}
+#endif
+				libcreg_data_block_loader_free(
+				 &( data_block_loaders[ data_block_loader_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 data_block_loaders );
+	}
+	return( -1 );
+}
+
+/* Loads the data blocks ahead of their retrieval
+ * The data blocks are read and parsed by multiple loaders, each with its own file IO handle,
+ * that run in their own thread if multi-threading is supported
+ * Data blocks that were already loaded are not loaded again
+ * The key navigation keeps a reference to the loaded data blocks until it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_load_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcreg_key_navigation_load_data_blocks";
+	int number_of_data_blocks = 0;
+	int result                = 1;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_get_number_of_data_blocks(
+	     key_navigation,
+	     file_io_handle,
+	     &number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_blocks == 0 )
+	{
+		return( 1 );
+	}
+#if !defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the data blocks are loaded by a single loader
+	 */
+	number_of_threads = 1;
+#endif
+	if( number_of_threads > number_of_data_blocks )
+	{
+		number_of_threads = number_of_data_blocks;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->loaded_data_blocks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab loaded data blocks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_key_navigation_resize_loaded_data_blocks(
+	     key_navigation,
+	     number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize loaded data blocks.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_key_navigation_run_data_block_loaders(
+	          key_navigation,
+	          file_io_handle,
+	          number_of_data_blocks,
+	          number_of_threads,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to run data block loaders.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->loaded_data_blocks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release loaded data blocks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads all key hierarchy entries into the key hierarchy table
+ * The key hierarchy entries data is read with a single read and the key hierarchy entries
+ * are retrieved from the table instead of being read and cached one at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_read_key_hierarchy_table(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	static char *function                              = "libcreg_key_navigation_read_key_hierarchy_table";
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->key_hierarchy_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - key hierarchy table already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_hierarchy_table_initialize(
+	     &key_hierarchy_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key hierarchy table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_key_hierarchy_table_read_file_io_handle(
+	     key_hierarchy_table,
+	     file_io_handle,
+	     key_navigation->key_hierarchy_data_offset,
+	     key_navigation->key_hierarchy_data_size,
+	     LIBCREG_ROOT_KEY_OFFSET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key hierarchy table.",
+		 function );
+
+		goto on_error;
+	}
+	key_navigation->key_hierarchy_table = key_hierarchy_table;
+
+	return( 1 );
+
+on_error:
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key hierarchy entry at a specific offset
+ * The key hierarchy entry is copied while the cache shard is grabbed, since a cached
+ * entry can be evicted by another thread after the shard is released
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     off64_t key_hierarchy_entry_offset,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t *cached_key_hierarchy_entry = NULL;
+	libcreg_sharded_cache_shard_t *shard                      = NULL;
+	static char *function                                     = "libcreg_key_navigation_get_key_hierarchy_entry_at_offset";
+	uint64_t number_of_misses                                 = 0;
+	int result                                                = 0;
+	int shard_index                                           = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_navigation->key_hierarchy_table != NULL )
+	 && ( key_hierarchy_entry_offset >= 0 )
+	 && ( key_hierarchy_entry_offset <= (off64_t) UINT32_MAX ) )
+	{
+		result = libcreg_key_hierarchy_table_get_entry_by_offset(
+		          key_navigation->key_hierarchy_table,
+		          (uint32_t) key_hierarchy_entry_offset,
+		          key_hierarchy_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry at offset: 0x%08" PRIx64 " from table.",
+			 function,
+			 key_hierarchy_entry_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	/* Entries outside the table, such as at unaligned offsets, are read individually
+	 */
+	if( libcreg_sharded_cache_get_shard_index(
+	     key_navigation->key_hierarchy_cache,
+	     (uint64_t) key_hierarchy_entry_offset,
+	     &shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy cache shard index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_sharded_cache_grab_shard(
+	     key_navigation->key_hierarchy_cache,
+	     shard_index,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab key hierarchy cache shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	/* The read callback counts a miss, any other lookup is a hit
+	 */
+	number_of_misses = shard->number_of_misses;
+
+	result = libfdata_area_get_element_value_at_offset(
+	          key_navigation->key_hierarchy_area,
+	          (intptr_t *) file_io_handle,
+	          (libfdata_cache_t *) shard->cache,
+	          key_hierarchy_entry_offset,
+	          (intptr_t **) &cached_key_hierarchy_entry,
+	          0,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry at offset: 0x%08" PRIx64 ".",
+		 function,
+		 key_hierarchy_entry_offset );
+
+		result = -1;
+	}
+	else if( cached_key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing key hierarchy entry at offset: 0x%08" PRIx64 ".",
+		 function,
+		 key_hierarchy_entry_offset );
+
+		result = -1;
+	}
+	else if( memory_copy(
+	          key_hierarchy_entry,
+	          cached_key_hierarchy_entry,
+	          sizeof( libcreg_key_hierarchy_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key hierarchy entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( shard->number_of_misses == number_of_misses )
+	{
+		shard->number_of_hits += 1;
+	}
+	if( libcreg_sharded_cache_release_shard(
+	     key_navigation->key_hierarchy_cache,
+	     shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release key hierarchy cache shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of data blocks
+ * Data blocks that were not yet scanned are scanned first
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_get_number_of_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_data_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_navigation_get_number_of_data_blocks";
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_scan_data_blocks(
+	     key_navigation,
+	     file_io_handle,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	/* All data blocks are scanned hence the data blocks list no longer changes
+	 */
+	if( libfdata_list_get_number_of_elements(
+	     key_navigation->data_blocks_list,
+	     number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks list elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific data block
+ * A reference to the data block is grabbed on behalf of the caller, so that the data block
+ * remains valid after it is evicted from the cache. The caller must release the reference
+ * with libcreg_data_block_release_reference
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_get_data_block_at_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int data_block_index,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *referenced_data_block = NULL;
+	libcreg_data_block_t *safe_data_block       = NULL;
+	libcreg_sharded_cache_shard_t *shard        = NULL;
+	static char *function                       = "libcreg_key_navigation_get_data_block_at_index";
+	uint64_t number_of_misses                   = 0;
+	int result                                  = 0;
+	int shard_index                             = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_key_navigation_scan_data_blocks(
+	     key_navigation,
+	     file_io_handle,
+	     data_block_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan data blocks up to data block: %d.",
+		 function,
+		 data_block_index );
+
+		return( -1 );
+	}
+	if( libcreg_sharded_cache_get_shard_index(
+	     key_navigation->data_blocks_cache,
+	     (uint64_t) data_block_index,
+	     &shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data blocks cache shard index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The data blocks list can be appended to by a data blocks scan of another thread
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcreg_sharded_cache_grab_shard(
+	     key_navigation->data_blocks_cache,
+	     shard_index,
+	     &shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab data blocks cache shard: %d.",
+		 function,
+		 shard_index );
+
+		result = -1;
+	}
+	else
+	{
+		/* The read callback counts a miss, any other lookup is a hit
+		 */
+		number_of_misses = shard->number_of_misses;
+
+		result = libfdata_list_get_element_value_by_index(
+		          key_navigation->data_blocks_list,
+		          (intptr_t *) file_io_handle,
+		          (libfdata_cache_t *) shard->cache,
+		          data_block_index,
+		          (intptr_t **) &safe_data_block,
+		          0,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %d.",
+			 function,
+			 data_block_index );
+
+			result = -1;
+		}
+		/* The reference is grabbed before the shard is released, since the cache
+		 * can evict the data block as soon as the shard is released
+		 */
+		else if( libcreg_data_block_grab_reference(
+		          safe_data_block,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to data block: %d.",
+			 function,
+			 data_block_index );
+
+			result = -1;
+		}
+		else
+		{
+			referenced_data_block = safe_data_block;
+
+			if( shard->number_of_misses == number_of_misses )
+			{
+				shard->number_of_hits += 1;
+			}
+		}
+		if( libcreg_sharded_cache_release_shard(
+		     key_navigation->data_blocks_cache,
+		     shard,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release data blocks cache shard: %d.",
+			 function,
+			 shard_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		if( referenced_data_block != NULL )
+		{
+			libcreg_data_block_release_reference(
+			 &referenced_data_block,
+			 NULL );
+		}
+		return( -1 );
+	}
+	*data_block = referenced_data_block;
+
+	return( 1 );
+}
+
+/* Retrieves the key name entry of a specific key hierarchy entry
+ * The key name entry is owned by the data block that contains it. A reference to this data block
+ * is grabbed on behalf of the caller, which must release it with libcreg_data_block_release_reference
+ * once the key name entry is no longer used
+ * Returns 1 if successful, 0 if the key hierarchy entry has no key name entry or -1 on error
+ */
+int libcreg_key_navigation_get_key_name_entry(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     libcreg_data_block_t **data_block,
+     libcreg_key_name_entry_t **key_name_entry,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *safe_data_block         = NULL;
+	libcreg_key_name_entry_t *safe_key_name_entry = NULL;
+	static char *function                         = "libcreg_key_navigation_get_key_name_entry";
+	int result                                    = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int16_t) key_hierarchy_entry->data_block_number < 0 )
+	{
+		*key_name_entry = NULL;
+
+		return( 0 );
+	}
+	if( libcreg_key_navigation_get_data_block_at_index(
+	     key_navigation,
+	     file_io_handle,
+	     (int) key_hierarchy_entry->data_block_number,
+	     &safe_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve data block number: %" PRIu16 ".",
+		 function,
+		 key_hierarchy_entry->data_block_number );
+
+		return( -1 );
+	}
+	if( libcreg_data_block_get_entry_by_identifier(
+	     safe_data_block,
+	     key_hierarchy_entry->key_name_entry_number,
+	     &safe_key_name_entry,
+	     key_navigation->io_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve key entry element number: %" PRIu16 ".",
+		 function,
+		 key_hierarchy_entry->key_name_entry_number );
+
+		goto on_error;
+	}
+	if( safe_key_name_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing key name entry: %" PRIu16 ".",
+		 function,
+		 key_hierarchy_entry->key_name_entry_number );
+
+		goto on_error;
+	}
+	if( ( safe_key_name_entry->name_size > 0 )
+	 && ( safe_key_name_entry->name_hash != key_hierarchy_entry->name_hash ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in name hash (stored: 0x%08" PRIx32 " != calculated: 0x%08" PRIx32 ").\n",
+			 function,
+			 key_hierarchy_entry->name_hash,
+			 safe_key_name_entry->name_hash );
+		}
+#endif
+		result = libcreg_key_navigation_has_name_hash_mismatch(
+		          key_navigation,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if there is a name hash mismatch.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libcreg_key_navigation_set_name_hash_mismatch(
+			     key_navigation,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set name hash mismatch.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	*data_block     = safe_data_block;
+	*key_name_entry = safe_key_name_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_data_block != NULL )
+	{
+		libcreg_data_block_release_reference(
+		 &safe_data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the name of a specific key hierarchy entry with an UTF-8 encoded string
+ * If the name hash is not 0 it is used to skip key name entries without comparing their name
+ * If use_stored_name_hash is set the name hash stored in the key hierarchy entry is used to skip
+ * key hierarchy entries without reading their key name entry. The stored name hash is not
+ * guaranteed to be correct, hence a lookup that uses it must be repeated without it if no key matched
+ * Returns 1 if the names match, 0 if not or -1 on error
+ */
+int libcreg_key_navigation_compare_key_name_with_utf8_string(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     uint32_t name_hash,
+     int use_stored_name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	static char *function                    = "libcreg_key_navigation_compare_key_name_with_utf8_string";
+	int result                               = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( use_stored_name_hash != 0 )
+	 && ( name_hash != 0 )
+	 && ( key_hierarchy_entry->name_hash != name_hash ) )
+	{
+		return( 0 );
+	}
+	result = libcreg_key_navigation_get_key_name_entry(
+	          key_navigation,
+	          file_io_handle,
+	          key_hierarchy_entry,
+	          &data_block,
+	          &key_name_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( key_name_entry->name == NULL )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = libcreg_key_name_entry_compare_name_with_utf8_string(
+		          key_name_entry,
+		          name_hash,
+		          utf8_string,
+		          utf8_string_length,
+		          ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key name with UTF-8 string.",
+			 function );
+		}
+	}
+	if( libcreg_data_block_release_reference(
+	     &data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data block.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Compares the name of a specific key hierarchy entry with an UTF-16 encoded string
+ * If the name hash is not 0 it is used to skip key name entries without comparing their name
+ * If use_stored_name_hash is set the name hash stored in the key hierarchy entry is used to skip
+ * key hierarchy entries without reading their key name entry. The stored name hash is not
+ * guaranteed to be correct, hence a lookup that uses it must be repeated without it if no key matched
+ * Returns 1 if the names match, 0 if not or -1 on error
+ */
+int libcreg_key_navigation_compare_key_name_with_utf16_string(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     uint32_t name_hash,
+     int use_stored_name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	static char *function                    = "libcreg_key_navigation_compare_key_name_with_utf16_string";
+	int result                               = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( use_stored_name_hash != 0 )
+	 && ( name_hash != 0 )
+	 && ( key_hierarchy_entry->name_hash != name_hash ) )
+	{
+		return( 0 );
+	}
+	result = libcreg_key_navigation_get_key_name_entry(
+	          key_navigation,
+	          file_io_handle,
+	          key_hierarchy_entry,
+	          &data_block,
+	          &key_name_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key name entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( key_name_entry->name == NULL )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = libcreg_key_name_entry_compare_name_with_utf16_string(
+		          key_name_entry,
+		          name_hash,
+		          utf16_string,
+		          utf16_string_length,
+		          ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key name with UTF-16 string.",
+			 function );
+		}
+	}
+	if( libcreg_data_block_release_reference(
+	     &data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data block.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Determines if a name hash stored in a key hierarchy entry was found not to match
+ * the name hash calculated from its key name entry
+ * Returns 1 if a mismatch was found, 0 if not or -1 on error
+ */
+int libcreg_key_navigation_has_name_hash_mismatch(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_navigation_has_name_hash_mismatch";
+	int result            = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( key_navigation->flags & LIBCREG_KEY_NAVIGATION_FLAG_NAME_HASH_MISMATCH ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Marks that a name hash stored in a key hierarchy entry does not match
+ * the name hash calculated from its key name entry
+ * From then on a lookup of a sub key by name that did not match any sub key filtered
+ * by the stored name hash is repeated without the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_set_name_hash_mismatch(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_navigation_set_name_hash_mismatch";
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	key_navigation->flags |= LIBCREG_KEY_NAVIGATION_FLAG_NAME_HASH_MISMATCH;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_navigation->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the sub key offset for the specific UTF-8 encoded name
+ * The key hierarchy entries of the sub keys are filtered by name hash before their name is compared
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libcreg_key_navigation_get_sub_key_offset_by_utf8_name(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	static char *function         = "libcreg_key_navigation_get_sub_key_offset_by_utf8_name";
+	uint32_t first_sub_key_offset = 0;
+	uint32_t name_hash            = 0;
+	uint32_t next_key_offset      = 0;
+	uint32_t safe_sub_key_offset  = 0;
+	int recursion_depth           = 0;
+	int result                    = 0;
+	int use_stored_name_hash      = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		name_hash = 0;
+	}
+	if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+	     key_navigation,
+	     file_io_handle,
+	     (off64_t) key_offset,
+	     &key_hierarchy_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		return( -1 );
+	}
+	first_sub_key_offset = key_hierarchy_entry.sub_key_offset;
+
+	/* The sub keys are first filtered by the name hash stored in their key hierarchy entry.
+	 * The stored name hash is not guaranteed to be correct, hence if no sub key matched
+	 * and stored name hashes were found not to match their key name, the names of all
+	 * the sub keys are compared
+	 */
+	for( use_stored_name_hash = 1;
+	     use_stored_name_hash >= 0;
+	     use_stored_name_hash-- )
+	{
+		if( use_stored_name_hash == 0 )
+		{
+			if( name_hash == 0 )
+			{
+				break;
+			}
+			result = libcreg_key_navigation_has_name_hash_mismatch(
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if there is a name hash mismatch.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		safe_sub_key_offset = first_sub_key_offset;
+		recursion_depth     = 0;
+
+		while( ( safe_sub_key_offset != 0 )
+		    && ( safe_sub_key_offset != 0xffffffffUL ) )
+		{
+			if( recursion_depth > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid recursion depth value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     key_navigation,
+			     file_io_handle,
+			     (off64_t) safe_sub_key_offset,
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 safe_sub_key_offset,
+				 safe_sub_key_offset );
+
+				return( -1 );
+			}
+			next_key_offset = key_hierarchy_entry.next_key_offset;
+
+			result = libcreg_key_navigation_compare_key_name_with_utf8_string(
+			          key_navigation,
+			          file_io_handle,
+			          &key_hierarchy_entry,
+			          name_hash,
+			          use_stored_name_hash,
+			          utf8_string,
+			          utf8_string_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sub key name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*sub_key_offset = safe_sub_key_offset;
+
+				return( 1 );
+			}
+			safe_sub_key_offset = next_key_offset;
+
+			recursion_depth++;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the sub key offset for the specific UTF-16 encoded name
+ * The key hierarchy entries of the sub keys are filtered by name hash before their name is compared
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libcreg_key_navigation_get_sub_key_offset_by_utf16_name(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	static char *function         = "libcreg_key_navigation_get_sub_key_offset_by_utf16_name";
+	uint32_t first_sub_key_offset = 0;
+	uint32_t name_hash            = 0;
+	uint32_t next_key_offset      = 0;
+	uint32_t safe_sub_key_offset  = 0;
+	int recursion_depth           = 0;
+	int result                    = 0;
+	int use_stored_name_hash      = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		name_hash = 0;
+	}
+	if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+	     key_navigation,
+	     file_io_handle,
+	     (off64_t) key_offset,
+	     &key_hierarchy_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		return( -1 );
+	}
+	first_sub_key_offset = key_hierarchy_entry.sub_key_offset;
+
+	/* The sub keys are first filtered by the name hash stored in their key hierarchy entry.
+	 * The stored name hash is not guaranteed to be correct, hence if no sub key matched
+	 * and stored name hashes were found not to match their key name, the names of all
+	 * the sub keys are compared
+	 */
+	for( use_stored_name_hash = 1;
+	     use_stored_name_hash >= 0;
+	     use_stored_name_hash-- )
+	{
+		if( use_stored_name_hash == 0 )
+		{
+			if( name_hash == 0 )
+			{
+				break;
+			}
+			result = libcreg_key_navigation_has_name_hash_mismatch(
+			          key_navigation,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if there is a name hash mismatch.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		safe_sub_key_offset = first_sub_key_offset;
+		recursion_depth     = 0;
+
+		while( ( safe_sub_key_offset != 0 )
+		    && ( safe_sub_key_offset != 0xffffffffUL ) )
+		{
+			if( recursion_depth > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid recursion depth value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     key_navigation,
+			     file_io_handle,
+			     (off64_t) safe_sub_key_offset,
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 safe_sub_key_offset,
+				 safe_sub_key_offset );
+
+				return( -1 );
+			}
+			next_key_offset = key_hierarchy_entry.next_key_offset;
+
+			result = libcreg_key_navigation_compare_key_name_with_utf16_string(
+			          key_navigation,
+			          file_io_handle,
+			          &key_hierarchy_entry,
+			          name_hash,
+			          use_stored_name_hash,
+			          utf16_string,
+			          utf16_string_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare sub key name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*sub_key_offset = safe_sub_key_offset;
+
+				return( 1 );
+			}
+			safe_sub_key_offset = next_key_offset;
+
+			recursion_depth++;
+		}
+	}
+	return( 0 );
+}
+
+/* Builds the path index
+ * The key hierarchy is walked once starting at the root key
+ * Keys without a key name entry are not indexed, since they cannot be retrieved by path
+ * Keys with a name that cannot be decoded are skipped together with their sub keys
+ * and keys that are reachable by way of more than one parent are indexed only once
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_build_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_data_block_t *data_block                 = NULL;
+	libcreg_key_name_entry_t *key_name_entry         = NULL;
+	libcreg_name_hash_table_t *key_offset_hash_table = NULL;
+	libcreg_path_index_t *path_index                 = NULL;
+	static char *function                            = "libcreg_key_navigation_build_path_index";
+	size64_t maximum_number_of_entries               = 0;
+	uint32_t next_key_offset                         = 0;
+	uint32_t path_hash                               = 0;
+	uint32_t sub_key_offset                          = 0;
+	int entry_index                                  = 0;
+	int indexed_entry_index                          = 0;
+	int parent_entry_index                           = 0;
+	int probe_index                                  = 0;
+	int recursion_depth                              = 0;
+	int result                                       = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->path_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key navigation - path index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every key is stored in a separate key hierarchy entry, which bounds the number of entries
+	 * and prevents a loop in the key hierarchy from being followed indefinitely
+	 */
+	maximum_number_of_entries = ( key_navigation->key_hierarchy_data_size / sizeof( creg_key_hierarchy_entry_t ) ) + 1;
+
+	if( maximum_number_of_entries > (size64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of entries value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_path_index_initialize(
+	     &path_index,
+	     (int) maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The key offsets that were indexed are tracked to detect keys that are reachable
+	 * by way of more than one parent
+	 */
+	if( libcreg_name_hash_table_initialize(
+	     &key_offset_hash_table,
+	     (int) maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key offset hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_path_index_append_entry(
+	     path_index,
+	     root_key_offset,
+	     -1,
+	     0,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root key to path index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_name_hash_table_insert_entry(
+	     key_offset_hash_table,
+	     root_key_offset,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert root key into key offset hash table.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries are appended breadth first, hence every entry is processed once
+	 * after all the entries before it, including its parent, have been appended
+	 */
+	for( parent_entry_index = 0;
+	     parent_entry_index < path_index->number_of_entries;
+	     parent_entry_index++ )
+	{
+		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+		     key_navigation,
+		     file_io_handle,
+		     (off64_t) path_index->key_offsets[ parent_entry_index ],
+		     &key_hierarchy_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 path_index->key_offsets[ parent_entry_index ],
+			 path_index->key_offsets[ parent_entry_index ] );
+
+			goto on_error;
+		}
+		sub_key_offset  = key_hierarchy_entry.sub_key_offset;
+		recursion_depth = 0;
+
+		while( ( sub_key_offset != 0 )
+		    && ( sub_key_offset != 0xffffffffUL ) )
+		{
+			/* The remainder of a sub keys list that exceeds the recursion depth is not indexed
+			 */
+			if( recursion_depth > LIBCREG_MAXIMUM_SUB_KEY_RECURSION_DEPTH )
+			{
+				break;
+			}
+			/* A sub key that was already indexed is part of a sub keys list that is shared
+			 * with another parent or that loops, hence the remainder of the list was already indexed
+			 */
+			probe_index = 0;
+
+			do
+			{
+				result = libcreg_name_hash_table_get_next_entry_index(
+				          key_offset_hash_table,
+				          sub_key_offset,
+				          &probe_index,
+				          &indexed_entry_index,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve next entry index from key offset hash table.",
+					 function );
+
+					goto on_error;
+				}
+				else if( ( result != 0 )
+				      && ( path_index->key_offsets[ indexed_entry_index ] == sub_key_offset ) )
+				{
+					break;
+				}
+			}
+			while( result != 0 );
+
+			if( result != 0 )
+			{
+				break;
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     key_navigation,
+			     file_io_handle,
+			     (off64_t) sub_key_offset,
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 sub_key_offset,
+				 sub_key_offset );
+
+				goto on_error;
+			}
+			next_key_offset = key_hierarchy_entry.next_key_offset;
+
+			key_name_entry = NULL;
+
+			result = libcreg_key_navigation_get_key_name_entry(
+			          key_navigation,
+			          file_io_handle,
+			          &key_hierarchy_entry,
+			          &data_block,
+			          &key_name_entry,
+			          error );
+
+			if( ( result == 1 )
+			 && ( key_name_entry != NULL )
+			 && ( key_name_entry->name != NULL ) )
+			{
+				result = libcreg_path_index_calculate_path_hash_from_byte_stream(
+				          &path_hash,
+				          path_index->path_hashes[ parent_entry_index ],
+				          key_name_entry->name,
+				          (size_t) key_name_entry->name_size,
+				          key_navigation->io_handle->ascii_codepage,
+				          error );
+			}
+			if( result == -1 )
+			{
+				/* The key and its sub keys are not indexed, they are retrieved by
+				 * resolving the path segment by segment instead
+				 */
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to index key at offset: %" PRIu32 " (0x%08" PRIx32 ").\n",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else if( ( result != 0 )
+			      && ( key_name_entry != NULL )
+			      && ( key_name_entry->name != NULL ) )
+			{
+				if( libcreg_path_index_append_entry(
+				     path_index,
+				     sub_key_offset,
+				     parent_entry_index,
+				     path_hash,
+				     &entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append key at offset: %" PRIu32 " (0x%08" PRIx32 ") to path index.",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					goto on_error;
+				}
+				if( libcreg_name_hash_table_insert_entry(
+				     key_offset_hash_table,
+				     sub_key_offset,
+				     entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert key at offset: %" PRIu32 " (0x%08" PRIx32 ") into key offset hash table.",
+					 function,
+					 sub_key_offset,
+					 sub_key_offset );
+
+					goto on_error;
+				}
+			}
+			if( libcreg_data_block_release_reference(
+			     &data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release data block.",
+				 function );
+
+				goto on_error;
+			}
+			sub_key_offset = next_key_offset;
+
+			recursion_depth++;
+		}
+	}
+	if( libcreg_name_hash_table_free(
+	     &key_offset_hash_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key offset hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_path_index_build_hash_tables(
+	     path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build path index hash tables.",
+		 function );
+
+		goto on_error;
+	}
+	key_navigation->path_index = path_index;
+
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libcreg_data_block_release_reference(
+		 &data_block,
+		 NULL );
+	}
+	if( key_offset_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &key_offset_hash_table,
+		 NULL );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the sub key offset for the specific UTF-8 encoded path using the path index
+ * The path separator is the \ character
+ * The path index must contain the key
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libcreg_key_navigation_get_sub_key_offset_by_utf8_path_from_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int key_entry_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	const uint8_t *utf8_string_segment           = NULL;
+	static char *function                        = "libcreg_key_navigation_get_sub_key_offset_by_utf8_path_from_path_index";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_segment_length            = 0;
+	size_t utf8_string_segment_index             = 0;
+	uint32_t key_offset                          = 0;
+	uint32_t path_hash                           = 0;
+	int ancestor_entry_index                     = 0;
+	int ancestor_depth                           = 0;
+	int entry_index                              = 0;
+	int number_of_segments                       = 0;
+	int probe_index                              = 0;
+	int result                                   = 0;
+	int segment_index                            = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_path_index_get_entry_values(
+	     key_navigation->path_index,
+	     key_entry_index,
+	     &key_offset,
+	     &ancestor_entry_index,
+	     &path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path index entry: %d values.",
+		 function,
+		 key_entry_index );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBCREG_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	utf8_string_segment_index = utf8_string_index;
+
+	/* Determine the path hash of the sub key in the same way the path index was built
+	 */
+	while( utf8_string_index < utf8_string_length )
+	{
+		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = utf8_string_index;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf8_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+		if( utf8_string_segment_length == 0 )
+		{
+			return( 0 );
+		}
+		if( libcreg_path_index_calculate_path_hash_from_utf8_string(
+		     &path_hash,
+		     path_hash,
+		     utf8_string_segment,
+		     utf8_string_segment_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate path hash.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+	}
+	if( number_of_segments == 0 )
+	{
+		*sub_key_offset = key_offset;
+
+		return( 1 );
+	}
+	/* Verify the candidates by comparing the name of every key on the path with the corresponding segment
+	 */
+	do
+	{
+		result = libcreg_path_index_get_next_entry_index_by_path_hash(
+		          key_navigation->path_index,
+		          path_hash,
+		          &probe_index,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next path index entry by path hash.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		ancestor_entry_index = entry_index;
+
+		for( ancestor_depth = 0;
+		     ancestor_depth < number_of_segments;
+		     ancestor_depth++ )
+		{
+			if( ancestor_entry_index == -1 )
+			{
+				break;
+			}
+			ancestor_entry_index = key_navigation->path_index->parent_entry_indexes[ ancestor_entry_index ];
+		}
+		if( ( ancestor_entry_index == -1 )
+		 || ( key_navigation->path_index->key_offsets[ ancestor_entry_index ] != key_offset ) )
+		{
+			continue;
+		}
+		utf8_string_index = utf8_string_segment_index;
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+			utf8_string_segment_length = utf8_string_index;
+
+			while( utf8_string_index < utf8_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf8(
+				     &unicode_character,
+				     utf8_string,
+				     utf8_string_length,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					utf8_string_segment_length += 1;
+
+					break;
+				}
+			}
+			utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+			ancestor_entry_index = entry_index;
+
+			for( ancestor_depth = number_of_segments - 1;
+			     ancestor_depth > segment_index;
+			     ancestor_depth-- )
+			{
+				ancestor_entry_index = key_navigation->path_index->parent_entry_indexes[ ancestor_entry_index ];
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     key_navigation,
+			     file_io_handle,
+			     (off64_t) key_navigation->path_index->key_offsets[ ancestor_entry_index ],
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_navigation->path_index->key_offsets[ ancestor_entry_index ],
+				 key_navigation->path_index->key_offsets[ ancestor_entry_index ] );
+
+				return( -1 );
+			}
+			result = libcreg_key_navigation_compare_key_name_with_utf8_string(
+			          key_navigation,
+			          file_io_handle,
+			          &key_hierarchy_entry,
+			          0,
+			          0,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( result != 0 )
+		{
+			*sub_key_offset = key_navigation->path_index->key_offsets[ entry_index ];
+
+			return( 1 );
+		}
+		/* Continue with the next candidate
+		 */
+		result = 1;
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the sub key offset for the specific UTF-16 encoded path using the path index
+ * The path separator is the \ character
+ * The path index must contain the key
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libcreg_key_navigation_get_sub_key_offset_by_utf16_path_from_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int key_entry_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	const uint16_t *utf16_string_segment         = NULL;
+	static char *function                        = "libcreg_key_navigation_get_sub_key_offset_by_utf16_path_from_path_index";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf16_string_segment_length           = 0;
+	size_t utf16_string_segment_index            = 0;
+	uint32_t key_offset                          = 0;
+	uint32_t path_hash                           = 0;
+	int ancestor_entry_index                     = 0;
+	int ancestor_depth                           = 0;
+	int entry_index                              = 0;
+	int number_of_segments                       = 0;
+	int probe_index                              = 0;
+	int result                                   = 0;
+	int segment_index                            = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_path_index_get_entry_values(
+	     key_navigation->path_index,
+	     key_entry_index,
+	     &key_offset,
+	     &ancestor_entry_index,
+	     &path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path index entry: %d values.",
+		 function,
+		 key_entry_index );
+
+		return( -1 );
+	}
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBCREG_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
+	}
+	utf16_string_segment_index = utf16_string_index;
+
+	/* Determine the path hash of the sub key in the same way the path index was built
+	 */
+	while( utf16_string_index < utf16_string_length )
+	{
+		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+		if( utf16_string_segment_length == 0 )
+		{
+			return( 0 );
+		}
+		if( libcreg_path_index_calculate_path_hash_from_utf16_string(
+		     &path_hash,
+		     path_hash,
+		     utf16_string_segment,
+		     utf16_string_segment_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate path hash.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+	}
+	if( number_of_segments == 0 )
+	{
+		*sub_key_offset = key_offset;
+
+		return( 1 );
+	}
+	/* Verify the candidates by comparing the name of every key on the path with the corresponding segment
+	 */
+	do
+	{
+		result = libcreg_path_index_get_next_entry_index_by_path_hash(
+		          key_navigation->path_index,
+		          path_hash,
+		          &probe_index,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next path index entry by path hash.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		ancestor_entry_index = entry_index;
+
+		for( ancestor_depth = 0;
+		     ancestor_depth < number_of_segments;
+		     ancestor_depth++ )
+		{
+			if( ancestor_entry_index == -1 )
+			{
+				break;
+			}
+			ancestor_entry_index = key_navigation->path_index->parent_entry_indexes[ ancestor_entry_index ];
+		}
+		if( ( ancestor_entry_index == -1 )
+		 || ( key_navigation->path_index->key_offsets[ ancestor_entry_index ] != key_offset ) )
+		{
+			continue;
+		}
+		utf16_string_index = utf16_string_segment_index;
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+			utf16_string_segment_length = utf16_string_index;
+
+			while( utf16_string_index < utf16_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf16(
+				     &unicode_character,
+				     utf16_string,
+				     utf16_string_length,
+				     &utf16_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					utf16_string_segment_length += 1;
+
+					break;
+				}
+			}
+			utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+			ancestor_entry_index = entry_index;
+
+			for( ancestor_depth = number_of_segments - 1;
+			     ancestor_depth > segment_index;
+			     ancestor_depth-- )
+			{
+				ancestor_entry_index = key_navigation->path_index->parent_entry_indexes[ ancestor_entry_index ];
+			}
+			if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+			     key_navigation,
+			     file_io_handle,
+			     (off64_t) key_navigation->path_index->key_offsets[ ancestor_entry_index ],
+			     &key_hierarchy_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_navigation->path_index->key_offsets[ ancestor_entry_index ],
+				 key_navigation->path_index->key_offsets[ ancestor_entry_index ] );
+
+				return( -1 );
+			}
+			result = libcreg_key_navigation_compare_key_name_with_utf16_string(
+			          key_navigation,
+			          file_io_handle,
+			          &key_hierarchy_entry,
+			          0,
+			          0,
+			          utf16_string_segment,
+			          utf16_string_segment_length,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( result != 0 )
+		{
+			*sub_key_offset = key_navigation->path_index->key_offsets[ entry_index ];
+
+			return( 1 );
+		}
+		/* Continue with the next candidate
+		 */
+		result = 1;
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Empties the offset path cache
+ * The offset path cache is created again on the next path lookup by key offset
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_empty_offset_path_cache(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_navigation_empty_offset_path_cache";
+	int result            = 1;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->offset_path_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offset path cache mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( key_navigation->offset_path_cache != NULL )
+	{
+		if( libcreg_offset_path_cache_free(
+		     &( key_navigation->offset_path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset path cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->offset_path_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offset path cache mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded path of the key at a specific offset
+ * The path is determined by following the parent key offsets up to the root key
+ * or to the nearest ancestor of which the path was determined before
+ * The path starts with a separator and the root key has the path "\"
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_get_utf8_path_by_key_offset(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     uint8_t **utf8_path,
+     size_t *utf8_path_size,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+	uint32_t ancestor_key_offsets[ LIBCREG_MAXIMUM_KEY_PATH_DEPTH ];
+
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	const uint8_t *cached_utf8_path          = NULL;
+	uint8_t *safe_utf8_path                  = NULL;
+	static char *function                    = "libcreg_key_navigation_get_utf8_path_by_key_offset";
+	size_t cached_utf8_path_length           = 0;
+	size_t name_size                         = 0;
+	size_t safe_utf8_path_length             = 0;
+	size_t safe_utf8_path_size               = 0;
+	uint32_t current_key_offset              = 0;
+	uint32_t parent_key_offset               = 0;
+	uint32_t root_key_offset                 = 0;
+	int ancestor_index                       = 0;
+	int number_of_ancestors                  = 0;
+	int result                               = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid UTF-8 path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The offset path cache is shared by all keys of the file
+	 */
+	if( libcthreads_mutex_grab(
+	     key_navigation->offset_path_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offset path cache mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( key_navigation->offset_path_cache == NULL )
+	{
+		if( libcreg_offset_path_cache_initialize(
+		     &( key_navigation->offset_path_cache ),
+		     LIBCREG_MAXIMUM_CACHE_ENTRIES_KEY_PATHS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create offset path cache.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	}
+	/* Collect the offsets of the ancestors of which the path is not cached
+	 * and determine the size of the path
+	 */
+	current_key_offset = key_offset;
+
+	while( current_key_offset != 0 )
+	{
+		result = libcreg_offset_path_cache_get_utf8_path(
+		          key_navigation->offset_path_cache,
+		          current_key_offset,
+		          &cached_utf8_path,
+		          &cached_utf8_path_length,
+		          error );
+
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "%s: reading data block: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached path of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
 			 function,
-			 data_block_index,
-			 file_offset,
-			 file_offset );
+			 current_key_offset,
+			 current_key_offset );
+
+			goto on_error;
 		}
-#endif
-		result = libcreg_data_block_read_header(
-		          data_block,
+		else if( result != 0 )
+		{
+			break;
+		}
+		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+		     key_navigation,
+		     file_io_handle,
+		     (off64_t) current_key_offset,
+		     &key_hierarchy_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 current_key_offset,
+			 current_key_offset );
+
+			goto on_error;
+		}
+		parent_key_offset = key_hierarchy_entry.parent_key_offset;
+
+		/* The root key has no parent and does not contribute a path segment
+		 */
+		if( ( parent_key_offset == 0 )
+		 || ( parent_key_offset == 0xffffffffUL ) )
+		{
+			root_key_offset = current_key_offset;
+
+			break;
+		}
+		if( number_of_ancestors >= LIBCREG_MAXIMUM_KEY_PATH_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of ancestors value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		key_name_entry = NULL;
+
+		result = libcreg_key_navigation_get_key_name_entry(
+		          key_navigation,
 		          file_io_handle,
-		          file_offset,
+		          &key_hierarchy_entry,
+		          &data_block,
+		          &key_name_entry,
 		          error );
 
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data block header.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key name entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 current_key_offset,
+			 current_key_offset );
 
 			goto on_error;
 		}
-		else if( result == 0 )
+		else if( ( result != 0 )
+		      && ( key_name_entry != NULL )
+		      && ( key_name_entry->name != NULL )
+		      && ( key_name_entry->name_size > 0 ) )
 		{
-/* TODO mark file as corrupted */
-			if( data_block_index != 0 )
+			if( libcreg_key_name_entry_get_utf8_name_size(
+			     key_name_entry,
+			     &name_size,
+			     key_navigation->io_handle->ascii_codepage,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: missing data block at offset: %" PRIi64 ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 name size of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
 				 function,
-				 file_offset );
+				 current_key_offset,
+				 current_key_offset );
 
 				goto on_error;
 			}
+			if( name_size > 1 )
+			{
+				safe_utf8_path_length += name_size - 1;
+			}
 		}
-		else
+		if( libcreg_data_block_release_reference(
+		     &data_block,
+		     error ) != 1 )
 		{
-			if( data_block->size == 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: invalid data block: %d size.",
-				 function,
-				 data_block_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
 
-				goto on_error;
-			}
-			if( libfdata_list_append_element(
-			     key_navigation->data_blocks_list,
-			     &data_block_index,
-			     0,
-			     (off64_t) data_block->offset,
-			     (size64_t) data_block->size,
-			     0,
+			goto on_error;
+		}
+		/* Add the size of the separator
+		 */
+		safe_utf8_path_length += 1;
+
+		ancestor_key_offsets[ number_of_ancestors++ ] = current_key_offset;
+
+		current_key_offset = parent_key_offset;
+	}
+	safe_utf8_path_length += cached_utf8_path_length;
+
+	/* The end of string character and the separator of the root key path
+	 */
+	safe_utf8_path_size = safe_utf8_path_length + 2;
+
+	if( safe_utf8_path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 path size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	safe_utf8_path = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * safe_utf8_path_size );
+
+	if( safe_utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cached path is copied before the cache is modified
+	 */
+	safe_utf8_path_length = cached_utf8_path_length;
+
+	if( cached_utf8_path_length > 0 )
+	{
+		if( memory_copy(
+		     safe_utf8_path,
+		     cached_utf8_path,
+		     sizeof( uint8_t ) * cached_utf8_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( root_key_offset != 0 )
+	{
+		if( libcreg_offset_path_cache_set_utf8_path(
+		     key_navigation->offset_path_cache,
+		     root_key_offset,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached path of root key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Append the names of the ancestors starting with the one nearest to the root key
+	 * and cache the path of every ancestor, so that the paths of its sub keys can be
+	 * determined without following the parent key offsets again
+	 */
+	for( ancestor_index = number_of_ancestors - 1;
+	     ancestor_index >= 0;
+	     ancestor_index-- )
+	{
+		current_key_offset = ancestor_key_offsets[ ancestor_index ];
+
+		if( libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
+		     key_navigation,
+		     file_io_handle,
+		     (off64_t) current_key_offset,
+		     &key_hierarchy_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 current_key_offset,
+			 current_key_offset );
+
+			goto on_error;
+		}
+		safe_utf8_path[ safe_utf8_path_length++ ] = (uint8_t) LIBCREG_SEPARATOR;
+
+		key_name_entry = NULL;
+
+		result = libcreg_key_navigation_get_key_name_entry(
+		          key_navigation,
+		          file_io_handle,
+		          &key_hierarchy_entry,
+		          &data_block,
+		          &key_name_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key name entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 current_key_offset,
+			 current_key_offset );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( key_name_entry != NULL )
+		      && ( key_name_entry->name != NULL )
+		      && ( key_name_entry->name_size > 0 ) )
+		{
+			if( libcreg_key_name_entry_get_utf8_name_size(
+			     key_name_entry,
+			     &name_size,
+			     key_navigation->io_handle->ascii_codepage,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append data block: %d to data list.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 name size of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
 				 function,
-				 data_block_index );
+				 current_key_offset,
+				 current_key_offset );
 
 				goto on_error;
 			}
-			file_offset += data_block->size;
+			if( ( name_size > 1 )
+			 && ( name_size <= ( safe_utf8_path_size - safe_utf8_path_length ) ) )
+			{
+				if( libcreg_key_name_entry_get_utf8_name(
+				     key_name_entry,
+				     &( safe_utf8_path[ safe_utf8_path_length ] ),
+				     name_size,
+				     key_navigation->io_handle->ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 name of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 current_key_offset,
+					 current_key_offset );
+
+					goto on_error;
+				}
+				safe_utf8_path_length += name_size - 1;
+			}
 		}
-		if( libcreg_data_block_free(
+		if( libcreg_data_block_release_reference(
 		     &data_block,
 		     error ) != 1 )
 		{
@@ -666,148 +4935,332 @@ int libcreg_key_navigation_read_data_blocks(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data block.",
+			 "%s: unable to release data block.",
 			 function );
 
-			goto on_error;
-		}
-		if( result == 0 )
-		{
-			break;
-		}
-		data_block_index++;
+			goto on_error;
+		}
+		if( libcreg_offset_path_cache_set_utf8_path(
+		     key_navigation->offset_path_cache,
+		     current_key_offset,
+		     safe_utf8_path,
+		     safe_utf8_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached path of key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 current_key_offset,
+			 current_key_offset );
+
+			goto on_error;
+		}
+	}
+	if( safe_utf8_path_length == 0 )
+	{
+		safe_utf8_path[ safe_utf8_path_length++ ] = (uint8_t) LIBCREG_SEPARATOR;
+	}
+	safe_utf8_path[ safe_utf8_path_length++ ] = 0;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->offset_path_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offset path cache mutex.",
+		 function );
+
+		memory_free(
+		 safe_utf8_path );
+
+		return( -1 );
+	}
+#endif
+	*utf8_path      = safe_utf8_path;
+	*utf8_path_size = safe_utf8_path_length;
+
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libcreg_data_block_release_reference(
+		 &data_block,
+		 NULL );
+	}
+	if( safe_utf8_path != NULL )
+	{
+		memory_free(
+		 safe_utf8_path );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 key_navigation->offset_path_cache_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads a data block
+ * The header and entries are read from the read-ahead window if the data block fits
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_navigation_read_data_block(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t data_block_size,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *safe_data_block = NULL;
+	const uint8_t *data                   = NULL;
+	static char *function                 = "libcreg_key_navigation_read_data_block";
+	int result                            = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_navigation->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key navigation - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_block_size < (size64_t) sizeof( creg_data_block_header_t ) )
+	 || ( data_block_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( key_navigation->data_blocks_cache ),
-	     LIBCREG_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_data_block_initialize(
+	     &safe_data_block,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data blocks cache.",
+		 "%s: unable to create data block.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( data_block_index == 0 )
-	 && ( result == 0 ) )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		return( 0 );
+		libcnotify_printf(
+		 "%s: reading data block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
 	}
-	return( 1 );
-
-on_error:
-	if( data_block != NULL )
+#endif
+	/* The data retrieved from the read-ahead buffer remains valid while the mutex is grabbed
+	 */
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->read_ahead_buffer_mutex,
+	     error ) != 1 )
 	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead buffer mutex.",
+		 function );
+
 		libcreg_data_block_free(
-		 &data_block,
+		 &safe_data_block,
 		 NULL );
+
+		return( -1 );
 	}
-	if( key_navigation->data_blocks_list != NULL )
+#endif
+	if( key_navigation->read_ahead_buffer != NULL )
 	{
-		libfdata_list_free(
-		 &( key_navigation->data_blocks_list ),
-		 NULL );
-	}
-	return( -1 );
-}
+		result = libcreg_read_ahead_buffer_get_data_at_offset(
+		          key_navigation->read_ahead_buffer,
+		          file_io_handle,
+		          file_offset,
+		          (size_t) data_block_size,
+		          &data,
+		          error );
 
-/* Retrieves the key hierarchy entry at a specific offset
- * Returns 1 if successful or -1 on error
- */
-int libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
-     libcreg_key_navigation_t *key_navigation,
-     libbfio_handle_t *file_io_handle,
-     off64_t key_hierarchy_entry_offset,
-     libcreg_key_hierarchy_entry_t **key_hierarchy_entry,
-     libcerror_error_t **error )
-{
-	static char *function = "libcreg_key_navigation_get_key_hierarchy_entry_at_offset";
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block data.",
+			 function );
 
-	if( key_navigation == NULL )
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		safe_data_block->offset = file_offset;
+
+		result = libcreg_data_block_read_header_data(
+		          safe_data_block,
+		          data,
+		          (size_t) data_block_size,
+		          error );
+	}
+	else
+	{
+		result = libcreg_data_block_read_header(
+		          safe_data_block,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key navigation.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block header.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfdata_area_get_element_value_at_offset(
-	     key_navigation->key_hierarchy_area,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) key_navigation->key_hierarchy_cache,
-	     key_hierarchy_entry_offset,
-	     (intptr_t **) key_hierarchy_entry,
-	     0,
-	     error ) != 1 )
+	if( (size64_t) safe_data_block->size != data_block_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve key hierarchy entry at offset: 0x%08" PRIx64 ".",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in data block size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
 		 function,
-		 key_hierarchy_entry_offset );
+		 safe_data_block->size,
+		 data_block_size );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
-
-/* Retrieves the number of data blocks
- * Returns 1 if successful or -1 on error
- */
-int libcreg_key_navigation_get_number_of_data_blocks(
-     libcreg_key_navigation_t *key_navigation,
-     int *number_of_data_blocks,
-     libcerror_error_t **error )
-{
-	static char *function = "libcreg_key_navigation_get_number_of_data_blocks";
-
-	if( key_navigation == NULL )
+	if( data != NULL )
+	{
+		result = libcreg_data_block_read_entries_data(
+		          safe_data_block,
+		          &( data[ sizeof( creg_data_block_header_t ) ] ),
+		          (size_t) data_block_size - sizeof( creg_data_block_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libcreg_data_block_read_entries(
+		          safe_data_block,
+		          file_io_handle,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key navigation.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key name entries.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfdata_list_get_number_of_elements(
-	     key_navigation->data_blocks_list,
-	     number_of_data_blocks,
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->read_ahead_buffer_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data blocks list elements.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead buffer mutex.",
 		 function );
 
+		libcreg_data_block_free(
+		 &safe_data_block,
+		 NULL );
+
 		return( -1 );
 	}
+#endif
+	*data_block = safe_data_block;
+
 	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 key_navigation->read_ahead_buffer_mutex,
+	 NULL );
+#endif
+	if( safe_data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &safe_data_block,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific data block
+/* Reads a key hierarchy entry
+ * Callback function for the key hierarchy area
  * Returns 1 if successful or -1 on error
  */
-int libcreg_key_navigation_get_data_block_at_index(
+int libcreg_key_navigation_read_key_hierarchy_entry_element_data(
      libcreg_key_navigation_t *key_navigation,
      libbfio_handle_t *file_io_handle,
-     int data_block_index,
-     libcreg_data_block_t **data_block,
+     libfdata_area_t *area,
+     libfdata_cache_t *cache,
+     off64_t element_value_offset,
+     int element_data_file_index,
+     off64_t element_data_offset,
+     size64_t element_data_size,
+     uint32_t element_data_flags,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libcreg_key_navigation_get_data_block_at_index";
+	static char *function = "libcreg_key_navigation_read_key_hierarchy_entry_element_data";
+	int shard_index       = 0;
 
 	if( key_navigation == NULL )
 	{
@@ -820,22 +5273,48 @@ int libcreg_key_navigation_get_data_block_at_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     key_navigation->data_blocks_list,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) key_navigation->data_blocks_cache,
-	     data_block_index,
-	     (intptr_t **) data_block,
-	     0,
+	if( key_navigation->key_hierarchy_cache != NULL )
+	{
+		/* The shard of the key hierarchy entry was grabbed by the caller
+		 */
+		if( libcreg_sharded_cache_get_shard_index(
+		     key_navigation->key_hierarchy_cache,
+		     (uint64_t) element_value_offset,
+		     &shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy cache shard index.",
+			 function );
+
+			return( -1 );
+		}
+		key_navigation->key_hierarchy_cache->shards[ shard_index ].number_of_misses += 1;
+	}
+	if( libcreg_io_handle_read_key_hierarchy_entry(
+	     (intptr_t *) key_navigation->io_handle,
+	     file_io_handle,
+	     area,
+	     cache,
+	     element_value_offset,
+	     element_data_file_index,
+	     element_data_offset,
+	     element_data_size,
+	     element_data_flags,
+	     read_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data block: %d.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key hierarchy entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 data_block_index );
+		 element_data_offset,
+		 element_data_offset );
 
 		return( -1 );
 	}
@@ -844,10 +5323,13 @@ int libcreg_key_navigation_get_data_block_at_index(
 
 /* Reads a data block
  * Callback function for the data blocks list
+ * A data block that was loaded ahead of its retrieval is used instead of reading it
+ * The data blocks cache holds a reference to the data block that is released when
+ * the data block is evicted
  * Returns 1 if successful or -1 on error
  */
 int libcreg_key_navigation_read_data_block_element_data(
-     libcreg_io_handle_t *io_handle,
+     libcreg_key_navigation_t *key_navigation,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *list_element,
      libfdata_cache_t *cache,
@@ -858,87 +5340,143 @@ int libcreg_key_navigation_read_data_block_element_data(
      uint8_t read_flags LIBCREG_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
-	libcreg_data_block_t *data_block = NULL;
-	static char *function            = "libcreg_key_navigation_read_data_block_element_data";
+	libcreg_data_block_t *data_block        = NULL;
+	libcreg_data_block_t *loaded_data_block = NULL;
+	static char *function                   = "libcreg_key_navigation_read_data_block_element_data";
+	int data_block_index                    = 0;
+	int shard_index                         = 0;
 
 	LIBCREG_UNREFERENCED_PARAMETER( data_range_file_index )
 	LIBCREG_UNREFERENCED_PARAMETER( data_range_flags )
 	LIBCREG_UNREFERENCED_PARAMETER( read_flags )
 
-	if( io_handle == NULL )
+	if( key_navigation == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid key navigation.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcreg_data_block_initialize(
-	     &data_block,
+	if( libfdata_list_element_get_element_index(
+	     list_element,
+	     &data_block_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element index from data blocks list element.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( data_block_index < 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading data block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 data_range_offset,
-		 data_range_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block index value out of bounds.",
+		 function );
+
+		goto on_error;
 	}
-#endif
-	if( libcreg_data_block_read_header(
-	     data_block,
-	     file_io_handle,
-	     data_range_offset,
+	if( key_navigation->data_blocks_cache != NULL )
+	{
+		/* The shard of the data block was grabbed by the caller
+		 */
+		if( libcreg_sharded_cache_get_shard_index(
+		     key_navigation->data_blocks_cache,
+		     (uint64_t) data_block_index,
+		     &shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data blocks cache shard index.",
+			 function );
+
+			goto on_error;
+		}
+		key_navigation->data_blocks_cache->shards[ shard_index ].number_of_misses += 1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_navigation->loaded_data_blocks_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data block header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab loaded data blocks mutex.",
 		 function );
 
 		goto on_error;
 	}
-	if( (size64_t) data_block->size != data_range_size )
+#endif
+	if( data_block_index < key_navigation->number_of_loaded_data_blocks )
+	{
+		loaded_data_block = key_navigation->loaded_data_blocks[ data_block_index ];
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_navigation->loaded_data_blocks_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: mismatch in data block size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
-		 function,
-		 data_block->size,
-		 data_range_size );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release loaded data blocks mutex.",
+		 function );
 
 		goto on_error;
 	}
-	if( libcreg_data_block_read_entries(
-	     data_block,
-	     file_io_handle,
-	     io_handle->ascii_codepage,
-	     error ) != 1 )
+#endif
+	if( loaded_data_block != NULL )
+	{
+		/* The loaded data blocks are only released when the key navigation is freed
+		 */
+		if( libcreg_data_block_grab_reference(
+		     loaded_data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to loaded data block: %d.",
+			 function,
+			 data_block_index );
+
+			goto on_error;
+		}
+		data_block = loaded_data_block;
+	}
+	else if( libcreg_key_navigation_read_data_block(
+	          key_navigation,
+	          file_io_handle,
+	          data_range_offset,
+	          data_range_size,
+	          &data_block,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read key name entries.",
-		 function );
+		 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_range_offset,
+		 data_range_offset );
 
 		goto on_error;
 	}
@@ -947,7 +5485,7 @@ int libcreg_key_navigation_read_data_block_element_data(
 	     (intptr_t *) file_io_handle,
 	     cache,
 	     (intptr_t *) data_block,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_data_block_free,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libcreg_data_block_release_reference,
 	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
@@ -965,7 +5503,7 @@ int libcreg_key_navigation_read_data_block_element_data(
 on_error:
 	if( data_block != NULL )
 	{
-		libcreg_data_block_free(
+		libcreg_data_block_release_reference(
 		 &data_block,
 		 NULL );
 	}
@@ -28,10 +28,17 @@
 #include "libcreg_data_block.h"
 #include "libcreg_io_handle.h"
 #include "libcreg_key_hierarchy_entry.h"
+#include "libcreg_key_hierarchy_table.h"
+#include "libcreg_key_name_entry.h"
 #include "libcreg_libbfio.h"
 #include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
 #include "libcreg_libfcache.h"
 #include "libcreg_libfdata.h"
+#include "libcreg_offset_path_cache.h"
+#include "libcreg_path_index.h"
+#include "libcreg_read_ahead_buffer.h"
+#include "libcreg_sharded_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -50,16 +57,87 @@ struct libcreg_key_navigation
 	libfdata_area_t *key_hierarchy_area;
 
 	/* The key hierarchy cache
+	 * The cache is sharded by key hierarchy entry offset
 	 */
-	libfcache_cache_t *key_hierarchy_cache;
+	libcreg_sharded_cache_t *key_hierarchy_cache;
+
+	/* The key hierarchy data offset
+	 */
+	off64_t key_hierarchy_data_offset;
+
+	/* The key hierarchy data size
+	 */
+	size64_t key_hierarchy_data_size;
+
+	/* The key hierarchy table
+	 * The table is created when all key hierarchy entries are read at once
+	 */
+	libcreg_key_hierarchy_table_t *key_hierarchy_table;
 
 	/* The data blocks list
 	 */
 	libfdata_list_t *data_blocks_list;
 
 	/* The data blocks cache
+	 * The cache is sharded by data block index
+	 */
+	libcreg_sharded_cache_t *data_blocks_cache;
+
+	/* The data blocks that were loaded ahead of their retrieval
+	 * The key navigation holds a reference to every loaded data block until it is freed
+	 */
+	libcreg_data_block_t **loaded_data_blocks;
+
+	/* The number of loaded data blocks entries
+	 */
+	int number_of_loaded_data_blocks;
+
+	/* The read-ahead buffer
+	 * The buffer is only created when a read-ahead window size is set
+	 */
+	libcreg_read_ahead_buffer_t *read_ahead_buffer;
+
+	/* The offset of the next data block to scan
+	 */
+	off64_t data_blocks_scan_offset;
+
+	/* The size of the data blocks scan, which is the file size
 	 */
-	libfcache_cache_t *data_blocks_cache;
+	size64_t data_blocks_scan_size;
+
+	/* The path index
+	 */
+	libcreg_path_index_t *path_index;
+
+	/* The key offset to path cache
+	 * The cache is created on the first path lookup by key offset
+	 */
+	libcreg_offset_path_cache_t *offset_path_cache;
+
+	/* Various flags
+	 */
+	uint8_t flags;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the data blocks list, the data blocks scan and the flags
+	 * The data blocks list is only modified by the data blocks scan, hence it does not
+	 * change after all data blocks were scanned
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that protects the offset path cache
+	 */
+	libcthreads_mutex_t *offset_path_cache_mutex;
+
+	/* The mutex that protects the read-ahead buffer
+	 * The mutex is grabbed after the read/write lock
+	 */
+	libcthreads_mutex_t *read_ahead_buffer_mutex;
+
+	/* The mutex that protects the loaded data blocks
+	 */
+	libcthreads_mutex_t *loaded_data_blocks_mutex;
+#endif
 };
 
 int libcreg_key_navigation_initialize(
@@ -76,6 +154,30 @@ int libcreg_key_navigation_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libcreg_key_navigation_set_read_ahead_size(
+     libcreg_key_navigation_t *key_navigation,
+     size_t read_ahead_size,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_read_data_block_header(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_data_block_t *data_block,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_initialize_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     off64_t file_offset,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_scan_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int data_block_index,
+     libcerror_error_t **error );
+
 int libcreg_key_navigation_read_data_blocks(
      libcreg_key_navigation_t *key_navigation,
      libbfio_handle_t *file_io_handle,
@@ -83,15 +185,39 @@ int libcreg_key_navigation_read_data_blocks(
      size64_t file_size,
      libcerror_error_t **error );
 
+int libcreg_key_navigation_resize_loaded_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     int number_of_data_blocks,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_run_data_block_loaders(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int number_of_data_blocks,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_load_data_blocks(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_read_key_hierarchy_table(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libcreg_key_navigation_get_key_hierarchy_entry_at_offset(
      libcreg_key_navigation_t *key_navigation,
      libbfio_handle_t *file_io_handle,
      off64_t key_hierarchy_entry_offset,
-     libcreg_key_hierarchy_entry_t **key_hierarchy_entry,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
      libcerror_error_t **error );
 
 int libcreg_key_navigation_get_number_of_data_blocks(
      libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
      int *number_of_data_blocks,
      libcerror_error_t **error );
 
@@ -102,8 +228,125 @@ int libcreg_key_navigation_get_data_block_at_index(
      libcreg_data_block_t **data_block,
      libcerror_error_t **error );
 
+int libcreg_key_navigation_get_key_name_entry(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     libcreg_data_block_t **data_block,
+     libcreg_key_name_entry_t **key_name_entry,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_compare_key_name_with_utf8_string(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     uint32_t name_hash,
+     int use_stored_name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_compare_key_name_with_utf16_string(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_entry_t *key_hierarchy_entry,
+     uint32_t name_hash,
+     int use_stored_name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_has_name_hash_mismatch(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_set_name_hash_mismatch(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_get_sub_key_offset_by_utf8_name(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_get_sub_key_offset_by_utf16_name(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_build_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_get_sub_key_offset_by_utf8_path_from_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int key_entry_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_get_sub_key_offset_by_utf16_path_from_path_index(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     int key_entry_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_empty_offset_path_cache(
+     libcreg_key_navigation_t *key_navigation,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_get_utf8_path_by_key_offset(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     uint8_t **utf8_path,
+     size_t *utf8_path_size,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_read_data_block(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t data_block_size,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error );
+
+int libcreg_key_navigation_read_key_hierarchy_entry_element_data(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     libfdata_area_t *area,
+     libfdata_cache_t *cache,
+     off64_t element_value_offset,
+     int element_data_file_index,
+     off64_t element_data_offset,
+     size64_t element_data_size,
+     uint32_t element_data_flags,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libcreg_key_navigation_read_data_block_element_data(
-     libcreg_io_handle_t *io_handle,
+     libcreg_key_navigation_t *key_navigation,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *list_element,
      libfdata_cache_t *cache,
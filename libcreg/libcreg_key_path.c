@@ -0,0 +1,248 @@
+/*
+ * Key path functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_definitions.h"
+#include "libcreg_key_path.h"
+#include "libcreg_libcdata.h"
+#include "libcreg_libcerror.h"
+
+/* Sets the UTF-8 string of a key path
+ * A leading separator is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_path_set_utf8_string(
+     libcreg_key_path_t *key_path,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int path_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_path_set_utf8_string";
+
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ 0 ] == (uint8_t) LIBCREG_SEPARATOR ) )
+	{
+		utf8_string        += 1;
+		utf8_string_length -= 1;
+	}
+	key_path->utf8_string        = utf8_string;
+	key_path->utf8_string_length = utf8_string_length;
+	key_path->path_index         = path_index;
+
+	return( 1 );
+}
+
+/* Compares two key paths
+ * The paths are compared byte by byte with the ASCII characters in upper case,
+ * which makes sure paths with a common parent path are adjacent when sorted
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libcreg_key_path_compare(
+     libcreg_key_path_t *first_key_path,
+     libcreg_key_path_t *second_key_path,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_path_compare";
+	size_t string_index   = 0;
+	uint8_t first_byte    = 0;
+	uint8_t second_byte   = 0;
+
+	if( first_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second key path.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < first_key_path->utf8_string_length )
+	    && ( string_index < second_key_path->utf8_string_length ) )
+	{
+		first_byte  = first_key_path->utf8_string[ string_index ];
+		second_byte = second_key_path->utf8_string[ string_index ];
+
+		if( ( first_byte >= (uint8_t) 'a' )
+		 && ( first_byte <= (uint8_t) 'z' ) )
+		{
+			first_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( ( second_byte >= (uint8_t) 'a' )
+		 && ( second_byte <= (uint8_t) 'z' ) )
+		{
+			second_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( first_byte < second_byte )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( first_byte > second_byte )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+		string_index++;
+	}
+	if( first_key_path->utf8_string_length < second_key_path->utf8_string_length )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_key_path->utf8_string_length > second_key_path->utf8_string_length )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the length of the common start of two key paths
+ * The paths are compared byte by byte with the ASCII characters in upper case
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_path_get_common_length(
+     libcreg_key_path_t *first_key_path,
+     libcreg_key_path_t *second_key_path,
+     size_t *common_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_path_get_common_length";
+	size_t string_index   = 0;
+	uint8_t first_byte    = 0;
+	uint8_t second_byte   = 0;
+
+	if( first_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( common_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid common length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < first_key_path->utf8_string_length )
+	    && ( string_index < second_key_path->utf8_string_length ) )
+	{
+		first_byte  = first_key_path->utf8_string[ string_index ];
+		second_byte = second_key_path->utf8_string[ string_index ];
+
+		if( ( first_byte >= (uint8_t) 'a' )
+		 && ( first_byte <= (uint8_t) 'z' ) )
+		{
+			first_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( ( second_byte >= (uint8_t) 'a' )
+		 && ( second_byte <= (uint8_t) 'z' ) )
+		{
+			second_byte -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( first_byte != second_byte )
+		{
+			break;
+		}
+		string_index++;
+	}
+	*common_length = string_index;
+
+	return( 1 );
+}
+
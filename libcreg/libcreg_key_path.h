@@ -0,0 +1,74 @@
+/*
+ * Key path functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_KEY_PATH_H )
+#define _LIBCREG_KEY_PATH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_key_path libcreg_key_path_t;
+
+struct libcreg_key_path
+{
+	/* The UTF-8 string without a leading separator
+	 */
+	const uint8_t *utf8_string;
+
+	/* The UTF-8 string length
+	 */
+	size_t utf8_string_length;
+
+	/* The index of the path in the list of requested paths
+	 */
+	int path_index;
+};
+
+int libcreg_key_path_set_utf8_string(
+     libcreg_key_path_t *key_path,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int path_index,
+     libcerror_error_t **error );
+
+int libcreg_key_path_compare(
+     libcreg_key_path_t *first_key_path,
+     libcreg_key_path_t *second_key_path,
+     libcerror_error_t **error );
+
+int libcreg_key_path_get_common_length(
+     libcreg_key_path_t *first_key_path,
+     libcreg_key_path_t *second_key_path,
+     size_t *common_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_KEY_PATH_H ) */
+
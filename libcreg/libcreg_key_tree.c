@@ -20,20 +20,18 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
-#if defined( HAVE_WCTYPE_H ) || defined( HAVE_WINAPI )
-#include <wctype.h>
-#endif
-
 #include "libcreg_definitions.h"
 #include "libcreg_key.h"
-#include "libcreg_key_descriptor.h"
-#include "libcreg_key_item.h"
 #include "libcreg_key_navigation.h"
+#include "libcreg_key_path.h"
 #include "libcreg_key_tree.h"
+#include "libcreg_libcdata.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libuna.h"
+#include "libcreg_path_index.h"
 #include "libcreg_types.h"
 
 /* Retrieves the key for the specific UTF-8 encoded path
@@ -52,16 +50,15 @@ int libcreg_key_tree_get_sub_key_by_utf8_path(
      libcreg_key_t **sub_key,
      libcerror_error_t **error )
 {
-	libcreg_key_descriptor_t *sub_key_descriptor = NULL;
-	libcreg_key_item_t *sub_key_item             = NULL;
 	uint8_t *utf8_string_segment                 = NULL;
 	static char *function                        = "libcreg_key_tree_get_sub_key_by_utf8_path";
 	libuna_unicode_character_t unicode_character = 0;
 	size_t utf8_string_index                     = 0;
 	size_t utf8_string_segment_length            = 0;
-	uint32_t name_hash                           = 0;
 	uint32_t sub_key_offset                      = 0;
+	int key_entry_index                          = 0;
 	int result                                   = 0;
+	int use_path_index                           = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -107,139 +104,157 @@ int libcreg_key_tree_get_sub_key_by_utf8_path(
 
 		return( -1 );
 	}
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
 	sub_key_offset = key_offset;
 
-	if( utf8_string_length > 0 )
+	if( key_navigation->path_index != NULL )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBCREG_SEPARATOR )
+		result = libcreg_path_index_get_entry_index_by_key_offset(
+		          key_navigation->path_index,
+		          key_offset,
+		          &key_entry_index,
+		          error );
+
+		if( result == -1 )
 		{
-			utf8_string_index++;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path index entry for key offset: %" PRIu32 ".",
+			 function,
+			 key_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			use_path_index = 1;
 		}
 	}
-	/* If the string is empty return the current key
+	/* Resolve the path with the path index if the key is indexed
 	 */
-	if( utf8_string_length == utf8_string_index )
+	if( use_path_index != 0 )
 	{
-		result = 1;
+		result = libcreg_key_navigation_get_sub_key_offset_by_utf8_path_from_path_index(
+		          key_navigation,
+		          file_io_handle,
+		          key_entry_index,
+		          utf8_string,
+		          utf8_string_length,
+		          ascii_codepage,
+		          &sub_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key offset by path from path index.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	else while( utf8_string_index < utf8_string_length )
+	/* The path index does not contain keys that could not be indexed, such as keys
+	 * with a name that cannot be decoded, hence if the path index has no match
+	 * the path is resolved segment by segment
+	 */
+	if( result == 0 )
 	{
-		utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = utf8_string_index;
-		name_hash                  = 0;
+		sub_key_offset = key_offset;
 
-		while( utf8_string_index < utf8_string_length )
+		if( utf8_string_length > 0 )
 		{
-			if( libuna_unicode_character_copy_from_utf8(
-			     &unicode_character,
-			     utf8_string,
-			     utf8_string_length,
-			     &utf8_string_index,
-			     error ) != 1 )
+			/* Ignore a leading separator
+			 */
+			if( utf8_string[ utf8_string_index ] == (uint8_t) LIBCREG_SEPARATOR )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-8 string to Unicode character.",
-				 function );
-
-				goto on_error;
-			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf8_string_segment_length += 1;
-
-				break;
+				utf8_string_index++;
 			}
-			name_hash *= 37;
-			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 		}
-		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
-
-		if( utf8_string_segment_length == 0 )
+		/* If the string is empty return the current key
+		 */
+		if( utf8_string_length == utf8_string_index )
 		{
-			result = 0;
+			result = 1;
 		}
-		else
+		else while( utf8_string_index < utf8_string_length )
 		{
-/* TODO: instead of key item directory read key descriptors ? */
-			if( libcreg_key_item_initialize(
-			     &sub_key_item,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
-				 function );
+			utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
+			utf8_string_segment_length = utf8_string_index;
 
-				goto on_error;
-			}
-			if( libcreg_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     key_navigation,
-			     sub_key_offset,
-			     error ) != 1 )
+			while( utf8_string_index < utf8_string_length )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
+				if( libuna_unicode_character_copy_from_utf8(
+				     &unicode_character,
+				     utf8_string,
+				     utf8_string_length,
+				     &utf8_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-8 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					utf8_string_segment_length += 1;
+
+					break;
+				}
+			}
+			utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
 
-				goto on_error;
+			if( utf8_string_segment_length == 0 )
+			{
+				result = 0;
 			}
-			result = libcreg_key_item_get_sub_key_descriptor_by_utf8_name(
-			          sub_key_item,
-			          file_io_handle,
-			          key_navigation,
-				  utf8_string_segment,
-				  utf8_string_segment_length,
-				  ascii_codepage,
-			          &sub_key_descriptor,
-			          error );
-
-			if( result == 1 )
+			else
 			{
-				sub_key_offset = sub_key_descriptor->key_offset;
+				result = libcreg_key_navigation_get_sub_key_offset_by_utf8_name(
+				          key_navigation,
+				          file_io_handle,
+				          sub_key_offset,
+				          utf8_string_segment,
+				          utf8_string_segment_length,
+				          ascii_codepage,
+				          &sub_key_offset,
+				          error );
 			}
-			if( libcreg_key_item_free(
-			     &sub_key_item,
-			     error ) != 1 )
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
 				 function );
 
-				goto on_error;
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
 			}
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key values by name.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
 		}
 	}
 	if( result != 0 )
@@ -259,19 +274,10 @@ int libcreg_key_tree_get_sub_key_by_utf8_path(
 			 "%s: unable to create sub key.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	return( result );
-
-on_error:
-	if( sub_key_item != NULL )
-	{
-		libcreg_key_item_free(
-		 &sub_key_item,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the key for the specific UTF-16 encoded path
@@ -290,16 +296,15 @@ int libcreg_key_tree_get_sub_key_by_utf16_path(
      libcreg_key_t **sub_key,
      libcerror_error_t **error )
 {
-	libcreg_key_descriptor_t *sub_key_descriptor = NULL;
-	libcreg_key_item_t *sub_key_item             = NULL;
 	uint16_t *utf16_string_segment               = NULL;
 	static char *function                        = "libcreg_key_tree_get_sub_key_by_utf16_path";
 	libuna_unicode_character_t unicode_character = 0;
 	size_t utf16_string_index                    = 0;
 	size_t utf16_string_segment_length           = 0;
-	uint32_t name_hash                           = 0;
 	uint32_t sub_key_offset                      = 0;
+	int key_entry_index                          = 0;
 	int result                                   = 0;
+	int use_path_index                           = 0;
 
 	if( utf16_string == NULL )
 	{
@@ -345,170 +350,601 @@ int libcreg_key_tree_get_sub_key_by_utf16_path(
 
 		return( -1 );
 	}
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
 	sub_key_offset = key_offset;
 
-	if( utf16_string_length > 0 )
+	if( key_navigation->path_index != NULL )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBCREG_SEPARATOR )
+		result = libcreg_path_index_get_entry_index_by_key_offset(
+		          key_navigation->path_index,
+		          key_offset,
+		          &key_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path index entry for key offset: %" PRIu32 ".",
+			 function,
+			 key_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
 		{
-			utf16_string_index++;
+			use_path_index = 1;
 		}
 	}
-	/* If the string is empty return the current key
+	/* Resolve the path with the path index if the key is indexed
 	 */
-	if( utf16_string_length == utf16_string_index )
+	if( use_path_index != 0 )
 	{
-		result = 1;
+		result = libcreg_key_navigation_get_sub_key_offset_by_utf16_path_from_path_index(
+		          key_navigation,
+		          file_io_handle,
+		          key_entry_index,
+		          utf16_string,
+		          utf16_string_length,
+		          ascii_codepage,
+		          &sub_key_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key offset by path from path index.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	else while( utf16_string_index < utf16_string_length )
+	/* The path index does not contain keys that could not be indexed, such as keys
+	 * with a name that cannot be decoded, hence if the path index has no match
+	 * the path is resolved segment by segment
+	 */
+	if( result == 0 )
 	{
-		utf16_string_segment        = (uint16_t *) &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
-		name_hash                   = 0;
+		sub_key_offset = key_offset;
 
-		while( utf16_string_index < utf16_string_length )
+		if( utf16_string_length > 0 )
 		{
-			if( libuna_unicode_character_copy_from_utf16(
-			     &unicode_character,
-			     utf16_string,
-			     utf16_string_length,
-			     &utf16_string_index,
-			     error ) != 1 )
+			/* Ignore a leading separator
+			 */
+			if( utf16_string[ utf16_string_index ] == (uint16_t) LIBCREG_SEPARATOR )
+			{
+				utf16_string_index++;
+			}
+		}
+		/* If the string is empty return the current key
+		 */
+		if( utf16_string_length == utf16_string_index )
+		{
+			result = 1;
+		}
+		else while( utf16_string_index < utf16_string_length )
+		{
+			utf16_string_segment        = (uint16_t *) &( utf16_string[ utf16_string_index ] );
+			utf16_string_segment_length = utf16_string_index;
+
+			while( utf16_string_index < utf16_string_length )
+			{
+				if( libuna_unicode_character_copy_from_utf16(
+				     &unicode_character,
+				     utf16_string,
+				     utf16_string_length,
+				     &utf16_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string to Unicode character.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
+				 || ( unicode_character == 0 ) )
+				{
+					utf16_string_segment_length += 1;
+
+					break;
+				}
+			}
+			utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+			if( utf16_string_segment_length == 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libcreg_key_navigation_get_sub_key_offset_by_utf16_name(
+				          key_navigation,
+				          file_io_handle,
+				          sub_key_offset,
+				          utf16_string_segment,
+				          utf16_string_segment_length,
+				          ascii_codepage,
+				          &sub_key_offset,
+				          error );
+			}
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBCREG_SEPARATOR )
-			 || ( unicode_character == 0 ) )
+			else if( result == 0 )
 			{
-				utf16_string_segment_length += 1;
-
 				break;
 			}
-			name_hash *= 37;
-			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+	}
+	if( result != 0 )
+	{
+		if( libcreg_key_initialize(
+		     sub_key,
+		     io_handle,
+		     file_io_handle,
+		     key_navigation,
+		     sub_key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the sub key offsets for specific UTF-8 encoded paths
+ * The path separator is the \ character
+ * The paths are sorted so that the parent keys that adjacent paths have in common are resolved only once
+ * The sub key offset of a path without a corresponding key is set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_tree_get_sub_key_offsets_by_utf8_paths(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     int ascii_codepage,
+     uint32_t *sub_key_offsets,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *sorted_key_paths     = NULL;
+	libcreg_key_path_t *key_path           = NULL;
+	libcreg_key_path_t *key_paths          = NULL;
+	libcreg_key_path_t *previous_key_path  = NULL;
+	size_t *segment_end_indexes            = NULL;
+	uint32_t *segment_key_offsets          = NULL;
+	static char *function                  = "libcreg_key_tree_get_sub_key_offsets_by_utf8_paths";
+	size_t common_length                   = 0;
+	size_t maximum_utf8_string_length      = 0;
+	size_t segment_end_index               = 0;
+	size_t utf8_string_index               = 0;
+	size_t utf8_string_segment_index       = 0;
+	uint32_t safe_key_offset               = 0;
+	uint8_t byte_value                     = 0;
+	int entry_index                        = 0;
+	int number_of_resolved_segments        = 0;
+	int number_of_segments                 = 0;
+	int path_index                         = 0;
+	int result                             = 0;
+	int segment_index                      = 0;
+	int sorted_path_index                  = 0;
+
+	if( key_navigation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcreg_key_path_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	key_paths = (libcreg_key_path_t *) memory_allocate(
+	                                    sizeof( libcreg_key_path_t ) * (size_t) number_of_paths );
+
+	if( key_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key paths.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &sorted_key_paths,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sorted key paths array.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		key_path = &( key_paths[ path_index ] );
+
+		if( libcreg_key_path_set_utf8_string(
+		     key_path,
+		     utf8_strings[ path_index ],
+		     utf8_string_lengths[ path_index ],
+		     path_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key path: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( key_path->utf8_string_length > maximum_utf8_string_length )
+		{
+			maximum_utf8_string_length = key_path->utf8_string_length;
+		}
+		if( libcdata_array_insert_entry(
+		     sorted_key_paths,
+		     &entry_index,
+		     (intptr_t *) key_path,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libcreg_key_path_compare,
+		     LIBCDATA_INSERT_FLAG_NON_UNIQUE_ENTRIES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert key path: %d into sorted array.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+	}
+	/* A path of length N consists of at most N + 1 segments
+	 */
+	if( maximum_utf8_string_length >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum UTF-8 string length value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	segment_end_indexes = (size_t *) memory_allocate(
+	                                  sizeof( size_t ) * ( maximum_utf8_string_length + 1 ) );
 
-		if( utf16_string_segment_length == 0 )
+	if( segment_end_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment end indexes.",
+		 function );
+
+		goto on_error;
+	}
+	segment_key_offsets = (uint32_t *) memory_allocate(
+	                                    sizeof( uint32_t ) * ( maximum_utf8_string_length + 1 ) );
+
+	if( segment_key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( sorted_path_index = 0;
+	     sorted_path_index < number_of_paths;
+	     sorted_path_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sorted_key_paths,
+		     sorted_path_index,
+		     (intptr_t **) &key_path,
+		     error ) != 1 )
 		{
-			result = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sorted key path: %d.",
+			 function,
+			 sorted_path_index );
+
+			goto on_error;
 		}
-		else
+		/* Determine the number of segments the path has in common with the previous path
+		 */
+		segment_index = 0;
+
+		if( previous_key_path != NULL )
 		{
-/* TODO: instead of key item directory read key descriptors ? */
-			if( libcreg_key_item_initialize(
-			     &sub_key_item,
+			if( libcreg_key_path_get_common_length(
+			     key_path,
+			     previous_key_path,
+			     &common_length,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve common length of key paths.",
 				 function );
 
 				goto on_error;
 			}
-			if( libcreg_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     key_navigation,
-			     sub_key_offset,
-			     error ) != 1 )
+			while( segment_index < number_of_segments )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
+				segment_end_index = segment_end_indexes[ segment_index ];
+
+				if( segment_end_index > common_length )
+				{
+					break;
+				}
+				if( segment_end_index < key_path->utf8_string_length )
+				{
+					byte_value = key_path->utf8_string[ segment_end_index ];
+
+					if( ( byte_value != (uint8_t) LIBCREG_SEPARATOR )
+					 && ( byte_value != 0 ) )
+					{
+						break;
+					}
+				}
+				segment_index++;
+			}
+			/* The path contains a segment that was not found for the previous path
+			 */
+			if( segment_index > number_of_resolved_segments )
+			{
+				sub_key_offsets[ key_path->path_index ] = 0;
 
-				goto on_error;
+				continue;
 			}
-			result = libcreg_key_item_get_sub_key_descriptor_by_utf16_name(
-			          sub_key_item,
-			          file_io_handle,
-			          key_navigation,
-				  utf16_string_segment,
-				  utf16_string_segment_length,
-				  ascii_codepage,
-			          &sub_key_descriptor,
-			          error );
-
-			if( result == 1 )
+		}
+		number_of_segments          = segment_index;
+		number_of_resolved_segments = segment_index;
+
+		if( segment_index > 0 )
+		{
+			safe_key_offset   = segment_key_offsets[ segment_index - 1 ];
+			utf8_string_index = segment_end_indexes[ segment_index - 1 ] + 1;
+		}
+		else
+		{
+			safe_key_offset   = key_offset;
+			utf8_string_index = 0;
+		}
+		result = 1;
+
+		while( utf8_string_index < key_path->utf8_string_length )
+		{
+			utf8_string_segment_index = utf8_string_index;
+
+			/* The separator is an ASCII character and cannot be part of an UTF-8 multi byte sequence
+			 */
+			while( utf8_string_index < key_path->utf8_string_length )
 			{
-				sub_key_offset = sub_key_descriptor->key_offset;
+				byte_value = key_path->utf8_string[ utf8_string_index ];
+
+				if( ( byte_value == (uint8_t) LIBCREG_SEPARATOR )
+				 || ( byte_value == 0 ) )
+				{
+					break;
+				}
+				utf8_string_index++;
 			}
-			if( libcreg_key_item_free(
-			     &sub_key_item,
-			     error ) != 1 )
+			segment_end_indexes[ number_of_segments ] = utf8_string_index;
+
+			number_of_segments++;
+
+			if( utf8_string_index == utf8_string_segment_index )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libcreg_key_navigation_get_sub_key_offset_by_utf8_name(
+				          key_navigation,
+				          file_io_handle,
+				          safe_key_offset,
+				          &( key_path->utf8_string[ utf8_string_segment_index ] ),
+				          utf8_string_index - utf8_string_segment_index,
+				          ascii_codepage,
+				          &safe_key_offset,
+				          error );
+			}
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key offset by name.",
 				 function );
 
 				goto on_error;
 			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			segment_key_offsets[ number_of_segments - 1 ] = safe_key_offset;
+
+			number_of_resolved_segments++;
+
+			utf8_string_index++;
 		}
-		if( result == -1 )
+		if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key values by name.",
-			 function );
-
-			goto on_error;
+			sub_key_offsets[ key_path->path_index ] = safe_key_offset;
 		}
-		else if( result == 0 )
+		else
 		{
-			break;
+			sub_key_offsets[ key_path->path_index ] = 0;
 		}
+		previous_key_path = key_path;
 	}
-	if( result != 0 )
+	memory_free(
+	 segment_key_offsets );
+
+	memory_free(
+	 segment_end_indexes );
+
+	if( libcdata_array_free(
+	     &sorted_key_paths,
+	     NULL,
+	     error ) != 1 )
 	{
-		if( libcreg_key_initialize(
-		     sub_key,
-		     io_handle,
-		     file_io_handle,
-		     key_navigation,
-		     sub_key_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub key.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sorted key paths array.",
+		 function );
 
-			goto on_error;
-		}
+		sorted_key_paths    = NULL;
+		segment_end_indexes = NULL;
+		segment_key_offsets = NULL;
+
+		goto on_error;
 	}
-	return( result );
+	memory_free(
+	 key_paths );
+
+	return( 1 );
 
 on_error:
-	if( sub_key_item != NULL )
+	if( segment_key_offsets != NULL )
+	{
+		memory_free(
+		 segment_key_offsets );
+	}
+	if( segment_end_indexes != NULL )
+	{
+		memory_free(
+		 segment_end_indexes );
+	}
+	if( sorted_key_paths != NULL )
 	{
-		libcreg_key_item_free(
-		 &sub_key_item,
+		libcdata_array_free(
+		 &sorted_key_paths,
+		 NULL,
 		 NULL );
 	}
+	if( key_paths != NULL )
+	{
+		memory_free(
+		 key_paths );
+	}
 	return( -1 );
 }
 
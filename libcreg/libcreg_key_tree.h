@@ -55,6 +55,17 @@ int libcreg_key_tree_get_sub_key_by_utf16_path(
      libcreg_key_t **sub_key,
      libcerror_error_t **error );
 
+int libcreg_key_tree_get_sub_key_offsets_by_utf8_paths(
+     libcreg_key_navigation_t *key_navigation,
+     libbfio_handle_t *file_io_handle,
+     uint32_t key_offset,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     int ascii_codepage,
+     uint32_t *sub_key_offsets,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
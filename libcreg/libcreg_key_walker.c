@@ -0,0 +1,2135 @@
+/*
+ * Key walker functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_data_block_loader.h"
+#include "libcreg_definitions.h"
+#include "libcreg_key_hierarchy_entry.h"
+#include "libcreg_key_hierarchy_table.h"
+#include "libcreg_key_name_entry.h"
+#include "libcreg_key_walker.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcnotify.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfdata.h"
+#include "libcreg_types.h"
+#include "libcreg_value_entry.h"
+
+/* Creates a key walker
+ * Make sure the value key_walker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_initialize(
+     libcreg_key_walker_t **key_walker,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     libcreg_key_navigation_t *key_navigation,
+     int number_of_data_blocks,
+     int ascii_codepage,
+     libcreg_walk_callbacks_t *callbacks,
+     int number_of_workers,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_walker_initialize";
+	size_t workers_size   = 0;
+	int result            = 0;
+	int worker_index      = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key walker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_hierarchy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hierarchy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_blocks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of data blocks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_data_blocks > 0 )
+	 && ( key_navigation == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key navigation.",
+		 function );
+
+		return( -1 );
+	}
+	if( callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBCREG_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the keys are walked by a single worker
+	 */
+	number_of_workers = 1;
+#endif
+	*key_walker = memory_allocate_structure(
+	               libcreg_key_walker_t );
+
+	if( *key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_walker,
+	     0,
+	     sizeof( libcreg_key_walker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key walker.",
+		 function );
+
+		memory_free(
+		 *key_walker );
+
+		*key_walker = NULL;
+
+		return( -1 );
+	}
+	if( number_of_data_blocks > 0 )
+	{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     key_navigation->loaded_data_blocks_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab loaded data blocks mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libcreg_key_navigation_resize_loaded_data_blocks(
+		          key_navigation,
+		          number_of_data_blocks,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize loaded data blocks.",
+			 function );
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     key_navigation->loaded_data_blocks_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release loaded data blocks mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	( *key_walker )->key_hierarchy_table   = key_hierarchy_table;
+	( *key_walker )->key_navigation        = key_navigation;
+	( *key_walker )->number_of_data_blocks = number_of_data_blocks;
+	( *key_walker )->ascii_codepage        = ascii_codepage;
+	( *key_walker )->callbacks             = callbacks;
+	( *key_walker )->flags                 = flags;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_walker )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *key_walker )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	workers_size = sizeof( libcreg_key_walker_worker_t * ) * number_of_workers;
+
+	( *key_walker )->workers = (libcreg_key_walker_worker_t **) memory_allocate(
+	                                                             workers_size );
+
+	if( ( *key_walker )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *key_walker )->workers,
+	     0,
+	     workers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *key_walker )->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcreg_key_walker_worker_initialize(
+		     &( ( *key_walker )->workers[ worker_index ] ),
+		     *key_walker,
+		     file_io_handle,
+		     worker_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *key_walker != NULL )
+	{
+		libcreg_key_walker_free(
+		 key_walker,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a key walker
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_free(
+     libcreg_key_walker_t **key_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_walker_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker != NULL )
+	{
+		/* The key_hierarchy_table, key_navigation and callbacks references are freed elsewhere
+		 */
+		if( ( *key_walker )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *key_walker )->number_of_workers;
+			     worker_index++ )
+			{
+				if( ( *key_walker )->workers[ worker_index ] == NULL )
+				{
+					continue;
+				}
+				if( libcreg_key_walker_worker_free(
+				     &( ( *key_walker )->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *key_walker )->workers );
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( ( *key_walker )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *key_walker )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_walker )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_walker )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *key_walker );
+
+		*key_walker = NULL;
+	}
+	return( result );
+}
+
+/* Walks the key at a specific offset and its sub keys
+ * The keys are walked by the workers, where every worker walks the sub keys it adds itself
+ * depth first and idle workers steal the least deep pending keys of other workers,
+ * hence every worker mostly walks a separate sub tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_walk(
+     libcreg_key_walker_t *key_walker,
+     uint32_t key_offset,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcreg_key_walker_worker_t *key_walker_worker = NULL;
+#endif
+	static char *function                          = "libcreg_key_walker_walk";
+	int result                                     = 1;
+	int worker_index                               = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker->number_of_items != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key walker - keys already walked.",
+		 function );
+
+		return( -1 );
+	}
+	/* The workers have not been started yet, hence the item can be added without locking
+	 */
+	if( libcreg_key_walker_worker_append_item(
+	     key_walker->workers[ 0 ],
+	     key_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key: 0x%08" PRIx32 " to worker: 0.",
+		 function,
+		 key_offset );
+
+		return( -1 );
+	}
+	key_walker->number_of_items         = 1;
+	key_walker->number_of_pending_items = 1;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	for( worker_index = 0;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		key_walker_worker = key_walker->workers[ worker_index ];
+
+		if( libcthreads_thread_create(
+		     &( key_walker_worker->thread ),
+		     NULL,
+		     (int (*)(void *)) &libcreg_key_walker_worker_walk_callback,
+		     (void *) key_walker_worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		key_walker_worker = key_walker->workers[ worker_index ];
+
+		if( libcthreads_thread_join(
+		     &( key_walker_worker->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#else
+	libcreg_key_walker_worker_walk_callback(
+	 key_walker->workers[ 0 ] );
+#endif /* defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+
+	for( worker_index = 0;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		if( key_walker->workers[ worker_index ]->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk keys with worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+on_error:
+	/* Stop the workers that were started before joining them
+	 */
+	libcthreads_mutex_grab(
+	 key_walker->mutex,
+	 NULL );
+
+	key_walker->abort = 1;
+
+	libcthreads_condition_broadcast(
+	 key_walker->condition,
+	 NULL );
+
+	libcthreads_mutex_release(
+	 key_walker->mutex,
+	 NULL );
+
+	for( worker_index = 0;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		key_walker_worker = key_walker->workers[ worker_index ];
+
+		if( key_walker_worker->thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( key_walker_worker->thread ),
+			 NULL );
+		}
+	}
+	return( -1 );
+#endif
+}
+
+/* Creates a key walker worker
+ * Make sure the value key_walker_worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_initialize(
+     libcreg_key_walker_worker_t **key_walker_worker,
+     libcreg_key_walker_t *key_walker,
+     libbfio_handle_t *file_io_handle,
+     int worker_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_walker_worker_initialize";
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key walker worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid worker index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*key_walker_worker = memory_allocate_structure(
+	                      libcreg_key_walker_worker_t );
+
+	if( *key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key walker worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_walker_worker,
+	     0,
+	     sizeof( libcreg_key_walker_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key walker worker.",
+		 function );
+
+		memory_free(
+		 *key_walker_worker );
+
+		*key_walker_worker = NULL;
+
+		return( -1 );
+	}
+	/* The data blocks are read on demand by the worker, hence the loaded data blocks,
+	 * first data block index and data block index increment of the data block loader are not used
+	 */
+	if( key_walker->number_of_data_blocks > 0 )
+	{
+		if( libcreg_data_block_loader_initialize(
+		     &( ( *key_walker_worker )->data_block_loader ),
+		     file_io_handle,
+		     key_walker->key_navigation->data_blocks_list,
+		     key_walker->key_navigation->loaded_data_blocks,
+		     key_walker->number_of_data_blocks,
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block loader.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_walker_worker )->items_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize items mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *key_walker_worker )->key_walker       = key_walker;
+	( *key_walker_worker )->worker_index     = worker_index;
+	( *key_walker_worker )->data_block_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *key_walker_worker != NULL )
+	{
+		if( ( *key_walker_worker )->data_block_loader != NULL )
+		{
+			libcreg_data_block_loader_free(
+			 &( ( *key_walker_worker )->data_block_loader ),
+			 NULL );
+		}
+		memory_free(
+		 *key_walker_worker );
+
+		*key_walker_worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key walker worker
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_free(
+     libcreg_key_walker_worker_t **key_walker_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_walker_worker_free";
+	int result            = 1;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker_worker != NULL )
+	{
+		/* The key_walker and data_block references are freed elsewhere
+		 */
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( ( *key_walker_worker )->items_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_walker_worker )->items_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free items mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *key_walker_worker )->data_block_loader != NULL )
+		{
+			if( libcreg_data_block_loader_free(
+			     &( ( *key_walker_worker )->data_block_loader ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block loader.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_walker_worker )->items != NULL )
+		{
+			memory_free(
+			 ( *key_walker_worker )->items );
+		}
+		memory_free(
+		 *key_walker_worker );
+
+		*key_walker_worker = NULL;
+	}
+	return( result );
+}
+
+/* Appends an item to the pending items of the worker
+ * The items mutex must be held by the caller if other workers are active
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_append_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     uint32_t key_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	libcreg_key_walker_item_t *items = NULL;
+	static char *function            = "libcreg_key_walker_worker_append_item";
+	size_t items_size                = 0;
+	int maximum_number_of_items      = 0;
+	int number_of_items              = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->last_item_index >= key_walker_worker->maximum_number_of_items )
+	{
+		number_of_items = key_walker_worker->last_item_index - key_walker_worker->first_item_index;
+
+		/* Reuse the space of the items stolen by other workers before resizing
+		 */
+		if( key_walker_worker->first_item_index > 0 )
+		{
+			if( number_of_items > 0 )
+			{
+				if( memory_copy(
+				     key_walker_worker->items,
+				     &( key_walker_worker->items[ key_walker_worker->first_item_index ] ),
+				     sizeof( libcreg_key_walker_item_t ) * number_of_items ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to move items.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			key_walker_worker->first_item_index = 0;
+			key_walker_worker->last_item_index  = number_of_items;
+		}
+		else
+		{
+			if( key_walker_worker->maximum_number_of_items == 0 )
+			{
+				maximum_number_of_items = 64;
+			}
+			else if( key_walker_worker->maximum_number_of_items > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid maximum number of items value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			else
+			{
+				maximum_number_of_items = key_walker_worker->maximum_number_of_items * 2;
+			}
+			items_size = sizeof( libcreg_key_walker_item_t ) * maximum_number_of_items;
+
+			if( items_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid items size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			items = (libcreg_key_walker_item_t *) memory_reallocate(
+			                                       key_walker_worker->items,
+			                                       items_size );
+
+			if( items == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize items.",
+				 function );
+
+				return( -1 );
+			}
+			key_walker_worker->items                   = items;
+			key_walker_worker->maximum_number_of_items = maximum_number_of_items;
+		}
+	}
+	key_walker_worker->items[ key_walker_worker->last_item_index ].key_offset = key_offset;
+	key_walker_worker->items[ key_walker_worker->last_item_index ].depth      = depth;
+
+	key_walker_worker->last_item_index += 1;
+
+	return( 1 );
+}
+
+/* Adds the sub keys of a key to the pending items of the worker
+ * The sub keys are added by following the next key offsets starting at the first sub key offset
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_push_items(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     uint32_t first_key_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_key_walker_t *key_walker = NULL;
+	static char *function            = "libcreg_key_walker_worker_push_items";
+	uint32_t key_offset              = 0;
+	int number_of_items              = 0;
+	int result                       = 1;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+	key_walker = key_walker_worker->key_walker;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The items mutex is held until the items are accounted for as pending,
+	 * so that items stolen by other workers cannot be walked before then
+	 */
+	if( libcthreads_mutex_grab(
+	     key_walker_worker->items_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab items mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	key_offset = first_key_offset;
+
+	while( ( key_offset != 0 )
+	    && ( key_offset != 0xffffffffUL ) )
+	{
+		if( number_of_items >= key_walker->key_hierarchy_table->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of sub keys value out of bounds.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( libcreg_key_hierarchy_table_get_entry_by_offset(
+		     key_walker->key_hierarchy_table,
+		     key_offset,
+		     &key_hierarchy_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			result = -1;
+
+			break;
+		}
+		if( libcreg_key_walker_worker_append_item(
+		     key_walker_worker,
+		     key_offset,
+		     depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key: 0x%08" PRIx32 ".",
+			 function,
+			 key_offset );
+
+			result = -1;
+
+			break;
+		}
+		number_of_items++;
+
+		key_offset = key_hierarchy_entry.next_key_offset;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		libcthreads_mutex_release(
+		 key_walker_worker->items_mutex,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		if( number_of_items > ( key_walker->key_hierarchy_table->number_of_entries - key_walker->number_of_items ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of keys value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		key_walker->number_of_items         += number_of_items;
+		key_walker->number_of_pending_items += number_of_items;
+		key_walker->number_of_additions     += 1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( ( result == 1 )
+	 && ( key_walker->number_of_waiting_workers > 0 ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     key_walker->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     key_walker_worker->items_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release items mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Takes the last pending item of the worker
+ * Returns 1 if successful, 0 if no pending items or -1 on error
+ */
+int libcreg_key_walker_worker_pop_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_key_walker_worker_pop_item";
+	int result            = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_walker_worker->items_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab items mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( key_walker_worker->last_item_index > key_walker_worker->first_item_index )
+	{
+		key_walker_worker->last_item_index -= 1;
+
+		item->key_offset = key_walker_worker->items[ key_walker_worker->last_item_index ].key_offset;
+		item->depth      = key_walker_worker->items[ key_walker_worker->last_item_index ].depth;
+
+		if( key_walker_worker->last_item_index == key_walker_worker->first_item_index )
+		{
+			key_walker_worker->first_item_index = 0;
+			key_walker_worker->last_item_index  = 0;
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_walker_worker->items_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release items mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Takes the first pending item of one of the other workers
+ * Returns 1 if successful, 0 if no pending items or -1 on error
+ */
+int libcreg_key_walker_worker_steal_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcreg_key_walker_t *key_walker          = NULL;
+	libcreg_key_walker_worker_t *other_worker = NULL;
+	int other_worker_index                    = 0;
+	int worker_iterator                       = 0;
+#endif
+	static char *function                     = "libcreg_key_walker_worker_steal_item";
+	int result                                = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	key_walker = key_walker_worker->key_walker;
+
+	/* The first pending item of a worker is the least deep, hence it is likely
+	 * to have the largest sub tree
+	 */
+	for( worker_iterator = 1;
+	     worker_iterator < key_walker->number_of_workers;
+	     worker_iterator++ )
+	{
+		other_worker_index = ( key_walker_worker->worker_index + worker_iterator ) % key_walker->number_of_workers;
+
+		other_worker = key_walker->workers[ other_worker_index ];
+
+		if( libcthreads_mutex_grab(
+		     other_worker->items_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab items mutex of worker: %d.",
+			 function,
+			 other_worker_index );
+
+			return( -1 );
+		}
+		if( other_worker->last_item_index > other_worker->first_item_index )
+		{
+			item->key_offset = other_worker->items[ other_worker->first_item_index ].key_offset;
+			item->depth      = other_worker->items[ other_worker->first_item_index ].depth;
+
+			other_worker->first_item_index += 1;
+
+			if( other_worker->last_item_index == other_worker->first_item_index )
+			{
+				other_worker->first_item_index = 0;
+				other_worker->last_item_index  = 0;
+			}
+			result = 1;
+		}
+		if( libcthreads_mutex_release(
+		     other_worker->items_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release items mutex of worker: %d.",
+			 function,
+			 other_worker_index );
+
+			return( -1 );
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+#endif /* defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
+/* Retrieves a specific data block
+ * The data block is read by the worker if it was not loaded before
+ * The data block is stored in the loaded data blocks of the key navigation
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_get_data_block(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     int data_block_index,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	libcreg_data_block_t *read_data_block = NULL;
+	libcreg_data_block_t *safe_data_block = NULL;
+	libcreg_key_walker_t *key_walker      = NULL;
+	static char *function                 = "libcreg_key_walker_worker_get_data_block";
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+	key_walker = key_walker_worker->key_walker;
+
+	if( ( data_block_index < 0 )
+	 || ( data_block_index >= key_walker->number_of_data_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive keys of a sub tree are mostly stored in the same data block
+	 */
+	if( ( key_walker_worker->data_block != NULL )
+	 && ( key_walker_worker->data_block_index == data_block_index ) )
+	{
+		*data_block = key_walker_worker->data_block;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_walker->key_navigation->loaded_data_blocks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab loaded data blocks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_data_block = key_walker->key_navigation->loaded_data_blocks[ data_block_index ];
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_walker->key_navigation->loaded_data_blocks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release loaded data blocks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_data_block == NULL )
+	{
+		/* The data block is read without holding the mutex so that other workers
+		 * can read other data blocks concurrently
+		 */
+		if( libcreg_data_block_loader_read_data_block(
+		     key_walker_worker->data_block_loader,
+		     data_block_index,
+		     &read_data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block: %d.",
+			 function,
+			 data_block_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     key_walker->key_navigation->loaded_data_blocks_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab loaded data blocks mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* Another worker or a key could have read the same data block in the meantime
+		 * The key navigation keeps the loaded data blocks until it is freed
+		 */
+		if( key_walker->key_navigation->loaded_data_blocks[ data_block_index ] == NULL )
+		{
+			key_walker->key_navigation->loaded_data_blocks[ data_block_index ] = read_data_block;
+
+			read_data_block = NULL;
+		}
+		safe_data_block = key_walker->key_navigation->loaded_data_blocks[ data_block_index ];
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     key_walker->key_navigation->loaded_data_blocks_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release loaded data blocks mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( read_data_block != NULL )
+		{
+			if( libcreg_data_block_free(
+			     &read_data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block: %d.",
+				 function,
+				 data_block_index );
+
+				goto on_error;
+			}
+		}
+	}
+	key_walker_worker->data_block_index = data_block_index;
+	key_walker_worker->data_block       = safe_data_block;
+
+	*data_block = safe_data_block;
+
+	return( 1 );
+
+on_error:
+	if( read_data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &read_data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks a key
+ * Invokes the callbacks for the key and its values and adds its sub keys to the pending items
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_walk_key(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	libcreg_key_walker_t *key_walker         = NULL;
+	libcreg_value_entry_t *value_entry       = NULL;
+	static char *function                    = "libcreg_key_walker_worker_walk_key";
+	const uint8_t *name                      = NULL;
+	size_t name_size                         = 0;
+	int number_of_value_entries              = 0;
+	int result                               = 0;
+	int value_entry_index                    = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	key_walker = key_walker_worker->key_walker;
+
+	if( libcreg_key_hierarchy_table_get_entry_by_offset(
+	     key_walker->key_hierarchy_table,
+	     item->key_offset,
+	     &key_hierarchy_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hierarchy entry for offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 item->key_offset,
+		 item->key_offset );
+
+		return( -1 );
+	}
+	if( (int16_t) key_hierarchy_entry.data_block_number >= 0 )
+	{
+		if( libcreg_key_walker_worker_get_data_block(
+		     key_walker_worker,
+		     (int) key_hierarchy_entry.data_block_number,
+		     &data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block number: %" PRIu16 ".",
+			 function,
+			 key_hierarchy_entry.data_block_number );
+
+			return( -1 );
+		}
+		if( libcreg_data_block_get_entry_by_identifier(
+		     data_block,
+		     key_hierarchy_entry.key_name_entry_number,
+		     &key_name_entry,
+		     key_walker->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key name entry: %" PRIu16 ".",
+			 function,
+			 key_hierarchy_entry.key_name_entry_number );
+
+			return( -1 );
+		}
+		name      = key_name_entry->name;
+		name_size = (size_t) key_name_entry->name_size;
+	}
+	if( key_walker->callbacks->key_callback != NULL )
+	{
+		result = key_walker->callbacks->key_callback(
+		          (off64_t) item->key_offset,
+		          item->depth,
+		          name,
+		          name_size,
+		          key_walker->callbacks->callback_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: key callback failed for key: 0x%08" PRIx32 ".",
+			 function,
+			 item->key_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( ( key_name_entry != NULL )
+	 && ( key_walker->callbacks->value_callback != NULL )
+	 && ( ( key_walker->flags & LIBCREG_WALK_FLAG_SKIP_VALUES ) == 0 ) )
+	{
+		if( libcreg_key_name_entry_get_number_of_entries(
+		     key_name_entry,
+		     &number_of_value_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( value_entry_index = 0;
+		     value_entry_index < number_of_value_entries;
+		     value_entry_index++ )
+		{
+			if( libcreg_key_name_entry_get_entry_by_index(
+			     key_name_entry,
+			     value_entry_index,
+			     &value_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			if( value_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value entry: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			if( key_walker->callbacks->value_callback(
+			     (off64_t) item->key_offset,
+			     item->depth,
+			     value_entry->name,
+			     (size_t) value_entry->name_size,
+			     value_entry->type,
+			     value_entry->data,
+			     (size_t) value_entry->data_size,
+			     key_walker->callbacks->callback_data ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: value callback failed for value: %d of key: 0x%08" PRIx32 ".",
+				 function,
+				 value_entry_index,
+				 item->key_offset );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( key_hierarchy_entry.sub_key_offset != 0 )
+	 && ( key_hierarchy_entry.sub_key_offset != 0xffffffffUL ) )
+	{
+		if( libcreg_key_walker_worker_push_items(
+		     key_walker_worker,
+		     key_hierarchy_entry.sub_key_offset,
+		     item->depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add sub keys of key: 0x%08" PRIx32 ".",
+			 function,
+			 item->key_offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the next item to walk
+ * Takes the last pending item of the worker, otherwise steals an item from another worker,
+ * otherwise waits until items are added or all items have been walked
+ * Returns 1 if successful, 0 if all items have been walked or -1 on error
+ */
+int libcreg_key_walker_worker_get_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcreg_key_walker_t *key_walker = NULL;
+	uint32_t number_of_additions     = 0;
+	int walk_finished                = 0;
+#endif
+	static char *function            = "libcreg_key_walker_worker_get_item";
+	int result                       = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	key_walker = key_walker_worker->key_walker;
+#endif
+	/* The abort value is checked when the walked items are subtracted from the pending items
+	 */
+	while( result == 0 )
+	{
+		result = libcreg_key_walker_worker_pop_item(
+		          key_walker_worker,
+		          item,
+		          error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		/* The walked items are subtracted from the pending items once the worker
+		 * runs out of items, so that the mutex is not grabbed for every walked item
+		 */
+		if( libcthreads_mutex_grab(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		key_walker->number_of_pending_items -= key_walker_worker->number_of_walked_items;
+
+		key_walker_worker->number_of_walked_items = 0;
+
+		number_of_additions = key_walker->number_of_additions;
+
+		walk_finished = (int) ( ( key_walker->abort != 0 )
+		                     || ( key_walker->number_of_pending_items <= 0 ) );
+
+		if( ( walk_finished != 0 )
+		 && ( key_walker->number_of_waiting_workers > 0 ) )
+		{
+			if( libcthreads_condition_broadcast(
+			     key_walker->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( result == -1 )
+		 || ( walk_finished != 0 ) )
+		{
+			break;
+		}
+		result = libcreg_key_walker_worker_steal_item(
+		          key_walker_worker,
+		          item,
+		          error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+		if( libcthreads_mutex_grab(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		/* Items added after the number of additions was determined are detected
+		 * by a change in the number of additions
+		 */
+		while( ( key_walker->abort == 0 )
+		    && ( key_walker->number_of_pending_items > 0 )
+		    && ( key_walker->number_of_additions == number_of_additions ) )
+		{
+			key_walker->number_of_waiting_workers += 1;
+
+			result = libcthreads_condition_wait(
+			          key_walker->condition,
+			          key_walker->mutex,
+			          error );
+
+			key_walker->number_of_waiting_workers -= 1;
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			result = 0;
+		}
+		if( libcthreads_mutex_release(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result == -1 )
+		{
+			break;
+		}
+#else
+		break;
+
+#endif /* defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+	}
+	return( result );
+}
+
+/* Walks the items of the worker until all items have been walked
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_walk(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcerror_error_t **error )
+{
+	libcreg_key_walker_item_t item;
+
+	static char *function = "libcreg_key_walker_worker_walk";
+	int result            = 0;
+
+	if( key_walker_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker worker.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libcreg_key_walker_worker_get_item(
+		          key_walker_worker,
+		          &item,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcreg_key_walker_worker_walk_key(
+			     key_walker_worker,
+			     &item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk key: 0x%08" PRIx32 ".",
+				 function,
+				 item.key_offset );
+
+				return( -1 );
+			}
+			key_walker_worker->number_of_walked_items += 1;
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+}
+
+/* Walks the items of the worker
+ * Callback function for the worker thread, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_key_walker_worker_walk_callback(
+     libcreg_key_walker_worker_t *key_walker_worker )
+{
+	libcerror_error_t *error                  = NULL;
+	static char *function                     = "libcreg_key_walker_worker_walk_callback";
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	libcreg_key_walker_worker_t *other_worker = NULL;
+	int worker_index                          = 0;
+#endif
+
+	if( key_walker_worker == NULL )
+	{
+		return( -1 );
+	}
+	if( key_walker_worker->key_walker == NULL )
+	{
+		key_walker_worker->result = -1;
+
+		return( -1 );
+	}
+	key_walker_worker->result = libcreg_key_walker_worker_walk(
+	                             key_walker_worker,
+	                             &error );
+
+	if( key_walker_worker->result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk keys.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		/* Stop the other workers
+		 */
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     key_walker_worker->key_walker->mutex,
+		     NULL ) == 1 )
+		{
+			key_walker_worker->key_walker->abort = 1;
+
+			libcthreads_condition_broadcast(
+			 key_walker_worker->key_walker->condition,
+			 NULL );
+
+			libcthreads_mutex_release(
+			 key_walker_worker->key_walker->mutex,
+			 NULL );
+		}
+		/* Discard the pending items so that the other workers stop without walking them
+		 * The items mutexes are grabbed after the mutex is released to preserve the lock order
+		 */
+		for( worker_index = 0;
+		     worker_index < key_walker_worker->key_walker->number_of_workers;
+		     worker_index++ )
+		{
+			other_worker = key_walker_worker->key_walker->workers[ worker_index ];
+
+			if( libcthreads_mutex_grab(
+			     other_worker->items_mutex,
+			     NULL ) == 1 )
+			{
+				other_worker->first_item_index = 0;
+				other_worker->last_item_index  = 0;
+
+				libcthreads_mutex_release(
+				 other_worker->items_mutex,
+				 NULL );
+			}
+		}
+#else
+		key_walker_worker->key_walker->abort = 1;
+#endif
+	}
+	return( key_walker_worker->result );
+}
+
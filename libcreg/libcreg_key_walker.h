@@ -0,0 +1,270 @@
+/*
+ * Key walker functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_KEY_WALKER_H )
+#define _LIBCREG_KEY_WALKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_data_block_loader.h"
+#include "libcreg_key_hierarchy_table.h"
+#include "libcreg_key_navigation.h"
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfdata.h"
+#include "libcreg_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_key_walker_item libcreg_key_walker_item_t;
+
+struct libcreg_key_walker_item
+{
+	/* The key (hierarchy entry) offset
+	 */
+	uint32_t key_offset;
+
+	/* The depth of the key relative to the key the walk started at
+	 */
+	int depth;
+};
+
+typedef struct libcreg_key_walker libcreg_key_walker_t;
+
+typedef struct libcreg_key_walker_worker libcreg_key_walker_worker_t;
+
+struct libcreg_key_walker_worker
+{
+	/* The key walker
+	 */
+	libcreg_key_walker_t *key_walker;
+
+	/* The index of the worker
+	 */
+	int worker_index;
+
+	/* The data block loader
+	 * The loader has its own file IO handle so that workers can read concurrently
+	 */
+	libcreg_data_block_loader_t *data_block_loader;
+
+	/* The index of the most recently used data block
+	 */
+	int data_block_index;
+
+	/* The most recently used data block
+	 */
+	libcreg_data_block_t *data_block;
+
+	/* The pending items
+	 * The worker takes items from the end, other workers steal items from the start
+	 */
+	libcreg_key_walker_item_t *items;
+
+	/* The number of allocated items
+	 */
+	int maximum_number_of_items;
+
+	/* The index of the first pending item
+	 */
+	int first_item_index;
+
+	/* The index after the last pending item
+	 */
+	int last_item_index;
+
+	/* The number of walked items not yet subtracted from the number of pending items of the key walker
+	 */
+	int number_of_walked_items;
+
+	/* The result of walking the keys
+	 */
+	int result;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the pending items
+	 */
+	libcthreads_mutex_t *items_mutex;
+
+	/* The thread that walks the keys
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct libcreg_key_walker
+{
+	/* The key hierarchy table
+	 */
+	libcreg_key_hierarchy_table_t *key_hierarchy_table;
+
+	/* The key navigation
+	 * The data blocks read by the workers are stored in the loaded data blocks of the key navigation
+	 * so that data blocks loaded before are not read again and the names and data passed to
+	 * the callbacks remain valid while other workers read other data blocks
+	 */
+	libcreg_key_navigation_t *key_navigation;
+
+	/* The number of data blocks
+	 */
+	int number_of_data_blocks;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The callbacks
+	 */
+	libcreg_walk_callbacks_t *callbacks;
+
+	/* The walk flags
+	 */
+	uint8_t flags;
+
+	/* The workers
+	 */
+	libcreg_key_walker_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of items that have been added but not yet walked
+	 */
+	int number_of_pending_items;
+
+	/* The number of items that have been added
+	 * Every key is stored in a separate key hierarchy entry, which bounds the number of items
+	 * and prevents a loop in the key hierarchy from being followed indefinitely
+	 */
+	int number_of_items;
+
+	/* The number of times items were added, used by idle workers to detect new items
+	 */
+	uint32_t number_of_additions;
+
+	/* The number of workers waiting for items
+	 */
+	int number_of_waiting_workers;
+
+	/* Value to indicate the walk should stop
+	 */
+	int abort;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the walk state
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition to signal idle workers
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libcreg_key_walker_initialize(
+     libcreg_key_walker_t **key_walker,
+     libbfio_handle_t *file_io_handle,
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     libcreg_key_navigation_t *key_navigation,
+     int number_of_data_blocks,
+     int ascii_codepage,
+     libcreg_walk_callbacks_t *callbacks,
+     int number_of_workers,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_free(
+     libcreg_key_walker_t **key_walker,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_walk(
+     libcreg_key_walker_t *key_walker,
+     uint32_t key_offset,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_initialize(
+     libcreg_key_walker_worker_t **key_walker_worker,
+     libcreg_key_walker_t *key_walker,
+     libbfio_handle_t *file_io_handle,
+     int worker_index,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_free(
+     libcreg_key_walker_worker_t **key_walker_worker,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_append_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     uint32_t key_offset,
+     int depth,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_push_items(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     uint32_t first_key_offset,
+     int depth,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_pop_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_steal_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_get_data_block(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     int data_block_index,
+     libcreg_data_block_t **data_block,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_walk_key(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_get_item(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcreg_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_walk(
+     libcreg_key_walker_worker_t *key_walker_worker,
+     libcerror_error_t **error );
+
+int libcreg_key_walker_worker_walk_callback(
+     libcreg_key_walker_worker_t *key_walker_worker );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_KEY_WALKER_H ) */
+
@@ -0,0 +1,239 @@
+/*
+ * Name hash functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_name_hash.h"
+
+/* Calculates the name hash of a codepage encoded key name as stored in the key hierarchy entry
+ * The hash is the sum of the upper case values of the characters less than 0x80
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_name_hash_calculate_from_byte_stream(
+     uint32_t *name_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcreg_name_hash_calculate_from_byte_stream";
+	size_t byte_stream_index = 0;
+	uint32_t safe_name_hash  = 0;
+	uint8_t byte_value       = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_stream_index = 0;
+	     byte_stream_index < byte_stream_size;
+	     byte_stream_index++ )
+	{
+		byte_value = byte_stream[ byte_stream_index ];
+
+		if( byte_value >= 0x80 )
+		{
+			continue;
+		}
+		if( ( byte_value >= (uint8_t) 'a' )
+		 && ( byte_value <= (uint8_t) 'z' ) )
+		{
+			byte_value -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		safe_name_hash += byte_value;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-8 encoded key name
+ * The hash can only be determined reliably for names that consist of ASCII characters,
+ * since the stored hash depends on the codepage encoded representation of the name
+ * Returns 1 if successful, 0 if the hash cannot be determined or -1 on error
+ */
+int libcreg_name_hash_calculate_from_utf8_string(
+     uint32_t *name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcreg_name_hash_calculate_from_utf8_string";
+	size_t utf8_string_index = 0;
+	uint32_t safe_name_hash  = 0;
+	uint8_t utf8_character   = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		utf8_character = utf8_string[ utf8_string_index ];
+
+		if( utf8_character >= 0x80 )
+		{
+			return( 0 );
+		}
+		if( ( utf8_character >= (uint8_t) 'a' )
+		 && ( utf8_character <= (uint8_t) 'z' ) )
+		{
+			utf8_character -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		safe_name_hash += utf8_character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-16 encoded key name
+ * The hash can only be determined reliably for names that consist of ASCII characters,
+ * since the stored hash depends on the codepage encoded representation of the name
+ * Returns 1 if successful, 0 if the hash cannot be determined or -1 on error
+ */
+int libcreg_name_hash_calculate_from_utf16_string(
+     uint32_t *name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcreg_name_hash_calculate_from_utf16_string";
+	size_t utf16_string_index = 0;
+	uint32_t safe_name_hash   = 0;
+	uint16_t utf16_character  = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		utf16_character = utf16_string[ utf16_string_index ];
+
+		if( utf16_character >= 0x80 )
+		{
+			return( 0 );
+		}
+		if( ( utf16_character >= (uint16_t) 'a' )
+		 && ( utf16_character <= (uint16_t) 'z' ) )
+		{
+			utf16_character -= (uint16_t) 'a' - (uint16_t) 'A';
+		}
+		safe_name_hash += utf16_character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
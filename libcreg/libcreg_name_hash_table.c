@@ -0,0 +1,388 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_name_hash_table.h"
+
+/* Creates a name hash table
+ * Make sure the value name_hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_name_hash_table_initialize(
+     libcreg_name_hash_table_t **name_hash_table,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcreg_name_hash_table_initialize";
+	size_t entry_indexes_size   = 0;
+	size_t name_hashes_size     = 0;
+	int number_of_slots         = 8;
+	uint8_t number_of_slot_bits = 3;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries < 0 )
+	 || ( maximum_number_of_entries > ( 1 << 29 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the table at 50 percent or less
+	 */
+	while( number_of_slots < ( 2 * maximum_number_of_entries ) )
+	{
+		number_of_slots     <<= 1;
+		number_of_slot_bits  += 1;
+	}
+	name_hashes_size   = sizeof( uint32_t ) * (size_t) number_of_slots;
+	entry_indexes_size = sizeof( int ) * (size_t) number_of_slots;
+
+	if( ( name_hashes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( entry_indexes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of slots value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*name_hash_table = memory_allocate_structure(
+	                    libcreg_name_hash_table_t );
+
+	if( *name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_hash_table,
+	     0,
+	     sizeof( libcreg_name_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash table.",
+		 function );
+
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+
+		return( -1 );
+	}
+	( *name_hash_table )->name_hashes = (uint32_t *) memory_allocate(
+	                                                  name_hashes_size );
+
+	if( ( *name_hash_table )->name_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->entry_indexes = (int *) memory_allocate(
+	                                               entry_indexes_size );
+
+	if( ( *name_hash_table )->entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Setting every byte to 0xff marks all slots as unused (-1)
+	 */
+	if( memory_set(
+	     ( *name_hash_table )->entry_indexes,
+	     0xff,
+	     entry_indexes_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->number_of_slots     = number_of_slots;
+	( *name_hash_table )->number_of_slot_bits = number_of_slot_bits;
+
+	return( 1 );
+
+on_error:
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->entry_indexes );
+		}
+		if( ( *name_hash_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->name_hashes );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_name_hash_table_free(
+     libcreg_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_name_hash_table_free";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->entry_indexes );
+		}
+		if( ( *name_hash_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->name_hashes );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts an entry into the name hash table
+ * Multiple entries with the same name hash can be inserted
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_name_hash_table_insert_entry(
+     libcreg_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_name_hash_table_insert_entry";
+	int slot_index        = 0;
+	int slot_mask         = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->number_of_entries >= ( name_hash_table->number_of_slots / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name hash table - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask  = name_hash_table->number_of_slots - 1;
+	slot_index = (int) ( (uint32_t) ( name_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - name_hash_table->number_of_slot_bits ) );
+
+	while( name_hash_table->entry_indexes[ slot_index ] != -1 )
+	{
+		slot_index = ( slot_index + 1 ) & slot_mask;
+	}
+	name_hash_table->name_hashes[ slot_index ]   = name_hash;
+	name_hash_table->entry_indexes[ slot_index ] = entry_index;
+
+	name_hash_table->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next entry index with a specific name hash
+ * The probe index keeps track of the position in the table and should be set to 0 before the first call
+ * Returns 1 if successful, 0 if there are no more entries with the name hash or -1 on error
+ */
+int libcreg_name_hash_table_get_next_entry_index(
+     libcreg_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int *probe_index,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_name_hash_table_get_next_entry_index";
+	int first_slot_index  = 0;
+	int slot_index        = 0;
+	int slot_mask         = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid probe index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *probe_index < 0 )
+	 || ( *probe_index > name_hash_table->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid probe index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask        = name_hash_table->number_of_slots - 1;
+	first_slot_index = (int) ( (uint32_t) ( name_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - name_hash_table->number_of_slot_bits ) );
+
+	while( *probe_index < name_hash_table->number_of_slots )
+	{
+		slot_index = ( first_slot_index + *probe_index ) & slot_mask;
+
+		*probe_index += 1;
+
+		if( name_hash_table->entry_indexes[ slot_index ] == -1 )
+		{
+			break;
+		}
+		if( name_hash_table->name_hashes[ slot_index ] == name_hash )
+		{
+			*entry_index = name_hash_table->entry_indexes[ slot_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
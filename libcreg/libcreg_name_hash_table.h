@@ -0,0 +1,87 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_NAME_HASH_TABLE_H )
+#define _LIBCREG_NAME_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_name_hash_table libcreg_name_hash_table_t;
+
+struct libcreg_name_hash_table
+{
+	/* The name hashes of the slots
+	 */
+	uint32_t *name_hashes;
+
+	/* The entry indexes of the slots
+	 * An entry index of -1 represents an unused slot
+	 */
+	int *entry_indexes;
+
+	/* The number of slots, which is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of bits used to determine the slot of a name hash
+	 */
+	uint8_t number_of_slot_bits;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libcreg_name_hash_table_initialize(
+     libcreg_name_hash_table_t **name_hash_table,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libcreg_name_hash_table_free(
+     libcreg_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libcreg_name_hash_table_insert_entry(
+     libcreg_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcreg_name_hash_table_get_next_entry_index(
+     libcreg_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int *probe_index,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_NAME_HASH_TABLE_H ) */
+
@@ -0,0 +1,422 @@
+/*
+ * Key offset to path cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_offset_path_cache.h"
+
+/* Creates an offset path cache
+ * Make sure the value offset_path_cache is referencing, is set to NULL
+ * The number of entries is rounded up to a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_offset_path_cache_initialize(
+     libcreg_offset_path_cache_t **offset_path_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function        = "libcreg_offset_path_cache_initialize";
+	size_t entries_size          = 0;
+	int safe_number_of_entries   = 8;
+	uint8_t number_of_entry_bits = 3;
+
+	if( offset_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offset path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > ( 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( safe_number_of_entries < number_of_entries )
+	{
+		safe_number_of_entries <<= 1;
+		number_of_entry_bits    += 1;
+	}
+	entries_size = sizeof( libcreg_offset_path_cache_entry_t ) * (size_t) safe_number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*offset_path_cache = memory_allocate_structure(
+	                      libcreg_offset_path_cache_t );
+
+	if( *offset_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offset path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *offset_path_cache,
+	     0,
+	     sizeof( libcreg_offset_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear offset path cache.",
+		 function );
+
+		memory_free(
+		 *offset_path_cache );
+
+		*offset_path_cache = NULL;
+
+		return( -1 );
+	}
+	( *offset_path_cache )->entries = (libcreg_offset_path_cache_entry_t *) memory_allocate(
+	                                                                         entries_size );
+
+	if( ( *offset_path_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *offset_path_cache )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *offset_path_cache )->number_of_entries    = safe_number_of_entries;
+	( *offset_path_cache )->number_of_entry_bits = number_of_entry_bits;
+
+	return( 1 );
+
+on_error:
+	if( *offset_path_cache != NULL )
+	{
+		if( ( *offset_path_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *offset_path_cache )->entries );
+		}
+		memory_free(
+		 *offset_path_cache );
+
+		*offset_path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an offset path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_offset_path_cache_free(
+     libcreg_offset_path_cache_t **offset_path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_offset_path_cache_free";
+	int entry_index       = 0;
+
+	if( offset_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_path_cache != NULL )
+	{
+		if( ( *offset_path_cache )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *offset_path_cache )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *offset_path_cache )->entries[ entry_index ].utf8_path != NULL )
+				{
+					memory_free(
+					 ( *offset_path_cache )->entries[ entry_index ].utf8_path );
+				}
+			}
+			memory_free(
+			 ( *offset_path_cache )->entries );
+		}
+		memory_free(
+		 *offset_path_cache );
+
+		*offset_path_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific key offset
+ * The path is managed by the cache and remains valid until the entry is replaced
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcreg_offset_path_cache_get_utf8_path(
+     libcreg_offset_path_cache_t *offset_path_cache,
+     uint32_t key_offset,
+     const uint8_t **utf8_path,
+     size_t *utf8_path_length,
+     libcerror_error_t **error )
+{
+	libcreg_offset_path_cache_entry_t *entry = NULL;
+	static char *function                    = "libcreg_offset_path_cache_get_utf8_path";
+	int entry_index                          = 0;
+
+	if( offset_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_path_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid offset path cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path length.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = (int) ( (uint32_t) ( key_offset * (uint32_t) 0x9e3779b1UL ) >> ( 32 - offset_path_cache->number_of_entry_bits ) );
+
+	entry = &( offset_path_cache->entries[ entry_index ] );
+
+	if( entry->key_offset != key_offset )
+	{
+		return( 0 );
+	}
+	*utf8_path        = entry->utf8_path;
+	*utf8_path_length = entry->utf8_path_length;
+
+	return( 1 );
+}
+
+/* Sets the UTF-8 encoded path of a specific key offset
+ * The path is copied and replaces the entry of any other key offset that maps to the same entry
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_offset_path_cache_set_utf8_path(
+     libcreg_offset_path_cache_t *offset_path_cache,
+     uint32_t key_offset,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     libcerror_error_t **error )
+{
+	libcreg_offset_path_cache_entry_t *entry = NULL;
+	uint8_t *safe_utf8_path                  = NULL;
+	static char *function                    = "libcreg_offset_path_cache_set_utf8_path";
+	int entry_index                          = 0;
+
+	if( offset_path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_path_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid offset path cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_path == NULL )
+	 && ( utf8_path_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_length > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 path length value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_length > 0 )
+	{
+		safe_utf8_path = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * utf8_path_length );
+
+		if( safe_utf8_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 path.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     safe_utf8_path,
+		     utf8_path,
+		     sizeof( uint8_t ) * utf8_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 path.",
+			 function );
+
+			memory_free(
+			 safe_utf8_path );
+
+			return( -1 );
+		}
+	}
+	entry_index = (int) ( (uint32_t) ( key_offset * (uint32_t) 0x9e3779b1UL ) >> ( 32 - offset_path_cache->number_of_entry_bits ) );
+
+	entry = &( offset_path_cache->entries[ entry_index ] );
+
+	if( entry->utf8_path != NULL )
+	{
+		memory_free(
+		 entry->utf8_path );
+	}
+	entry->key_offset       = key_offset;
+	entry->utf8_path        = safe_utf8_path;
+	entry->utf8_path_length = utf8_path_length;
+
+	return( 1 );
+}
+
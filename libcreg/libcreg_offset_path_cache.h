@@ -0,0 +1,97 @@
+/*
+ * Key offset to path cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_OFFSET_PATH_CACHE_H )
+#define _LIBCREG_OFFSET_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_offset_path_cache_entry libcreg_offset_path_cache_entry_t;
+
+struct libcreg_offset_path_cache_entry
+{
+	/* The key offset
+	 * A key offset of 0 represents an unused entry
+	 */
+	uint32_t key_offset;
+
+	/* The UTF-8 encoded path
+	 */
+	uint8_t *utf8_path;
+
+	/* The UTF-8 encoded path length
+	 */
+	size_t utf8_path_length;
+};
+
+typedef struct libcreg_offset_path_cache libcreg_offset_path_cache_t;
+
+struct libcreg_offset_path_cache
+{
+	/* The entries
+	 */
+	libcreg_offset_path_cache_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	int number_of_entries;
+
+	/* The number of bits used to determine the entry of a key offset
+	 */
+	uint8_t number_of_entry_bits;
+};
+
+int libcreg_offset_path_cache_initialize(
+     libcreg_offset_path_cache_t **offset_path_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libcreg_offset_path_cache_free(
+     libcreg_offset_path_cache_t **offset_path_cache,
+     libcerror_error_t **error );
+
+int libcreg_offset_path_cache_get_utf8_path(
+     libcreg_offset_path_cache_t *offset_path_cache,
+     uint32_t key_offset,
+     const uint8_t **utf8_path,
+     size_t *utf8_path_length,
+     libcerror_error_t **error );
+
+int libcreg_offset_path_cache_set_utf8_path(
+     libcreg_offset_path_cache_t *offset_path_cache,
+     uint32_t key_offset,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_OFFSET_PATH_CACHE_H ) */
+
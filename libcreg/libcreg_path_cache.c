@@ -0,0 +1,661 @@
+/*
+ * Path cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_libuna.h"
+#include "libcreg_path_cache.h"
+
+/* Creates a path cache
+ * Make sure the value path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_cache_initialize(
+     libcreg_path_cache_t **path_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcreg_path_cache_initialize";
+	size_t buckets_size           = 0;
+	size_t entries_size           = 0;
+	int number_of_buckets         = 8;
+	uint8_t number_of_bucket_bits = 3;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_buckets < maximum_number_of_entries )
+	{
+		number_of_buckets     <<= 1;
+		number_of_bucket_bits  += 1;
+	}
+	entries_size = sizeof( libcreg_path_cache_entry_t ) * (size_t) maximum_number_of_entries;
+	buckets_size = sizeof( int ) * (size_t) number_of_buckets;
+
+	if( ( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( buckets_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of entries value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*path_cache = memory_allocate_structure(
+	               libcreg_path_cache_t );
+
+	if( *path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_cache,
+	     0,
+	     sizeof( libcreg_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path cache.",
+		 function );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+
+		return( -1 );
+	}
+	( *path_cache )->entries = (libcreg_path_cache_entry_t *) memory_allocate(
+	                                                           entries_size );
+
+	if( ( *path_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *path_cache )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_cache )->buckets = (int *) memory_allocate(
+	                                    buckets_size );
+
+	if( ( *path_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	/* Setting every byte to 0xff marks all buckets as empty (-1)
+	 */
+	if( memory_set(
+	     ( *path_cache )->buckets,
+	     0xff,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_cache )->maximum_number_of_entries = maximum_number_of_entries;
+	( *path_cache )->number_of_buckets         = number_of_buckets;
+	( *path_cache )->number_of_bucket_bits     = number_of_bucket_bits;
+	( *path_cache )->most_recently_used_index  = -1;
+	( *path_cache )->least_recently_used_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *path_cache != NULL )
+	{
+		if( ( *path_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->buckets );
+		}
+		if( ( *path_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->entries );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_cache_free(
+     libcreg_path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_cache_free";
+	int entry_index       = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		if( ( *path_cache )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *path_cache )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *path_cache )->entries[ entry_index ].path != NULL )
+				{
+					memory_free(
+					 ( *path_cache )->entries[ entry_index ].path );
+				}
+			}
+			memory_free(
+			 ( *path_cache )->entries );
+		}
+		if( ( *path_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->buckets );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the most recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_cache_unlink_entry(
+     libcreg_path_cache_t *path_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libcreg_path_cache_entry_t *entry = NULL;
+	static char *function             = "libcreg_path_cache_unlink_entry";
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= path_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( path_cache->entries[ entry_index ] );
+
+	if( entry->previous_index != -1 )
+	{
+		path_cache->entries[ entry->previous_index ].next_index = entry->next_index;
+	}
+	else
+	{
+		path_cache->most_recently_used_index = entry->next_index;
+	}
+	if( entry->next_index != -1 )
+	{
+		path_cache->entries[ entry->next_index ].previous_index = entry->previous_index;
+	}
+	else
+	{
+		path_cache->least_recently_used_index = entry->previous_index;
+	}
+	entry->previous_index = -1;
+	entry->next_index     = -1;
+
+	return( 1 );
+}
+
+/* Adds an entry to the front of the most recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_cache_link_entry_as_most_recently_used(
+     libcreg_path_cache_t *path_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libcreg_path_cache_entry_t *entry = NULL;
+	static char *function             = "libcreg_path_cache_link_entry_as_most_recently_used";
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= path_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( path_cache->entries[ entry_index ] );
+
+	entry->previous_index = -1;
+	entry->next_index     = path_cache->most_recently_used_index;
+
+	if( path_cache->most_recently_used_index != -1 )
+	{
+		path_cache->entries[ path_cache->most_recently_used_index ].previous_index = entry_index;
+	}
+	else
+	{
+		path_cache->least_recently_used_index = entry_index;
+	}
+	path_cache->most_recently_used_index = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the key offset of a specific path
+ * The path consists of the upper case Unicode characters of the path without a leading separator
+ * Returns 1 if successful, 0 if the path is not cached or -1 on error
+ */
+int libcreg_path_cache_get_key_offset(
+     libcreg_path_cache_t *path_cache,
+     uint32_t path_hash,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_path_cache_entry_t *entry = NULL;
+	static char *function             = "libcreg_path_cache_get_key_offset";
+	int bucket_index                  = 0;
+	int entry_index                   = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libuna_unicode_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( (uint32_t) ( path_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - path_cache->number_of_bucket_bits ) );
+	entry_index  = path_cache->buckets[ bucket_index ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( path_cache->entries[ entry_index ] );
+
+		if( ( entry->path_hash == path_hash )
+		 && ( entry->path_length == path_length )
+		 && ( memory_compare(
+		       entry->path,
+		       path,
+		       sizeof( libuna_unicode_character_t ) * path_length ) == 0 ) )
+		{
+			break;
+		}
+		entry_index = entry->next_in_bucket_index;
+	}
+	if( entry_index == -1 )
+	{
+		return( 0 );
+	}
+	if( entry_index != path_cache->most_recently_used_index )
+	{
+		if( libcreg_path_cache_unlink_entry(
+		     path_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to unlink entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libcreg_path_cache_link_entry_as_most_recently_used(
+		     path_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to link entry: %d as most recently used.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	*key_offset = entry->key_offset;
+
+	return( 1 );
+}
+
+/* Sets the key offset of a specific path
+ * The path consists of the upper case Unicode characters of the path without a leading separator
+ * If the cache is full the least recently used entry is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_cache_set_key_offset(
+     libcreg_path_cache_t *path_cache,
+     uint32_t path_hash,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t key_offset,
+     libcerror_error_t **error )
+{
+	libcreg_path_cache_entry_t *entry = NULL;
+	libuna_unicode_character_t *copy  = NULL;
+	static char *function             = "libcreg_path_cache_set_key_offset";
+	uint32_t cached_key_offset        = 0;
+	int bucket_index                  = 0;
+	int entry_index                   = 0;
+	int previous_entry_index          = 0;
+	int result                        = 0;
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          path_hash,
+	          path,
+	          path_length,
+	          &cached_key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached key offset.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The entry was moved to the front of the most recently used list
+		 */
+		path_cache->entries[ path_cache->most_recently_used_index ].key_offset = key_offset;
+
+		return( 1 );
+	}
+	copy = (libuna_unicode_character_t *) memory_allocate(
+	                                       sizeof( libuna_unicode_character_t ) * path_length );
+
+	if( copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     copy,
+	     path,
+	     sizeof( libuna_unicode_character_t ) * path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		memory_free(
+		 copy );
+
+		return( -1 );
+	}
+	if( path_cache->number_of_entries < path_cache->maximum_number_of_entries )
+	{
+		entry_index = path_cache->number_of_entries;
+
+		path_cache->number_of_entries += 1;
+	}
+	else
+	{
+		/* Replace the least recently used entry
+		 */
+		entry_index = path_cache->least_recently_used_index;
+		entry       = &( path_cache->entries[ entry_index ] );
+
+		bucket_index = (int) ( (uint32_t) ( entry->path_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - path_cache->number_of_bucket_bits ) );
+
+		if( path_cache->buckets[ bucket_index ] == entry_index )
+		{
+			path_cache->buckets[ bucket_index ] = entry->next_in_bucket_index;
+		}
+		else
+		{
+			previous_entry_index = path_cache->buckets[ bucket_index ];
+
+			while( path_cache->entries[ previous_entry_index ].next_in_bucket_index != entry_index )
+			{
+				previous_entry_index = path_cache->entries[ previous_entry_index ].next_in_bucket_index;
+			}
+			path_cache->entries[ previous_entry_index ].next_in_bucket_index = entry->next_in_bucket_index;
+		}
+		if( libcreg_path_cache_unlink_entry(
+		     path_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to unlink entry: %d.",
+			 function,
+			 entry_index );
+
+			memory_free(
+			 copy );
+
+			return( -1 );
+		}
+		memory_free(
+		 entry->path );
+	}
+	entry = &( path_cache->entries[ entry_index ] );
+
+	bucket_index = (int) ( (uint32_t) ( path_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - path_cache->number_of_bucket_bits ) );
+
+	entry->path_hash            = path_hash;
+	entry->path                 = copy;
+	entry->path_length          = path_length;
+	entry->key_offset           = key_offset;
+	entry->next_in_bucket_index = path_cache->buckets[ bucket_index ];
+
+	path_cache->buckets[ bucket_index ] = entry_index;
+
+	if( libcreg_path_cache_link_entry_as_most_recently_used(
+	     path_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link entry: %d as most recently used.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
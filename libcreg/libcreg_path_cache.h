@@ -0,0 +1,146 @@
+/*
+ * Path cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_PATH_CACHE_H )
+#define _LIBCREG_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_path_cache_entry libcreg_path_cache_entry_t;
+
+struct libcreg_path_cache_entry
+{
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The upper case Unicode characters of the path
+	 */
+	libuna_unicode_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The key offset
+	 */
+	uint32_t key_offset;
+
+	/* The index of the next entry in the same bucket
+	 */
+	int next_in_bucket_index;
+
+	/* The index of the previous (more recently used) entry
+	 */
+	int previous_index;
+
+	/* The index of the next (less recently used) entry
+	 */
+	int next_index;
+};
+
+typedef struct libcreg_path_cache libcreg_path_cache_t;
+
+struct libcreg_path_cache
+{
+	/* The entries
+	 */
+	libcreg_path_cache_entry_t *entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the first entry in each bucket
+	 * An index of -1 represents an empty bucket
+	 */
+	int *buckets;
+
+	/* The number of buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The number of bits used to determine the bucket of a path hash
+	 */
+	uint8_t number_of_bucket_bits;
+
+	/* The index of the most recently used entry
+	 */
+	int most_recently_used_index;
+
+	/* The index of the least recently used entry
+	 */
+	int least_recently_used_index;
+};
+
+int libcreg_path_cache_initialize(
+     libcreg_path_cache_t **path_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libcreg_path_cache_free(
+     libcreg_path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+int libcreg_path_cache_unlink_entry(
+     libcreg_path_cache_t *path_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcreg_path_cache_link_entry_as_most_recently_used(
+     libcreg_path_cache_t *path_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcreg_path_cache_get_key_offset(
+     libcreg_path_cache_t *path_cache,
+     uint32_t path_hash,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
+int libcreg_path_cache_set_key_offset(
+     libcreg_path_cache_t *path_cache,
+     uint32_t path_hash,
+     const libuna_unicode_character_t *path,
+     size_t path_length,
+     uint32_t key_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_PATH_CACHE_H ) */
+
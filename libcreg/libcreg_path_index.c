@@ -0,0 +1,940 @@
+/*
+ * Path index functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_WCTYPE_H ) || defined( HAVE_WINAPI )
+#include <wctype.h>
+#endif
+
+#include "libcreg_definitions.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libuna.h"
+#include "libcreg_name_hash_table.h"
+#include "libcreg_path_index.h"
+
+/* Creates a path index
+ * Make sure the value path_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_initialize(
+     libcreg_path_index_t **path_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_initialize";
+	size_t entries_size   = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( (size_t) maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*path_index = memory_allocate_structure(
+	               libcreg_path_index_t );
+
+	if( *path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_index,
+	     0,
+	     sizeof( libcreg_path_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path index.",
+		 function );
+
+		memory_free(
+		 *path_index );
+
+		*path_index = NULL;
+
+		return( -1 );
+	}
+	entries_size = sizeof( uint32_t ) * (size_t) maximum_number_of_entries;
+
+	( *path_index )->key_offsets = (uint32_t *) memory_allocate(
+	                                             entries_size );
+
+	if( ( *path_index )->key_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_index )->path_hashes = (uint32_t *) memory_allocate(
+	                                             entries_size );
+
+	if( ( *path_index )->path_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path hashes.",
+		 function );
+
+		goto on_error;
+	}
+	entries_size = sizeof( int ) * (size_t) maximum_number_of_entries;
+
+	( *path_index )->parent_entry_indexes = (int *) memory_allocate(
+	                                                 entries_size );
+
+	if( ( *path_index )->parent_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parent entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_index )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *path_index != NULL )
+	{
+		if( ( *path_index )->path_hashes != NULL )
+		{
+			memory_free(
+			 ( *path_index )->path_hashes );
+		}
+		if( ( *path_index )->key_offsets != NULL )
+		{
+			memory_free(
+			 ( *path_index )->key_offsets );
+		}
+		memory_free(
+		 *path_index );
+
+		*path_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path index
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_free(
+     libcreg_path_index_t **path_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_free";
+	int result            = 1;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_index != NULL )
+	{
+		if( ( *path_index )->key_offset_hash_table != NULL )
+		{
+			if( libcreg_name_hash_table_free(
+			     &( ( *path_index )->key_offset_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key offset hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *path_index )->path_hash_table != NULL )
+		{
+			if( libcreg_name_hash_table_free(
+			     &( ( *path_index )->path_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *path_index )->parent_entry_indexes );
+
+		memory_free(
+		 ( *path_index )->path_hashes );
+
+		memory_free(
+		 ( *path_index )->key_offsets );
+
+		memory_free(
+		 *path_index );
+
+		*path_index = NULL;
+	}
+	return( result );
+}
+
+/* Appends an entry to the path index
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_append_entry(
+     libcreg_path_index_t *path_index,
+     uint32_t key_offset,
+     int parent_entry_index,
+     uint32_t path_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_append_entry";
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->path_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index - path hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->number_of_entries >= path_index->maximum_number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path index - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_entry_index < -1 )
+	 || ( parent_entry_index >= path_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	*entry_index = path_index->number_of_entries;
+
+	path_index->key_offsets[ *entry_index ]          = key_offset;
+	path_index->parent_entry_indexes[ *entry_index ] = parent_entry_index;
+	path_index->path_hashes[ *entry_index ]          = path_hash;
+
+	path_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Builds the hash tables of the path index
+ * Entries can no longer be appended after the hash tables have been built
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_build_hash_tables(
+     libcreg_path_index_t *path_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_build_hash_tables";
+	int entry_index       = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->path_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index - path hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->key_offset_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index - key offset hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_name_hash_table_initialize(
+	     &( path_index->path_hash_table ),
+	     path_index->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_name_hash_table_initialize(
+	     &( path_index->key_offset_hash_table ),
+	     path_index->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key offset hash table.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries are inserted in order so that the entry that was appended
+	 * first is returned first for path hashes that occur more than once
+	 */
+	for( entry_index = 0;
+	     entry_index < path_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( libcreg_name_hash_table_insert_entry(
+		     path_index->path_hash_table,
+		     path_index->path_hashes[ entry_index ],
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert entry: %d into path hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libcreg_name_hash_table_insert_entry(
+		     path_index->key_offset_hash_table,
+		     path_index->key_offsets[ entry_index ],
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert entry: %d into key offset hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( path_index->key_offset_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &( path_index->key_offset_hash_table ),
+		 NULL );
+	}
+	if( path_index->path_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &( path_index->path_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the first entry with a specific key offset
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libcreg_path_index_get_entry_index_by_key_offset(
+     libcreg_path_index_t *path_index,
+     uint32_t key_offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_get_entry_index_by_key_offset";
+	int probe_index       = 0;
+	int result            = 0;
+	int safe_entry_index  = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->key_offset_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path index - missing key offset hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libcreg_name_hash_table_get_next_entry_index(
+		          path_index->key_offset_hash_table,
+		          key_offset,
+		          &probe_index,
+		          &safe_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next entry index from key offset hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( path_index->key_offsets[ safe_entry_index ] == key_offset ) )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the index of the next entry with a specific path hash
+ * The probe index keeps track of the position in the path hash table and should be set to 0 before the first call
+ * Returns 1 if successful, 0 if there are no more entries with the path hash or -1 on error
+ */
+int libcreg_path_index_get_next_entry_index_by_path_hash(
+     libcreg_path_index_t *path_index,
+     uint32_t path_hash,
+     int *probe_index,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_get_next_entry_index_by_path_hash";
+	int result            = 0;
+	int safe_entry_index  = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->path_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path index - missing path hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libcreg_name_hash_table_get_next_entry_index(
+		          path_index->path_hash_table,
+		          path_hash,
+		          probe_index,
+		          &safe_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next entry index from path hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( path_index->path_hashes[ safe_entry_index ] == path_hash ) )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the values of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_get_entry_values(
+     libcreg_path_index_t *path_index,
+     int entry_index,
+     uint32_t *key_offset,
+     int *parent_entry_index,
+     uint32_t *path_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_path_index_get_entry_values";
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= path_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	*key_offset         = path_index->key_offsets[ entry_index ];
+	*parent_entry_index = path_index->parent_entry_indexes[ entry_index ];
+	*path_hash          = path_index->path_hashes[ entry_index ];
+
+	return( 1 );
+}
+
+/* Calculates the path hash of a codepage encoded key name
+ * The path hash is calculated from the path hash of the parent key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_calculate_path_hash_from_byte_stream(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcreg_path_index_calculate_path_hash_from_byte_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_index                     = 0;
+	uint32_t safe_path_hash                      = 0;
+
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_hash  = parent_path_hash * 37;
+	safe_path_hash += (uint32_t) LIBCREG_SEPARATOR;
+
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		safe_path_hash *= 37;
+		safe_path_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	*path_hash = safe_path_hash;
+
+	return( 1 );
+}
+
+/* Calculates the path hash of an UTF-8 encoded key name
+ * The path hash is calculated from the path hash of the parent key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_calculate_path_hash_from_utf8_string(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcreg_path_index_calculate_path_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_path_hash                      = 0;
+
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_hash  = parent_path_hash * 37;
+	safe_path_hash += (uint32_t) LIBCREG_SEPARATOR;
+
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		safe_path_hash *= 37;
+		safe_path_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	*path_hash = safe_path_hash;
+
+	return( 1 );
+}
+
+/* Calculates the path hash of an UTF-16 encoded key name
+ * The path hash is calculated from the path hash of the parent key
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_path_index_calculate_path_hash_from_utf16_string(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcreg_path_index_calculate_path_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_path_hash                      = 0;
+
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_hash  = parent_path_hash * 37;
+	safe_path_hash += (uint32_t) LIBCREG_SEPARATOR;
+
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		safe_path_hash *= 37;
+		safe_path_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	*path_hash = safe_path_hash;
+
+	return( 1 );
+}
+
@@ -0,0 +1,138 @@
+/*
+ * Path index functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_PATH_INDEX_H )
+#define _LIBCREG_PATH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_name_hash_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_path_index libcreg_path_index_t;
+
+struct libcreg_path_index
+{
+	/* The key offsets of the entries
+	 */
+	uint32_t *key_offsets;
+
+	/* The parent entry indexes of the entries
+	 * A parent entry index of -1 represents the entry has no parent
+	 */
+	int *parent_entry_indexes;
+
+	/* The path hashes of the entries
+	 */
+	uint32_t *path_hashes;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The path hash table
+	 */
+	libcreg_name_hash_table_t *path_hash_table;
+
+	/* The key offset hash table
+	 */
+	libcreg_name_hash_table_t *key_offset_hash_table;
+};
+
+int libcreg_path_index_initialize(
+     libcreg_path_index_t **path_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libcreg_path_index_free(
+     libcreg_path_index_t **path_index,
+     libcerror_error_t **error );
+
+int libcreg_path_index_append_entry(
+     libcreg_path_index_t *path_index,
+     uint32_t key_offset,
+     int parent_entry_index,
+     uint32_t path_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcreg_path_index_build_hash_tables(
+     libcreg_path_index_t *path_index,
+     libcerror_error_t **error );
+
+int libcreg_path_index_get_entry_index_by_key_offset(
+     libcreg_path_index_t *path_index,
+     uint32_t key_offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcreg_path_index_get_next_entry_index_by_path_hash(
+     libcreg_path_index_t *path_index,
+     uint32_t path_hash,
+     int *probe_index,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcreg_path_index_get_entry_values(
+     libcreg_path_index_t *path_index,
+     int entry_index,
+     uint32_t *key_offset,
+     int *parent_entry_index,
+     uint32_t *path_hash,
+     libcerror_error_t **error );
+
+int libcreg_path_index_calculate_path_hash_from_byte_stream(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libcreg_path_index_calculate_path_hash_from_utf8_string(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libcreg_path_index_calculate_path_hash_from_utf16_string(
+     uint32_t *path_hash,
+     uint32_t parent_path_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_PATH_INDEX_H ) */
+
@@ -0,0 +1,291 @@
+/*
+ * Read-ahead buffer functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcnotify.h"
+#include "libcreg_read_ahead_buffer.h"
+
+/* Creates a read-ahead buffer
+ * Make sure the value read_ahead_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_read_ahead_buffer_initialize(
+     libcreg_read_ahead_buffer_t **read_ahead_buffer,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_read_ahead_buffer_initialize";
+
+	if( read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead_buffer = memory_allocate_structure(
+	                      libcreg_read_ahead_buffer_t );
+
+	if( *read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead_buffer,
+	     0,
+	     sizeof( libcreg_read_ahead_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead_buffer )->data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * data_size );
+
+	if( ( *read_ahead_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead_buffer )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead_buffer != NULL )
+	{
+		memory_free(
+		 *read_ahead_buffer );
+
+		*read_ahead_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_read_ahead_buffer_free(
+     libcreg_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_read_ahead_buffer_free";
+
+	if( read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead_buffer != NULL )
+	{
+		if( ( *read_ahead_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead_buffer )->data );
+		}
+		memory_free(
+		 *read_ahead_buffer );
+
+		*read_ahead_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data at a specific file offset
+ * If the data is not in the read-ahead window, the window is read starting at the file offset
+ * The data is valid until the next retrieval
+ * Returns 1 if successful, 0 if the size exceeds the read-ahead window or -1 on error
+ */
+int libcreg_read_ahead_buffer_get_data_at_offset(
+     libcreg_read_ahead_buffer_t *read_ahead_buffer,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_read_ahead_buffer_get_data_at_offset";
+	ssize_t read_count    = 0;
+
+	if( read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead_buffer->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read-ahead buffer - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > read_ahead_buffer->data_size )
+	{
+		return( 0 );
+	}
+	if( ( read_ahead_buffer->read_size == 0 )
+	 || ( file_offset < read_ahead_buffer->data_offset )
+	 || ( (size_t) ( file_offset - read_ahead_buffer->data_offset ) > read_ahead_buffer->read_size )
+	 || ( size > ( read_ahead_buffer->read_size - (size_t) ( file_offset - read_ahead_buffer->data_offset ) ) ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 read_ahead_buffer->data_size,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		read_ahead_buffer->read_size = 0;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              read_ahead_buffer->data,
+		              read_ahead_buffer->data_size,
+		              file_offset,
+		              error );
+
+		/* The read can return less data than the size of the window at the end of the file
+		 */
+		if( ( read_count < 0 )
+		 || ( (size_t) read_count < size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		read_ahead_buffer->data_offset = file_offset;
+		read_ahead_buffer->read_size   = (size_t) read_count;
+	}
+	*data = &( ( read_ahead_buffer->data )[ file_offset - read_ahead_buffer->data_offset ] );
+
+	return( 1 );
+}
+
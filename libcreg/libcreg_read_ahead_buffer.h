@@ -0,0 +1,78 @@
+/*
+ * Read-ahead buffer functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_READ_AHEAD_BUFFER_H )
+#define _LIBCREG_READ_AHEAD_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libbfio.h"
+#include "libcreg_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_read_ahead_buffer libcreg_read_ahead_buffer_t;
+
+struct libcreg_read_ahead_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size, which is the size of the read-ahead window
+	 */
+	size_t data_size;
+
+	/* The file offset of the data
+	 */
+	off64_t data_offset;
+
+	/* The number of bytes of the data that were read
+	 */
+	size_t read_size;
+};
+
+int libcreg_read_ahead_buffer_initialize(
+     libcreg_read_ahead_buffer_t **read_ahead_buffer,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcreg_read_ahead_buffer_free(
+     libcreg_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error );
+
+int libcreg_read_ahead_buffer_get_data_at_offset(
+     libcreg_read_ahead_buffer_t *read_ahead_buffer,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_READ_AHEAD_BUFFER_H ) */
+
@@ -0,0 +1,557 @@
+/*
+ * Sharded cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_definitions.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfcache.h"
+#include "libcreg_sharded_cache.h"
+
+/* Creates a sharded cache
+ * The maximum number of cache entries is divided over the shards
+ * Make sure the value sharded_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_initialize(
+     libcreg_sharded_cache_t **sharded_cache,
+     int number_of_shards,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function           = "libcreg_sharded_cache_initialize";
+	size_t shards_size              = 0;
+	int maximum_shard_cache_entries = 0;
+	int shard_index                 = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sharded cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_shards <= 0 )
+	 || ( number_of_shards > LIBCREG_MAXIMUM_NUMBER_OF_CACHE_SHARDS )
+	 || ( ( number_of_shards & ( number_of_shards - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries < number_of_shards )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_shard_cache_entries = maximum_cache_entries / number_of_shards;
+
+	*sharded_cache = memory_allocate_structure(
+	                  libcreg_sharded_cache_t );
+
+	if( *sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sharded cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sharded_cache,
+	     0,
+	     sizeof( libcreg_sharded_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sharded cache.",
+		 function );
+
+		memory_free(
+		 *sharded_cache );
+
+		*sharded_cache = NULL;
+
+		return( -1 );
+	}
+	shards_size = sizeof( libcreg_sharded_cache_shard_t ) * number_of_shards;
+
+	( *sharded_cache )->shards = (libcreg_sharded_cache_shard_t *) memory_allocate(
+	                                                                shards_size );
+
+	if( ( *sharded_cache )->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *sharded_cache )->shards,
+	     0,
+	     shards_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		goto on_error;
+	}
+	( *sharded_cache )->number_of_shards = number_of_shards;
+
+	while( ( 1 << ( *sharded_cache )->number_of_shard_bits ) < number_of_shards )
+	{
+		( *sharded_cache )->number_of_shard_bits += 1;
+	}
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		if( libfcache_cache_initialize(
+		     &( ( ( *sharded_cache )->shards[ shard_index ] ).cache ),
+		     maximum_shard_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_initialize(
+		     &( ( ( *sharded_cache )->shards[ shard_index ] ).read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize read/write lock of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *sharded_cache != NULL )
+	{
+		libcreg_sharded_cache_free(
+		 sharded_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a sharded cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_free(
+     libcreg_sharded_cache_t **sharded_cache,
+     libcerror_error_t **error )
+{
+	libcreg_sharded_cache_shard_t *shard = NULL;
+	static char *function                = "libcreg_sharded_cache_free";
+	int result                           = 1;
+	int shard_index                      = 0;
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_cache != NULL )
+	{
+		if( ( *sharded_cache )->shards != NULL )
+		{
+			for( shard_index = 0;
+			     shard_index < ( *sharded_cache )->number_of_shards;
+			     shard_index++ )
+			{
+				shard = &( ( *sharded_cache )->shards[ shard_index ] );
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+				if( shard->read_write_lock != NULL )
+				{
+					if( libcthreads_read_write_lock_free(
+					     &( shard->read_write_lock ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free read/write lock of shard: %d.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+#endif
+				if( shard->cache != NULL )
+				{
+					if( libfcache_cache_free(
+					     &( shard->cache ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free cache of shard: %d.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *sharded_cache )->shards );
+		}
+		memory_free(
+		 *sharded_cache );
+
+		*sharded_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the index of the shard of a specific key
+ * The key, such as an offset or an element index, is spread over the shards
+ * using a multiplicative hash so that consecutive keys map to different shards
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_get_shard_index(
+     libcreg_sharded_cache_t *sharded_cache,
+     uint64_t key,
+     int *shard_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_sharded_cache_get_shard_index";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sharded_cache->number_of_shard_bits == 0 )
+	{
+		*shard_index = 0;
+	}
+	else
+	{
+		*shard_index = (int) ( ( key * (uint64_t) 0x9e3779b97f4a7c15ULL ) >> ( 64 - sharded_cache->number_of_shard_bits ) );
+	}
+	return( 1 );
+}
+
+/* Grabs a specific shard
+ * The shard is locked for writing since a cache lookup can replace cache values
+ * The shard must be released with libcreg_sharded_cache_release_shard
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_grab_shard(
+     libcreg_sharded_cache_t *sharded_cache,
+     int shard_index,
+     libcreg_sharded_cache_shard_t **shard,
+     libcerror_error_t **error )
+{
+	libcreg_sharded_cache_shard_t *safe_shard = NULL;
+	static char *function                     = "libcreg_sharded_cache_grab_shard";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= sharded_cache->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	safe_shard = &( sharded_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     safe_shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*shard = safe_shard;
+
+	return( 1 );
+}
+
+/* Releases a shard that was grabbed with libcreg_sharded_cache_grab_shard
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_release_shard(
+     libcreg_sharded_cache_t *sharded_cache,
+     libcreg_sharded_cache_shard_t *shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libcreg_sharded_cache_release_shard";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard == NULL )
+	 || ( shard < sharded_cache->shards )
+	 || ( shard >= &( sharded_cache->shards[ sharded_cache->number_of_shards ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of hits and misses of a specific shard
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_sharded_cache_get_statistics(
+     libcreg_sharded_cache_t *sharded_cache,
+     int shard_index,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libcreg_sharded_cache_shard_t *shard = NULL;
+	static char *function                = "libcreg_sharded_cache_get_statistics";
+
+	if( sharded_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= sharded_cache->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	shard = &( sharded_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = shard->number_of_hits;
+	*number_of_misses = shard->number_of_misses;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Sharded cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_SHARDED_CACHE_H )
+#define _LIBCREG_SHARDED_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_sharded_cache_shard libcreg_sharded_cache_shard_t;
+
+struct libcreg_sharded_cache_shard
+{
+	/* The cache
+	 */
+	libfcache_cache_t *cache;
+
+	/* The number of lookups that were served from the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that required the value to be read
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+typedef struct libcreg_sharded_cache libcreg_sharded_cache_t;
+
+struct libcreg_sharded_cache
+{
+	/* The shards
+	 */
+	libcreg_sharded_cache_shard_t *shards;
+
+	/* The number of shards, which is a power of 2
+	 */
+	int number_of_shards;
+
+	/* The number of bits used to determine the shard of a key
+	 */
+	uint8_t number_of_shard_bits;
+};
+
+int libcreg_sharded_cache_initialize(
+     libcreg_sharded_cache_t **sharded_cache,
+     int number_of_shards,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+int libcreg_sharded_cache_free(
+     libcreg_sharded_cache_t **sharded_cache,
+     libcerror_error_t **error );
+
+int libcreg_sharded_cache_get_shard_index(
+     libcreg_sharded_cache_t *sharded_cache,
+     uint64_t key,
+     int *shard_index,
+     libcerror_error_t **error );
+
+int libcreg_sharded_cache_grab_shard(
+     libcreg_sharded_cache_t *sharded_cache,
+     int shard_index,
+     libcreg_sharded_cache_shard_t **shard,
+     libcerror_error_t **error );
+
+int libcreg_sharded_cache_release_shard(
+     libcreg_sharded_cache_t *sharded_cache,
+     libcreg_sharded_cache_shard_t *shard,
+     libcerror_error_t **error );
+
+int libcreg_sharded_cache_get_statistics(
+     libcreg_sharded_cache_t *sharded_cache,
+     int shard_index,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_SHARDED_CACHE_H ) */
+
@@ -36,15 +36,57 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libcreg_file {}	libcreg_file_t;
 typedef struct libcreg_key {}	libcreg_key_t;
+typedef struct libcreg_key_cursor {}	libcreg_key_cursor_t;
 typedef struct libcreg_value {}	libcreg_value_t;
+typedef struct libcreg_value_cursor {}	libcreg_value_cursor_t;
 
 #else
 typedef intptr_t libcreg_file_t;
 typedef intptr_t libcreg_key_t;
+typedef intptr_t libcreg_key_cursor_t;
 typedef intptr_t libcreg_value_t;
+typedef intptr_t libcreg_value_cursor_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The walk callbacks
+ */
+typedef struct libcreg_walk_callbacks libcreg_walk_callbacks_t;
+
+struct libcreg_walk_callbacks
+{
+	/* The function called for every key
+	 * The name is codepage encoded and is NULL if the key has no name
+	 * The callbacks are called while the walk holds the lock of the file, hence they must not
+	 * call functions of the same file, which would deadlock
+	 * Returns 1 to walk the values and sub keys of the key, 0 to skip them or -1 on error
+	 */
+	int (*key_callback)(
+	       off64_t key_offset,
+	       int depth,
+	       const uint8_t *name,
+	       size_t name_size,
+	       void *callback_data );
+
+	/* The function called for every value of a walked key
+	 * The name is codepage encoded and is NULL if the value has no name
+	 * Returns 1 if successful or -1 on error
+	 */
+	int (*value_callback)(
+	       off64_t key_offset,
+	       int depth,
+	       const uint8_t *name,
+	       size_t name_size,
+	       uint32_t value_type,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data );
+
+	/* The data passed to the callbacks
+	 */
+	void *callback_data;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBCREG ) */
 
 #endif /* !defined( _LIBCREG_INTERNAL_TYPES_H ) */
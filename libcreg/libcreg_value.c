@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libcreg_definitions.h"
+#include "libcreg_data_block.h"
 #include "libcreg_io_handle.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libuna.h"
@@ -38,6 +39,7 @@
 int libcreg_value_initialize(
      libcreg_value_t **value,
      libcreg_io_handle_t *io_handle,
+     libcreg_data_block_t *data_block,
      libcreg_value_entry_t *value_entry,
      libcerror_error_t **error )
 {
@@ -108,7 +110,24 @@ int libcreg_value_initialize(
 
 		return( -1 );
 	}
+	if( data_block != NULL )
+	{
+		if( libcreg_data_block_grab_reference(
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	internal_value->io_handle   = io_handle;
+	internal_value->data_block  = data_block;
 	internal_value->value_entry = value_entry;
 
 	*value = (libcreg_value_t *) internal_value;
@@ -133,6 +152,7 @@ int libcreg_value_free(
 {
 	libcreg_internal_value_t *internal_value = NULL;
 	static char *function                    = "libcreg_value_free";
+	int result                               = 1;
 
 	if( value == NULL )
 	{
@@ -150,12 +170,25 @@ int libcreg_value_free(
 		internal_value = (libcreg_internal_value_t *) *value;
 		*value         = NULL;
 
+		if( libcreg_data_block_release_reference(
+		     &( internal_value->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
+
+			result = -1;
+		}
 		/* The io_handle and value_entry references are freed elsewhere
 		 */
 		memory_free(
 		 internal_value );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Determine if the value corrupted
@@ -398,6 +431,72 @@ int libcreg_value_get_name(
 	return( 1 );
 }
 
+/* Retrieves a reference to the value name
+ * The name is codepage encoded, owned by the library and not copied
+ * The reference remains valid while the value and the file it was retrieved from are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_get_name_reference(
+     libcreg_value_t *value,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_t *internal_value = NULL;
+	static char *function                    = "libcreg_value_get_name_reference";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libcreg_internal_value_t *) value;
+
+	if( internal_value->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string      = internal_value->value_entry->name;
+	*string_size = (size_t) internal_value->value_entry->name_size;
+
+	return( 1 );
+}
+
 /* Retrieves the UTF-8 string size of the value name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -932,6 +1031,89 @@ int libcreg_value_get_value_data(
 	return( 1 );
 }
 
+/* Retrieves a reference to the value data
+ * The value data is owned by the library and not copied
+ * The reference remains valid while the value and the file it was retrieved from are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_get_value_data_reference(
+     libcreg_value_t *value,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_t *internal_value = NULL;
+	uint8_t *data                            = NULL;
+	static char *function                    = "libcreg_value_get_value_data_reference";
+	size_t data_size                         = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libcreg_internal_value_t *) value;
+
+	if( internal_value->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcreg_value_entry_get_data(
+	     internal_value->value_entry,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data      = data;
+	*value_data_size = data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the 32-bit value
  * Returns 1 if successful or -1 on error
  */
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcreg_data_block.h"
 #include "libcreg_extern.h"
 #include "libcreg_io_handle.h"
 #include "libcreg_libcerror.h"
@@ -43,6 +44,10 @@ struct libcreg_internal_value
 	 */
 	libcreg_io_handle_t *io_handle;
 
+	/* The data block that contains the value entry
+	 */
+	libcreg_data_block_t *data_block;
+
 	/* The value entry
 	 */
 	libcreg_value_entry_t *value_entry;
@@ -51,6 +56,7 @@ struct libcreg_internal_value
 int libcreg_value_initialize(
      libcreg_value_t **value,
      libcreg_io_handle_t *io_handle,
+     libcreg_data_block_t *data_block,
      libcreg_value_entry_t *value_entry,
      libcerror_error_t **error );
 
@@ -83,6 +89,13 @@ int libcreg_value_get_name(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_value_get_name_reference(
+     libcreg_value_t *value,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_value_get_utf8_name_size(
      libcreg_value_t *value,
@@ -128,6 +141,13 @@ int libcreg_value_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBCREG_EXTERN \
+int libcreg_value_get_value_data_reference(
+     libcreg_value_t *value,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBCREG_EXTERN \
 int libcreg_value_get_value_32bit(
      libcreg_value_t *value,
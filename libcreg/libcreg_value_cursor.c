@@ -0,0 +1,902 @@
+/*
+ * Value cursor functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_io_handle.h"
+#include "libcreg_key_name_entry.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_types.h"
+#include "libcreg_value.h"
+#include "libcreg_value_cursor.h"
+#include "libcreg_value_entry.h"
+
+/* Creates a value cursor
+ * The cursor iterates the values of the key name entry and is initially positioned before the first value
+ * Make sure the value value_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_initialize(
+     libcreg_value_cursor_t **value_cursor,
+     libcreg_io_handle_t *io_handle,
+     libcreg_data_block_t *data_block,
+     libcreg_key_name_entry_t *key_name_entry,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_initialize";
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = memory_allocate_structure(
+	                         libcreg_internal_value_cursor_t );
+
+	if( internal_value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal value cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_value_cursor,
+	     0,
+	     sizeof( libcreg_internal_value_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal value cursor.",
+		 function );
+
+		memory_free(
+		 internal_value_cursor );
+
+		return( -1 );
+	}
+	/* A key without a key name entry has no values
+	 */
+	if( key_name_entry != NULL )
+	{
+		if( libcreg_key_name_entry_get_number_of_entries(
+		     key_name_entry,
+		     &( internal_value_cursor->number_of_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_value_cursor->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( data_block != NULL )
+	{
+		if( libcreg_data_block_grab_reference(
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_value_cursor->io_handle      = io_handle;
+	internal_value_cursor->data_block     = data_block;
+	internal_value_cursor->key_name_entry = key_name_entry;
+	internal_value_cursor->value_index    = -1;
+
+	*value_cursor = (libcreg_value_cursor_t *) internal_value_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_value_cursor != NULL )
+	{
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( internal_value_cursor->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_value_cursor->read_write_lock ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_value_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a value cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_free(
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_free";
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_cursor != NULL )
+	{
+		internal_value_cursor = (libcreg_internal_value_cursor_t *) *value_cursor;
+		*value_cursor         = NULL;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_value_cursor->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcreg_data_block_release_reference(
+		     &( internal_value_cursor->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release data block.",
+			 function );
+
+			result = -1;
+		}
+		/* The io_handle, key_name_entry and value_entry references are freed elsewhere
+		 */
+		memory_free(
+		 internal_value_cursor );
+	}
+	return( result );
+}
+
+/* Moves the value cursor to the next value
+ * Returns 1 if successful, 0 if there are no more values or -1 on error
+ */
+int libcreg_value_cursor_next(
+     libcreg_value_cursor_t *value_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_next";
+	int result                                             = 0;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_value_cursor->value_entry = NULL;
+
+	if( ( internal_value_cursor->value_index + 1 ) < internal_value_cursor->number_of_values )
+	{
+		internal_value_cursor->value_index += 1;
+
+		if( libcreg_key_name_entry_get_entry_by_index(
+		     internal_value_cursor->key_name_entry,
+		     internal_value_cursor->value_index,
+		     &( internal_value_cursor->value_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry: %d.",
+			 function,
+			 internal_value_cursor->value_index );
+
+			internal_value_cursor->value_entry = NULL;
+
+			result = -1;
+		}
+		else if( internal_value_cursor->value_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value entry: %d.",
+			 function,
+			 internal_value_cursor->value_index );
+
+			result = -1;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	else
+	{
+		internal_value_cursor->value_index = internal_value_cursor->number_of_values;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resets the value cursor to before the first value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_reset(
+     libcreg_value_cursor_t *value_cursor,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_reset";
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_value_cursor->value_index = -1;
+	internal_value_cursor->value_entry = NULL;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the offset of the current value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_get_offset(
+     libcreg_value_cursor_t *value_cursor,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_get_offset";
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_value_cursor->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value cursor - not positioned on a value.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*offset = (off64_t) internal_value_cursor->value_entry->offset;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the name of the current value
+ * The name is codepage encoded and not copied, it remains valid as long as the file is open
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_get_name_reference(
+     libcreg_value_cursor_t *value_cursor,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_get_name_reference";
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_value_cursor->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value cursor - not positioned on a value.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*string      = internal_value_cursor->value_entry->name;
+		*string_size = (size_t) internal_value_cursor->value_entry->name_size;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value type of the current value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_get_value_type(
+     libcreg_value_cursor_t *value_cursor,
+     uint32_t *value_type,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_get_value_type";
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_value_cursor->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value cursor - not positioned on a value.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*value_type = internal_value_cursor->value_entry->type;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value data of the current value
+ * The data is not copied, it remains valid as long as the file is open
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_get_value_data_reference(
+     libcreg_value_cursor_t *value_cursor,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_get_value_data_reference";
+	uint8_t *data                                          = NULL;
+	size_t data_size                                       = 0;
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_value_cursor->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value cursor - not positioned on a value.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_value_entry_get_data(
+	          internal_value_cursor->value_entry,
+	          &data,
+	          &data_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*value_data      = data;
+		*value_data_size = data_size;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the current value
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_cursor_get_value(
+     libcreg_value_cursor_t *value_cursor,
+     libcreg_value_t **value,
+     libcerror_error_t **error )
+{
+	libcreg_internal_value_cursor_t *internal_value_cursor = NULL;
+	static char *function                                  = "libcreg_value_cursor_get_value";
+	int result                                             = 1;
+
+	if( value_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value_cursor = (libcreg_internal_value_cursor_t *) value_cursor;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_value_cursor->value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value cursor - not positioned on a value.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcreg_value_initialize(
+	          value,
+	          internal_value_cursor->io_handle,
+	          internal_value_cursor->data_block,
+	          internal_value_cursor->value_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_value_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
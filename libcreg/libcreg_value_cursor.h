@@ -0,0 +1,137 @@
+/*
+ * Value cursor functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCREG_INTERNAL_VALUE_CURSOR_H )
+#define _LIBCREG_INTERNAL_VALUE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcreg_data_block.h"
+#include "libcreg_extern.h"
+#include "libcreg_io_handle.h"
+#include "libcreg_key_name_entry.h"
+#include "libcreg_libcerror.h"
+#include "libcreg_libcthreads.h"
+#include "libcreg_types.h"
+#include "libcreg_value_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcreg_internal_value_cursor libcreg_internal_value_cursor_t;
+
+struct libcreg_internal_value_cursor
+{
+	/* The IO handle
+	 */
+	libcreg_io_handle_t *io_handle;
+
+	/* The data block that contains the key name entry
+	 */
+	libcreg_data_block_t *data_block;
+
+	/* The key name entry that contains the values
+	 * The key name entry is owned by the data block
+	 */
+	libcreg_key_name_entry_t *key_name_entry;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The index of the current value
+	 */
+	int value_index;
+
+	/* The value entry of the current value or NULL if the cursor is not positioned on a value
+	 * The value entry is owned by the key name entry
+	 */
+	libcreg_value_entry_t *value_entry;
+
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libcreg_value_cursor_initialize(
+     libcreg_value_cursor_t **value_cursor,
+     libcreg_io_handle_t *io_handle,
+     libcreg_data_block_t *data_block,
+     libcreg_key_name_entry_t *key_name_entry,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_free(
+     libcreg_value_cursor_t **value_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_next(
+     libcreg_value_cursor_t *value_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_reset(
+     libcreg_value_cursor_t *value_cursor,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_get_offset(
+     libcreg_value_cursor_t *value_cursor,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_get_name_reference(
+     libcreg_value_cursor_t *value_cursor,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_get_value_type(
+     libcreg_value_cursor_t *value_cursor,
+     uint32_t *value_type,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_get_value_data_reference(
+     libcreg_value_cursor_t *value_cursor,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBCREG_EXTERN \
+int libcreg_value_cursor_get_value(
+     libcreg_value_cursor_t *value_cursor,
+     libcreg_value_t **value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCREG_INTERNAL_VALUE_CURSOR_H ) */
+
@@ -30,6 +30,8 @@
 
 #include "libcreg_data_type.h"
 #include "libcreg_debug.h"
+#include "libcreg_definitions.h"
+#include "libcreg_folded_name.h"
 #include "libcreg_libcerror.h"
 #include "libcreg_libcnotify.h"
 #include "libcreg_libuna.h"
@@ -133,16 +135,23 @@ int libcreg_value_entry_free(
 	}
 	if( *value_entry != NULL )
 	{
-		if( ( *value_entry )->data != NULL )
+		if( ( ( ( *value_entry )->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+		 && ( ( *value_entry )->data != NULL ) )
 		{
 			memory_free(
 			 ( *value_entry )->data );
 		}
-		if( ( *value_entry )->name != NULL )
+		if( ( ( ( *value_entry )->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+		 && ( ( *value_entry )->name != NULL ) )
 		{
 			memory_free(
 			 ( *value_entry )->name );
 		}
+		if( ( *value_entry )->folded_name != NULL )
+		{
+			memory_free(
+			 ( *value_entry )->folded_name );
+		}
 		memory_free(
 		 *value_entry );
 
@@ -313,35 +322,58 @@ int libcreg_value_entry_read_data(
 
 			goto on_error;
 		}
-		value_entry->name = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * (size_t) value_entry->name_size );
-
-		if( value_entry->name == NULL )
+		if( ( value_entry->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
-			 function );
+			value_entry->name = (uint8_t *) &( data[ value_data_offset ] );
+		}
+		else
+		{
+			value_entry->name = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * (size_t) value_entry->name_size );
 
-			goto on_error;
+			if( value_entry->name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     value_entry->name,
+			     &( data[ value_data_offset ] ),
+			     (size_t) value_entry->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( memory_copy(
+		value_entry->name_hash = 0;
+
+		if( libcreg_folded_name_initialize(
+		     &( value_entry->folded_name ),
 		     value_entry->name,
-		     &( data[ value_data_offset ] ),
-		     (size_t) value_entry->name_size ) == NULL )
+		     (size_t) value_entry->name_size,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create folded name.",
 			 function );
 
 			goto on_error;
 		}
-		value_entry->name_hash = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -381,33 +413,40 @@ int libcreg_value_entry_read_data(
 
 			goto on_error;
 		}
-		value_entry->data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * (size_t) value_entry->data_size );
-
-		if( value_entry->data == NULL )
+		if( ( value_entry->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data.",
-			 function );
-
-			goto on_error;
+			value_entry->data = (uint8_t *) &( data[ value_data_offset ] );
 		}
-		if( memory_copy(
-		     value_entry->data,
-		     &( data[ value_data_offset ] ),
-		     (size_t) value_entry->data_size ) == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data.",
-			 function );
+			value_entry->data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * (size_t) value_entry->data_size );
 
-			goto on_error;
+			if( value_entry->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     value_entry->data,
+			     &( data[ value_data_offset ] ),
+			     (size_t) value_entry->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				goto on_error;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -426,21 +465,28 @@ int libcreg_value_entry_read_data(
 	return( 1 );
 
 on_error:
-	if( value_entry->data != NULL )
+	if( ( ( value_entry->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+	 && ( value_entry->data != NULL ) )
 	{
 		memory_free(
 		 value_entry->data );
-
-		value_entry->data = NULL;
 	}
+	value_entry->data = NULL;
 	value_entry->data_size = 0;
 
-	if( value_entry->name != NULL )
+	if( ( ( value_entry->flags & LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA ) == 0 )
+	 && ( value_entry->name != NULL ) )
 	{
 		memory_free(
 		 value_entry->name );
+	}
+	value_entry->name = NULL;
+	if( value_entry->folded_name != NULL )
+	{
+		memory_free(
+		 value_entry->folded_name );
 
-		value_entry->name = NULL;
+		value_entry->folded_name = NULL;
 	}
 	value_entry->name_size = 0;
 
@@ -534,6 +580,70 @@ int libcreg_value_entry_get_data(
 	return( 1 );
 }
 
+/* Calculates the name hash
+ * The name hash is the hash of the upper case Unicode characters of the name,
+ * as used by the value name lookups
+ * Returns 1 if successful or -1 on error
+ */
+int libcreg_value_entry_calculate_name_hash(
+     libcreg_value_entry_t *value_entry,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcreg_value_entry_calculate_name_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t name_index                            = 0;
+	uint32_t name_hash                           = 0;
+
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value entry - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	while( name_index < (size_t) value_entry->name_size )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     value_entry->name,
+		     (size_t) value_entry->name_size,
+		     &name_index,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		name_hash *= 37;
+		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	value_entry->name_hash = name_hash;
+
+	return( 1 );
+}
+
 /* Compares the value name with UTF-8 string
  * Returns 1 if the names match, 0 if not or -1 on error
  */
@@ -550,6 +660,7 @@ int libcreg_value_entry_compare_name_with_utf8_string(
 	libuna_unicode_character_t string_character = 0;
 	size_t name_index                           = 0;
 	size_t utf8_string_index                    = 0;
+	int result                                  = 0;
 
 	if( value_entry == NULL )
 	{
@@ -601,6 +712,33 @@ int libcreg_value_entry_compare_name_with_utf8_string(
 	 || ( value_entry->name_hash == 0 )
 	 || ( value_entry->name_hash == name_hash ) )
 	{
+		if( value_entry->folded_name != NULL )
+		{
+			result = libcreg_folded_name_compare_with_utf8_string(
+			          value_entry->folded_name,
+			          (size_t) value_entry->name_size,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare folded name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			/* A string that contains non-ASCII characters requires a full compare
+			 */
+			else if( result != 2 )
+			{
+				return( result );
+			}
+		}
 		while( name_index < (size_t) value_entry->name_size )
 		{
 			if( utf8_string_index >= utf8_string_length )
@@ -670,6 +808,7 @@ int libcreg_value_entry_compare_name_with_utf16_string(
 	libuna_unicode_character_t string_character = 0;
 	size_t name_index                           = 0;
 	size_t utf16_string_index                   = 0;
+	int result                                  = 0;
 
 	if( value_entry == NULL )
 	{
@@ -721,6 +860,33 @@ int libcreg_value_entry_compare_name_with_utf16_string(
 	 || ( value_entry->name_hash == 0 )
 	 || ( value_entry->name_hash == name_hash ) )
 	{
+		if( value_entry->folded_name != NULL )
+		{
+			result = libcreg_folded_name_compare_with_utf16_string(
+			          value_entry->folded_name,
+			          (size_t) value_entry->name_size,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare folded name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			/* A string that contains non-ASCII characters requires a full compare
+			 */
+			else if( result != 2 )
+			{
+				return( result );
+			}
+		}
 		while( name_index < (size_t) value_entry->name_size )
 		{
 			if( utf16_string_index >= utf16_string_length )
@@ -55,6 +55,11 @@ struct libcreg_value_entry
 	 */
 	uint16_t name_size;
 
+	/* The case folded name
+	 * The case folded name is only set if the name consists of ASCII characters
+	 */
+	uint8_t *folded_name;
+
 	/* The type
 	 */
 	uint32_t type;
@@ -98,6 +103,11 @@ int libcreg_value_entry_get_data(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libcreg_value_entry_calculate_name_hash(
+     libcreg_value_entry_t *value_entry,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
 int libcreg_value_entry_compare_name_with_utf8_string(
      libcreg_value_entry_t *value_entry,
      uint32_t name_hash,
@@ -0,0 +1,173 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_checksum.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_checksum_calculate_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_checksum_calculate_adler32(
+     void )
+{
+	uint8_t data[ 9 ]        = { 'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a' };
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_checksum_calculate_adler32(
+	          &checksum,
+	          data,
+	          9,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x11e60398UL );
+
+	/* Test error cases
+	 */
+	result = libcreg_checksum_calculate_adler32(
+	          NULL,
+	          data,
+	          9,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_checksum_calculate_adler32(
+	          &checksum,
+	          NULL,
+	          9,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_checksum_calculate_adler32(
+	          &checksum,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_checksum_calculate_adler32",
+	 creg_test_checksum_calculate_adler32 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
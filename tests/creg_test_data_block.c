@@ -34,6 +34,18 @@
 #include "creg_test_unused.h"
 
 #include "../libcreg/libcreg_data_block.h"
+#include "../libcreg/libcreg_definitions.h"
+
+uint8_t creg_test_data_block_header_data1[ 32 ] = {
+	0x52, 0x47, 0x44, 0x42, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t creg_test_data_block_entries_data1[ 72 ] = {
+	0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4b, 0x65, 0x79, 0x32, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4b, 0x65, 0x79, 0x30 };
 
 #if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
 
@@ -270,6 +282,180 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcreg_data_block_read_header_data function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_read_header_data(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_data_block_t *data_block = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_data_block_initialize(
+	          &data_block,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_data_block_read_header_data(
+	          data_block,
+	          creg_test_data_block_header_data1,
+	          32,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->size",
+	 data_block->size,
+	 (uint32_t) 0x00001000UL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->unused_size",
+	 data_block->unused_size,
+	 (uint32_t) 0x00000020UL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->used_size",
+	 data_block->used_size,
+	 (uint32_t) 0x00000fc0UL );
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_read_header_data(
+	          NULL,
+	          creg_test_data_block_header_data1,
+	          32,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_data_block_read_header_data(
+	          data_block,
+	          NULL,
+	          32,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_data_block_read_header_data(
+	          data_block,
+	          creg_test_data_block_header_data1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data block header with invalid signature
+	 */
+	creg_test_data_block_header_data1[ 0 ] = 0xff;
+
+	result = libcreg_data_block_read_header_data(
+	          data_block,
+	          creg_test_data_block_header_data1,
+	          32,
+	          &error );
+
+	creg_test_data_block_header_data1[ 0 ] = 0x52;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcreg_data_block_free(
+	          &data_block,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libcreg_data_block_get_number_of_entries function
  * Returns 1 if successful or 0 if not
  */
@@ -388,6 +574,280 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcreg_data_block_get_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libcreg_data_block_t *data_block         = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_data_block_initialize(
+	          &data_block,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_block->size = 32 + 72;
+
+	result = libcreg_data_block_read_entries_data(
+	          data_block,
+	          creg_test_data_block_entries_data1,
+	          72,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_data_block_get_number_of_entries(
+	          data_block,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The entries are sorted by identifier and not read yet
+	 */
+	CREG_TEST_ASSERT_EQUAL_UINT16(
+	 "data_block->entry_identifiers[ 0 ]",
+	 data_block->entry_identifiers[ 0 ],
+	 (uint16_t) 0 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->entry_data_offsets[ 0 ]",
+	 data_block->entry_data_offsets[ 0 ],
+	 (uint32_t) 48 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT16(
+	 "data_block->entry_identifiers[ 1 ]",
+	 data_block->entry_identifiers[ 1 ],
+	 (uint16_t) 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "data_block->entries[ 0 ]",
+	 data_block->entries[ 0 ] );
+
+	/* Test regular cases
+	 */
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          0,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_name_entry->offset",
+	 key_name_entry->offset,
+	 (uint32_t) 80 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_name_entry->name == &( data_block->data[ 68 ] )",
+	 (int) ( key_name_entry->name == &( data_block->data[ 68 ] ) ),
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "data_block->entries[ 1 ]",
+	 data_block->entries[ 1 ] );
+
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          0,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_name_entry == data_block->entries[ 0 ]",
+	 (int) ( key_name_entry == data_block->entries[ 0 ] ),
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          2,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_name_entry->offset",
+	 key_name_entry->offset,
+	 (uint32_t) 32 );
+
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          1,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          0xffff,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_get_entry_by_identifier(
+	          NULL,
+	          0,
+	          &key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_data_block_get_entry_by_identifier(
+	          data_block,
+	          0,
+	          NULL,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_data_block_free(
+	          &data_block,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		libcreg_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
 
 /* The main program
@@ -415,6 +875,10 @@ int main(
 	 "libcreg_data_block_free",
 	 creg_test_data_block_free );
 
+	CREG_TEST_RUN(
+	 "libcreg_data_block_read_header_data",
+	 creg_test_data_block_read_header_data );
+
 	/* TODO: add tests for libcreg_data_block_read_header */
 
 	/* TODO: add tests for libcreg_data_block_read_entries */
@@ -423,7 +887,9 @@ int main(
 	 "libcreg_data_block_get_number_of_entries",
 	 creg_test_data_block_get_number_of_entries );
 
-	/* TODO: add tests for libcreg_data_block_get_entry_by_identifier */
+	CREG_TEST_RUN(
+	 "libcreg_data_block_get_entry_by_identifier",
+	 creg_test_data_block_get_entry_by_identifier );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
 
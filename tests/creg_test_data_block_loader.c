@@ -0,0 +1,374 @@
+/*
+ * Library data_block_loader type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_functions.h"
+#include "creg_test_libbfio.h"
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_data_block.h"
+#include "../libcreg/libcreg_data_block_loader.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_data_block_loader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_loader_initialize(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libcreg_data_block_t *data_blocks[ 1 ]         = { NULL };
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libcreg_data_block_loader_t *data_block_loader = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = creg_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          32,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_loader_initialize(
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          data_blocks,
+	          1,
+	          0,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_block_loader = (libcreg_data_block_loader_t *) 0x12345678UL;
+
+	result = libcreg_data_block_loader_initialize(
+	          &data_block_loader,
+	          file_io_handle,
+	          NULL,
+	          data_blocks,
+	          1,
+	          0,
+	          1,
+	          &error );
+
+	data_block_loader = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_data_block_loader_initialize(
+	          &data_block_loader,
+	          file_io_handle,
+	          NULL,
+	          data_blocks,
+	          1,
+	          0,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "data_block_loader",
+	 data_block_loader );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = creg_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_data_block_loader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_loader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_loader_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_data_block_loader_read_data_block function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_loader_read_data_block(
+     void )
+{
+	libcreg_data_block_t *data_block = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_loader_read_data_block(
+	          NULL,
+	          0,
+	          &data_block,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_data_block_loader_load_data_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_loader_load_data_blocks(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_loader_load_data_blocks(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_data_block_loader_load_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_data_block_loader_load_callback(
+     void )
+{
+	int result = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_data_block_loader_load_callback(
+	          NULL );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_data_block_loader_initialize",
+	 creg_test_data_block_loader_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_data_block_loader_free",
+	 creg_test_data_block_loader_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_data_block_loader_read_data_block",
+	 creg_test_data_block_loader_read_data_block );
+
+	CREG_TEST_RUN(
+	 "libcreg_data_block_loader_load_data_blocks",
+	 creg_test_data_block_loader_load_data_blocks );
+
+	CREG_TEST_RUN(
+	 "libcreg_data_block_loader_load_callback",
+	 creg_test_data_block_loader_load_callback );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
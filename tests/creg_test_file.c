@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +38,7 @@
 #include "creg_test_libcreg.h"
 #include "creg_test_macros.h"
 #include "creg_test_memory.h"
+#include "creg_test_unused.h"
 
 #include "../libcreg/libcreg_file.h"
 
@@ -1001,58 +1003,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcreg_file_close function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_close(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test error cases
-	 */
-	result = libcreg_file_close(
-	          NULL,
-	          &error );
-
-	CREG_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcreg_file_open and libcreg_file_close functions
+/* Tests the libcreg_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int creg_test_file_open_close(
+int creg_test_file_open_memory(
      const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	libcreg_file_t *file     = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libcreg_file_t *file             = NULL;
+	uint8_t *buffer                  = NULL;
+	size64_t file_size               = 0;
+	size_t buffer_size               = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = libcreg_file_initialize(
-	          &file,
+	result = libbfio_file_initialize(
+	          &file_io_handle,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1061,29 +1031,29 @@ int creg_test_file_open_close(
 	 1 );
 
 	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	 "file_io_handle",
+	 file_io_handle );
 
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
-	 */
+	string_length = system_string_length(
+	                 source );
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcreg_file_open_wide(
-	          file,
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
 	          source,
-	          LIBCREG_OPEN_READ,
+	          string_length,
 	          &error );
 #else
-	result = libcreg_file_open(
-	          file,
+	result = libbfio_file_set_name(
+	          file_io_handle,
 	          source,
-	          LIBCREG_OPEN_READ,
+	          string_length,
 	          &error );
 #endif
-
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1093,34 +1063,24 @@ int creg_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libcreg_file_close(
-	          file,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcreg_file_open_wide(
-	          file,
-	          source,
-	          LIBCREG_OPEN_READ,
-	          &error );
-#else
-	result = libcreg_file_open(
-	          file,
-	          source,
-	          LIBCREG_OPEN_READ,
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
 	          &error );
-#endif
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1131,8 +1091,38 @@ int creg_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libcreg_file_close(
-	          file,
+	CREG_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) 0 );
+
+	buffer_size = (size_t) file_size;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              0,
+	              &error );
+
+	CREG_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) buffer_size );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1144,10 +1134,8 @@ int creg_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libcreg_file_free(
-	          &file,
+	result = libbfio_handle_free(
+	          &file_io_handle,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1156,6 +1144,19 @@ int creg_test_file_open_close(
 	 1 );
 
 	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_initialize(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
 	 "file",
 	 file );
 
@@ -1163,36 +1164,13 @@ int creg_test_file_open_close(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
-	{
-		libcreg_file_free(
-		 &file,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcreg_file_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_signal_abort(
-     libcreg_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
+	/* Test open with a copy of the buffer
 	 */
-	result = libcreg_file_signal_abort(
+	result = libcreg_file_open_memory(
 	          file,
+	          buffer,
+	          buffer_size,
+	          0,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1204,10 +1182,13 @@ int creg_test_file_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open when already opened
 	 */
-	result = libcreg_file_signal_abort(
-	          NULL,
+	result = libcreg_file_open_memory(
+	          file,
+	          buffer,
+	          buffer_size,
+	          0,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1222,36 +1203,45 @@ int creg_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libcreg_file_close(
+	          file,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-/* Tests the libcreg_file_is_corrupted function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_is_corrupted(
-     libcreg_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
+	/* Test open with a borrowed buffer
 	 */
-	result = libcreg_file_is_corrupted(
+	result = libcreg_file_open_memory(
 	          file,
+	          buffer,
+	          buffer_size,
+	          LIBCREG_MEMORY_FLAG_BORROW_BUFFER,
 	          &error );
 
-	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_close(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1259,8 +1249,11 @@ int creg_test_file_is_corrupted(
 
 	/* Test error cases
 	 */
-	result = libcreg_file_is_corrupted(
+	result = libcreg_file_open_memory(
 	          NULL,
+	          buffer,
+	          buffer_size,
+	          0,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1275,51 +1268,432 @@ int creg_test_file_is_corrupted(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libcreg_file_open_memory(
+	          file,
+	          NULL,
+	          buffer_size,
+	          0,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libcreg_file_get_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_get_ascii_codepage(
-     libcreg_file_t *file )
-{
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libcreg_file_get_ascii_codepage(
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_open_memory(
 	          file,
-	          &ascii_codepage,
+	          buffer,
+	          0,
+	          0,
 	          &error );
 
-	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	CREG_TEST_ASSERT_IS_NULL(
+	CREG_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libcreg_file_get_ascii_codepage(
-	          NULL,
-	          &ascii_codepage,
+	result = libcreg_file_open_memory(
+	          file,
+	          buffer,
+	          buffer_size,
+	          0xff,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_file_free(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcreg_file_free(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_file_close(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_open and libcreg_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_file_initialize(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcreg_file_open_wide(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#else
+	result = libcreg_file_open(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#endif
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_close(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcreg_file_open_wide(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#else
+	result = libcreg_file_open(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#endif
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_close(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcreg_file_free(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcreg_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_signal_abort(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_signal_abort(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_signal_abort(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_is_corrupted function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_is_corrupted(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_is_corrupted(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_is_corrupted(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_ascii_codepage(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1336,23 +1710,1938 @@ int creg_test_file_get_ascii_codepage(
 
 	if( ascii_codepage_is_set != 0 )
 	{
-		result = libcreg_file_get_ascii_codepage(
-		          file,
-		          NULL,
-		          &error );
+		result = libcreg_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_set_ascii_codepage(
+     libcreg_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBCREG_CODEPAGE_ASCII,
+		LIBCREG_CODEPAGE_WINDOWS_874,
+		LIBCREG_CODEPAGE_WINDOWS_932,
+		LIBCREG_CODEPAGE_WINDOWS_936,
+		LIBCREG_CODEPAGE_WINDOWS_949,
+		LIBCREG_CODEPAGE_WINDOWS_950,
+		LIBCREG_CODEPAGE_WINDOWS_1250,
+		LIBCREG_CODEPAGE_WINDOWS_1251,
+		LIBCREG_CODEPAGE_WINDOWS_1252,
+		LIBCREG_CODEPAGE_WINDOWS_1253,
+		LIBCREG_CODEPAGE_WINDOWS_1254,
+		LIBCREG_CODEPAGE_WINDOWS_1255,
+		LIBCREG_CODEPAGE_WINDOWS_1256,
+		LIBCREG_CODEPAGE_WINDOWS_1257,
+		LIBCREG_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBCREG_CODEPAGE_ISO_8859_1,
+		LIBCREG_CODEPAGE_ISO_8859_2,
+		LIBCREG_CODEPAGE_ISO_8859_3,
+		LIBCREG_CODEPAGE_ISO_8859_4,
+		LIBCREG_CODEPAGE_ISO_8859_5,
+		LIBCREG_CODEPAGE_ISO_8859_6,
+		LIBCREG_CODEPAGE_ISO_8859_7,
+		LIBCREG_CODEPAGE_ISO_8859_8,
+		LIBCREG_CODEPAGE_ISO_8859_9,
+		LIBCREG_CODEPAGE_ISO_8859_10,
+		LIBCREG_CODEPAGE_ISO_8859_11,
+		LIBCREG_CODEPAGE_ISO_8859_13,
+		LIBCREG_CODEPAGE_ISO_8859_14,
+		LIBCREG_CODEPAGE_ISO_8859_15,
+		LIBCREG_CODEPAGE_ISO_8859_16,
+		LIBCREG_CODEPAGE_KOI8_R,
+		LIBCREG_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libcreg_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcreg_file_set_ascii_codepage(
+	          NULL,
+	          LIBCREG_CODEPAGE_ASCII,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libcreg_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libcreg_file_set_ascii_codepage(
+	          file,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_type(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_type(
+	          file,
+	          &type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_type(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_build_path_index function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_build_path_index(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_key_t *key       = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_build_path_index(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test building the path index when it already has been built
+	 */
+	result = libcreg_file_build_path_index(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the root key using the path index
+	 */
+	result = libcreg_file_get_key_by_utf8_path(
+	          file,
+	          (uint8_t *) "\\",
+	          1,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_free(
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_build_path_index(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libcreg_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_read_key_hierarchy_table function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_read_key_hierarchy_table(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_key_t *key       = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_read_key_hierarchy_table(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the key hierarchy table when it already has been read
+	 */
+	result = libcreg_file_read_key_hierarchy_table(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the root key using the key hierarchy table
+	 */
+	result = libcreg_file_get_root_key(
+	          file,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_free(
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_read_key_hierarchy_table(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libcreg_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_load_data_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_load_data_blocks(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_key_t *key       = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_load_data_blocks(
+	          file,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test loading the data blocks when they already have been loaded
+	 */
+	result = libcreg_file_load_data_blocks(
+	          file,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the root key using the loaded data blocks
+	 */
+	result = libcreg_file_get_root_key(
+	          file,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_free(
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_load_data_blocks(
+	          NULL,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_load_data_blocks(
+	          file,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libcreg_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_set_index_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_set_index_filename(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_file_set_index_filename(
+	          NULL,
+	          "index",
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_set_index_filename(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_set_index_filename(
+	          file,
+	          "",
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_write_index_file function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_write_index_file(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_file_write_index_file(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where no index filename was set
+	 */
+	result = libcreg_file_write_index_file(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_path_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_path_cache_size(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int path_cache_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_path_cache_size(
+	          file,
+	          &path_cache_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_path_cache_size(
+	          NULL,
+	          &path_cache_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_path_cache_size(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_set_path_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_set_path_cache_size(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int path_cache_size      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_file_get_path_cache_size(
+	          file,
+	          &path_cache_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_set_path_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_set_path_cache_size(
+	          file,
+	          path_cache_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_set_path_cache_size(
+	          NULL,
+	          path_cache_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_set_path_cache_size(
+	          file,
+	          -1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_read_ahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_read_ahead_size(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t read_ahead_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_read_ahead_size(
+	          file,
+	          &read_ahead_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_read_ahead_size(
+	          NULL,
+	          &read_ahead_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_read_ahead_size(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_set_read_ahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_set_read_ahead_size(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t read_ahead_size   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_file_get_read_ahead_size(
+	          file,
+	          &read_ahead_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_set_read_ahead_size(
+	          file,
+	          65536,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_set_read_ahead_size(
+	          file,
+	          read_ahead_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_set_read_ahead_size(
+	          NULL,
+	          read_ahead_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_set_read_ahead_size(
+	          file,
+	          (size_t) 0x40000000UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_scan_data_blocks_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_scan_data_blocks_on_demand(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	uint8_t scan_on_demand   = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_scan_data_blocks_on_demand(
+	          file,
+	          &scan_on_demand,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "scan_on_demand",
+	 scan_on_demand,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_scan_data_blocks_on_demand(
+	          NULL,
+	          &scan_on_demand,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_scan_data_blocks_on_demand(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_set_scan_data_blocks_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_set_scan_data_blocks_on_demand(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_file_t *file     = NULL;
+	libcreg_key_t *root_key  = NULL;
+	int result               = 0;
+	uint8_t scan_on_demand   = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_file_initialize(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_set_scan_data_blocks_on_demand(
+	          file,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_get_scan_data_blocks_on_demand(
+	          file,
+	          &scan_on_demand,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "scan_on_demand",
+	 scan_on_demand,
+	 1 );
+
+	/* Test open and retrieving the root key with the data blocks scanned on demand
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcreg_file_open_wide(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#else
+	result = libcreg_file_open(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#endif
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( root_key != NULL )
+	{
+		result = libcreg_key_free(
+		          &root_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_file_close(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_set_scan_data_blocks_on_demand(
+	          NULL,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_file_free(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libcreg_key_free(
+		 &root_key,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcreg_file_close(
+		 file,
+		 NULL );
+		libcreg_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_root_key function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_root_key(
+     libcreg_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_key_t *root_key  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "root_key",
+	 root_key );
+
+	result = libcreg_key_free(
+	          &root_key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_root_key(
+	          NULL,
+	          &root_key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "root_key",
+	 root_key );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_root_key(
+	          file,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "root_key",
+	 root_key );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libcreg_key_free(
+		 &root_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_key_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_key_by_offset(
+     libcreg_file_t *file )
+{
+	uint8_t utf8_path[ 2 ];
+	libcerror_error_t *error = NULL;
+	libcreg_key_t *key       = NULL;
+	size_t utf8_path_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_key_by_offset(
+	          file,
+	          0x00000020,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	/* The path of the root key consists of the separator
+	 */
+	result = libcreg_key_get_utf8_path_size(
+	          key,
+	          &utf8_path_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_get_utf8_path(
+	          key,
+	          utf8_path,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_path[ 0 ]",
+	 utf8_path[ 0 ],
+	 (uint8_t) '\\' );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_get_utf8_path(
+	          key,
+	          utf8_path,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_free(
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_key_by_offset(
+	          NULL,
+	          0x00000020,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_key_by_offset(
+	          file,
+	          0,
+	          &key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_key_by_offset(
+	          file,
+	          0x00000020,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		libcreg_key_free(
+		 &key,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_file_get_keys_by_utf8_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_get_keys_by_utf8_paths(
+     libcreg_file_t *file )
+{
+	uint8_t utf8_string[ 1 ]         = { 0 };
+	const uint8_t *utf8_strings[ 1 ] = { utf8_string };
+	size_t utf8_string_lengths[ 1 ]  = { 0 };
+	libcerror_error_t *error         = NULL;
+	libcreg_key_t *keys[ 1 ]         = { NULL };
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          file,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "keys[ 0 ]",
+	 keys[ 0 ] );
+
+	result = libcreg_key_free(
+	          &( keys[ 0 ] ),
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          NULL,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          file,
+	          NULL,
+	          utf8_string_lengths,
+	          1,
+	          keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          file,
+	          utf8_strings,
+	          NULL,
+	          1,
+	          keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          file,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          -1,
+	          keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_get_keys_by_utf8_paths(
+	          file,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          NULL,
+	          &error );
 
-		CREG_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CREG_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
+	return( 1 );
+
+on_error:
+	if( keys[ 0 ] != NULL )
+	{
+		libcreg_key_free(
+		 &( keys[ 0 ] ),
+		 NULL );
+	}
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
+	return( 0 );
+}
+
+/* Key callback that counts the walked keys
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_file_walk_key_callback(
+     off64_t key_offset CREG_TEST_ATTRIBUTE_UNUSED,
+     int depth CREG_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *name CREG_TEST_ATTRIBUTE_UNUSED,
+     size_t name_size CREG_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data )
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( key_offset )
+	CREG_TEST_UNREFERENCED_PARAMETER( depth )
+	CREG_TEST_UNREFERENCED_PARAMETER( name )
+	CREG_TEST_UNREFERENCED_PARAMETER( name_size )
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) callback_data ) += 1;
+
+	return( 1 );
+}
+
+/* Tests the libcreg_file_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_file_walk(
+     libcreg_file_t *file )
+{
+	libcreg_walk_callbacks_t callbacks;
+
+	libcerror_error_t *error = NULL;
+	int number_of_keys       = 0;
+	int result               = 0;
+
+	callbacks.key_callback   = &creg_test_file_walk_key_callback;
+	callbacks.value_callback = NULL;
+	callbacks.callback_data  = (void *) &number_of_keys;
+
+	/* Test regular cases
+	 */
+	result = libcreg_file_walk(
+	          file,
+	          &callbacks,
+	          1,
+	          LIBCREG_WALK_FLAG_SKIP_VALUES,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_keys",
+	 number_of_keys,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcreg_file_walk(
+	          NULL,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_walk(
+	          file,
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_walk(
+	          file,
+	          &callbacks,
+	          0,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_file_walk(
+	          file,
+	          &callbacks,
+	          1,
+	          0xff,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1364,64 +3653,139 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcreg_file_set_ascii_codepage function
+/* Tests the libcreg_key_get_sub_key_cursor function
  * Returns 1 if successful or 0 if not
  */
-int creg_test_file_set_ascii_codepage(
+int creg_test_file_get_sub_key_cursor(
      libcreg_file_t *file )
 {
-	int supported_codepages[ 15 ] = {
-		LIBCREG_CODEPAGE_ASCII,
-		LIBCREG_CODEPAGE_WINDOWS_874,
-		LIBCREG_CODEPAGE_WINDOWS_932,
-		LIBCREG_CODEPAGE_WINDOWS_936,
-		LIBCREG_CODEPAGE_WINDOWS_949,
-		LIBCREG_CODEPAGE_WINDOWS_950,
-		LIBCREG_CODEPAGE_WINDOWS_1250,
-		LIBCREG_CODEPAGE_WINDOWS_1251,
-		LIBCREG_CODEPAGE_WINDOWS_1252,
-		LIBCREG_CODEPAGE_WINDOWS_1253,
-		LIBCREG_CODEPAGE_WINDOWS_1254,
-		LIBCREG_CODEPAGE_WINDOWS_1255,
-		LIBCREG_CODEPAGE_WINDOWS_1256,
-		LIBCREG_CODEPAGE_WINDOWS_1257,
-		LIBCREG_CODEPAGE_WINDOWS_1258 };
+	libcerror_error_t *error             = NULL;
+	libcreg_key_cursor_t *sub_key_cursor = NULL;
+	libcreg_key_t *root_key              = NULL;
+	libcreg_key_t *sub_key               = NULL;
+	libcreg_value_cursor_t *value_cursor = NULL;
+	off64_t cursor_offset                = 0;
+	off64_t sub_key_offset               = 0;
+	int cursor_number_of_values          = 0;
+	int number_of_sub_keys               = 0;
+	int number_of_values                 = 0;
+	int result                           = 0;
+	int sub_key_index                    = 0;
+	int value_index                      = 0;
 
-	int unsupported_codepages[ 17 ] = {
-		LIBCREG_CODEPAGE_ISO_8859_1,
-		LIBCREG_CODEPAGE_ISO_8859_2,
-		LIBCREG_CODEPAGE_ISO_8859_3,
-		LIBCREG_CODEPAGE_ISO_8859_4,
-		LIBCREG_CODEPAGE_ISO_8859_5,
-		LIBCREG_CODEPAGE_ISO_8859_6,
-		LIBCREG_CODEPAGE_ISO_8859_7,
-		LIBCREG_CODEPAGE_ISO_8859_8,
-		LIBCREG_CODEPAGE_ISO_8859_9,
-		LIBCREG_CODEPAGE_ISO_8859_10,
-		LIBCREG_CODEPAGE_ISO_8859_11,
-		LIBCREG_CODEPAGE_ISO_8859_13,
-		LIBCREG_CODEPAGE_ISO_8859_14,
-		LIBCREG_CODEPAGE_ISO_8859_15,
-		LIBCREG_CODEPAGE_ISO_8859_16,
-		LIBCREG_CODEPAGE_KOI8_R,
-		LIBCREG_CODEPAGE_KOI8_U };
+	result = libcreg_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
 
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Test set ASCII codepage
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_get_number_of_sub_keys(
+	          root_key,
+	          &number_of_sub_keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
+	result = libcreg_key_get_sub_key_cursor(
+	          root_key,
+	          &sub_key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_key_cursor",
+	 sub_key_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cursor must visit the sub keys in the same order as the sub key index
+	 */
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
 	{
-		codepage = supported_codepages[ index ];
+		result = libcreg_key_cursor_next(
+		          sub_key_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_cursor_get_offset(
+		          sub_key_cursor,
+		          &cursor_offset,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_cursor_get_number_of_values(
+		          sub_key_cursor,
+		          &cursor_number_of_values,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_get_sub_key_by_index(
+		          root_key,
+		          sub_key_index,
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-		result = libcreg_file_set_ascii_codepage(
-		          file,
-		          codepage,
+		result = libcreg_key_get_offset(
+		          sub_key,
+		          &sub_key_offset,
 		          &error );
 
 		CREG_TEST_ASSERT_EQUAL_INT(
@@ -1432,97 +3796,108 @@ int creg_test_file_set_ascii_codepage(
 		CREG_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
-	}
-	/* Test error cases
-	 */
-	result = libcreg_file_set_ascii_codepage(
-	          NULL,
-	          LIBCREG_CODEPAGE_ASCII,
-	          &error );
 
-	CREG_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		CREG_TEST_ASSERT_EQUAL_INT64(
+		 "cursor_offset",
+		 (int64_t) cursor_offset,
+		 (int64_t) sub_key_offset );
 
-	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		result = libcreg_key_get_number_of_values(
+		          sub_key,
+		          &number_of_values,
+		          &error );
 
-	libcerror_error_free(
-	 &error );
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-		result = libcreg_file_set_ascii_codepage(
-		          file,
-		          codepage,
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "cursor_number_of_values",
+		 cursor_number_of_values,
+		 number_of_values );
+
+		result = libcreg_key_cursor_get_value_cursor(
+		          sub_key_cursor,
+		          &value_cursor,
 		          &error );
 
 		CREG_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		CREG_TEST_ASSERT_IS_NOT_NULL(
+		CREG_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libcreg_file_set_ascii_codepage(
-	          file,
-	          LIBCREG_CODEPAGE_WINDOWS_1252,
-	          &error );
+		value_index = 0;
 
-	CREG_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		do
+		{
+			result = libcreg_value_cursor_next(
+			          value_cursor,
+			          &error );
 
-	CREG_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			if( result == 1 )
+			{
+				value_index++;
+			}
+		}
+		while( result == 1 );
 
-	return( 1 );
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-/* Tests the libcreg_file_get_type function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_get_type(
-     libcreg_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t type            = 0;
-	int result               = 0;
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "value_index",
+		 value_index,
+		 number_of_values );
 
-	/* Test regular cases
-	 */
-	result = libcreg_file_get_type(
-	          file,
-	          &type,
+		result = libcreg_value_cursor_free(
+		          &value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_free(
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_key_cursor_next(
+	          sub_key_cursor,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1530,9 +3905,9 @@ int creg_test_file_get_type(
 
 	/* Test error cases
 	 */
-	result = libcreg_file_get_type(
-	          NULL,
-	          &type,
+	result = libcreg_key_cursor_get_offset(
+	          sub_key_cursor,
+	          &cursor_offset,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1547,9 +3922,9 @@ int creg_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libcreg_file_get_type(
-	          file,
-	          NULL,
+	result = libcreg_key_get_sub_key_cursor(
+	          root_key,
+	          &sub_key_cursor,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1564,49 +3939,27 @@ int creg_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcreg_file_get_root_key function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_file_get_root_key(
-     libcreg_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	libcreg_key_t *root_key  = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libcreg_file_get_root_key(
-	          file,
-	          &root_key,
+	result = libcreg_key_get_sub_key_cursor(
+	          NULL,
+	          &sub_key_cursor,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CREG_TEST_ASSERT_IS_NULL(
+	CREG_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "root_key",
-	 root_key );
+	libcerror_error_free(
+	 &error );
 
-	result = libcreg_key_free(
-	          &root_key,
+	/* Clean up
+	 */
+	result = libcreg_key_cursor_free(
+	          &sub_key_cursor,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -1618,50 +3971,19 @@ int creg_test_file_get_root_key(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcreg_file_get_root_key(
-	          NULL,
+	result = libcreg_key_free(
 	          &root_key,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CREG_TEST_ASSERT_IS_NULL(
-	 "root_key",
-	 root_key );
-
-	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libcreg_file_get_root_key(
-	          file,
-	          NULL,
-	          &error );
-
-	CREG_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	 1 );
 
 	CREG_TEST_ASSERT_IS_NULL(
-	 "root_key",
-	 root_key );
-
-	CREG_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1670,6 +3992,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( sub_key != NULL )
+	{
+		libcreg_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( value_cursor != NULL )
+	{
+		libcreg_value_cursor_free(
+		 &value_cursor,
+		 NULL );
+	}
+	if( sub_key_cursor != NULL )
+	{
+		libcreg_key_cursor_free(
+		 &sub_key_cursor,
+		 NULL );
+	}
 	if( root_key != NULL )
 	{
 		libcreg_key_free(
@@ -1815,6 +4155,11 @@ int main(
 		 creg_test_file_open_file_io_handle,
 		 source );
 
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_open_memory",
+		 creg_test_file_open_memory,
+		 source );
+
 		CREG_TEST_RUN(
 		 "libcreg_file_close",
 		 creg_test_file_close );
@@ -1824,6 +4169,11 @@ int main(
 		 creg_test_file_open_close,
 		 source );
 
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_set_scan_data_blocks_on_demand",
+		 creg_test_file_set_scan_data_blocks_on_demand,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = creg_test_file_open_source(
@@ -1877,15 +4227,85 @@ int main(
 		 creg_test_file_get_type,
 		 file );
 
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_build_path_index",
+		 creg_test_file_build_path_index,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_read_key_hierarchy_table",
+		 creg_test_file_read_key_hierarchy_table,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_load_data_blocks",
+		 creg_test_file_load_data_blocks,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_set_index_filename",
+		 creg_test_file_set_index_filename,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_write_index_file",
+		 creg_test_file_write_index_file,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_get_path_cache_size",
+		 creg_test_file_get_path_cache_size,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_set_path_cache_size",
+		 creg_test_file_set_path_cache_size,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_get_read_ahead_size",
+		 creg_test_file_get_read_ahead_size,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_set_read_ahead_size",
+		 creg_test_file_set_read_ahead_size,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_get_scan_data_blocks_on_demand",
+		 creg_test_file_get_scan_data_blocks_on_demand,
+		 file );
+
 		CREG_TEST_RUN_WITH_ARGS(
 		 "libcreg_file_get_root_key",
 		 creg_test_file_get_root_key,
 		 file );
 
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_get_key_by_offset",
+		 creg_test_file_get_key_by_offset,
+		 file );
+
 		/* TODO: add tests for libcreg_file_get_key_by_utf8_path */
 
 		/* TODO: add tests for libcreg_file_get_key_by_utf16_path */
 
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_get_keys_by_utf8_paths",
+		 creg_test_file_get_keys_by_utf8_paths,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_file_walk",
+		 creg_test_file_walk,
+		 file );
+
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_key_get_sub_key_cursor",
+		 creg_test_file_get_sub_key_cursor,
+		 file );
+
 		/* Clean up
 		 */
 		result = creg_test_file_close_source(
@@ -0,0 +1,723 @@
+/*
+ * Library folded name functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_folded_name.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_folded_name_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_folded_name_initialize(
+     void )
+{
+	uint8_t name1[ 12 ]      = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 'i' };
+	uint8_t name2[ 4 ]       = { 'T', 0xe9, 's', 't' };
+	libcerror_error_t *error = NULL;
+	uint8_t *folded_name     = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "folded_name",
+	 folded_name );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "folded_name[ 1 ]",
+	 folded_name[ 1 ],
+	 (uint8_t) 'U' );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "folded_name[ 7 ]",
+	 folded_name[ 7 ],
+	 (uint8_t) 'C' );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_folded_name_free(
+	          &folded_name,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "folded_name",
+	 folded_name );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that contains non-ASCII characters
+	 */
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name2,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "folded_name",
+	 folded_name );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_folded_name_initialize(
+	          NULL,
+	          name1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	folded_name = (uint8_t *) 0x12345678UL;
+
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name1,
+	          12,
+	          &error );
+
+	folded_name = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          NULL,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( folded_name != NULL )
+	{
+		libcreg_folded_name_free(
+		 &folded_name,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_folded_name_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_folded_name_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_folded_name_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_folded_name_compare_with_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_folded_name_compare_with_utf8_string(
+     void )
+{
+	uint8_t name1[ 12 ]      = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 'i' };
+	uint8_t name2[ 4 ]       = { 'T', 0xe9, 's', 't' };
+	uint8_t utf8_string1[ 12 ] = { 'c', 'U', 'R', 'R', 'E', 'N', 'T', 'c', 'o', 'n', 'F', 'I' };
+	uint8_t utf8_string2[ 12 ] = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 'x' };
+	uint8_t utf8_string3[ 13 ] = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 0xc3, 0xad };
+	libcerror_error_t *error = NULL;
+	uint8_t *folded_name     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          utf8_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          utf8_string2,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          utf8_string1,
+	          11,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that contains non-ASCII characters
+	 */
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          utf8_string3,
+	          13,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          NULL,
+	          12,
+	          utf8_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          NULL,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf8_string(
+	          folded_name,
+	          12,
+	          utf8_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_folded_name_free(
+	          &folded_name,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "folded_name",
+	 folded_name );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( folded_name != NULL )
+	{
+		libcreg_folded_name_free(
+		 &folded_name,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_folded_name_compare_with_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_folded_name_compare_with_utf16_string(
+     void )
+{
+	uint8_t name1[ 12 ]      = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 'i' };
+	uint8_t name2[ 4 ]       = { 'T', 0xe9, 's', 't' };
+	uint16_t utf16_string1[ 12 ] = { 'c', 'U', 'R', 'R', 'E', 'N', 'T', 'c', 'o', 'n', 'F', 'I' };
+	uint16_t utf16_string2[ 12 ] = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 'x' };
+	uint16_t utf16_string3[ 12 ] = { 'C', 'u', 'r', 'r', 'e', 'n', 't', 'C', 'o', 'n', 'f', 0x00ed };
+	libcerror_error_t *error = NULL;
+	uint8_t *folded_name     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_folded_name_initialize(
+	          &folded_name,
+	          name1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          utf16_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          utf16_string2,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          utf16_string1,
+	          11,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that contains non-ASCII characters
+	 */
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          utf16_string3,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          NULL,
+	          12,
+	          utf16_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          (size_t) SSIZE_MAX + 1,
+	          utf16_string1,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          NULL,
+	          12,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_folded_name_compare_with_utf16_string(
+	          folded_name,
+	          12,
+	          utf16_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_folded_name_free(
+	          &folded_name,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "folded_name",
+	 folded_name );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( folded_name != NULL )
+	{
+		libcreg_folded_name_free(
+		 &folded_name,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_folded_name_initialize",
+	 creg_test_folded_name_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_folded_name_free",
+	 creg_test_folded_name_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_folded_name_compare_with_utf8_string",
+	 creg_test_folded_name_compare_with_utf8_string );
+
+	CREG_TEST_RUN(
+	 "libcreg_folded_name_compare_with_utf16_string",
+	 creg_test_folded_name_compare_with_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
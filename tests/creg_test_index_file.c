@@ -0,0 +1,411 @@
+/*
+ * Library index file functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_index_file.h"
+#include "../libcreg/libcreg_io_handle.h"
+#include "../libcreg/libcreg_key_navigation.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_index_file_calculate_registry_file_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_index_file_calculate_registry_file_checksum(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_index_file_calculate_registry_file_checksum(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_index_file_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_index_file_read_file_io_handle(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libcreg_io_handle_t *io_handle           = NULL;
+	libcreg_key_navigation_t *key_navigation = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	result = libcreg_key_navigation_initialize(
+	          &key_navigation,
+	          io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_navigation",
+	 key_navigation );
+
+	/* Test error cases
+	 */
+	result = libcreg_index_file_read_file_io_handle(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_index_file_read_file_io_handle(
+	          key_navigation,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_navigation_free(
+	          &key_navigation,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_navigation",
+	 key_navigation );
+
+	result = libcreg_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_navigation != NULL )
+	{
+		libcreg_key_navigation_free(
+		 &key_navigation,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libcreg_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_index_file_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_index_file_write_file_io_handle(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libcreg_io_handle_t *io_handle           = NULL;
+	libcreg_key_navigation_t *key_navigation = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	result = libcreg_key_navigation_initialize(
+	          &key_navigation,
+	          io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_navigation",
+	 key_navigation );
+
+	/* Test error cases
+	 */
+	result = libcreg_index_file_write_file_io_handle(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the key navigation has no data blocks list
+	 */
+	result = libcreg_index_file_write_file_io_handle(
+	          key_navigation,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_navigation_free(
+	          &key_navigation,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_navigation",
+	 key_navigation );
+
+	result = libcreg_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_navigation != NULL )
+	{
+		libcreg_key_navigation_free(
+		 &key_navigation,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libcreg_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_index_file_calculate_registry_file_checksum",
+	 creg_test_index_file_calculate_registry_file_checksum );
+
+	CREG_TEST_RUN(
+	 "libcreg_index_file_read_file_io_handle",
+	 creg_test_index_file_read_file_io_handle );
+
+	CREG_TEST_RUN(
+	 "libcreg_index_file_write_file_io_handle",
+	 creg_test_index_file_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1249 @@
+/*
+ * Library key_cursor type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_getopt.h"
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_key_cursor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_key_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_key_cursor_t *key_cursor = NULL;
+	int result                       = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_cursor_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_cursor = (libcreg_key_cursor_t *) 0x12345678UL;
+
+	result = libcreg_key_cursor_initialize(
+	          &key_cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	key_cursor = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_cursor_initialize(
+	          &key_cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_cursor",
+	 key_cursor );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* Tests the libcreg_key_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_cursor_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_cursor_next function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_next(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_cursor_next(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_cursor_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_cursor_reset(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Compares the current sub key of a key cursor with a sub key
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_compare_with_sub_key(
+     libcreg_key_cursor_t *key_cursor,
+     libcreg_key_t *sub_key )
+{
+	uint16_t expected_utf16_string[ 256 ];
+	uint16_t utf16_string[ 256 ];
+	uint8_t expected_utf8_string[ 256 ];
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error             = NULL;
+	libcreg_key_cursor_t *sub_key_cursor = NULL;
+	libcreg_key_t *cursor_sub_key        = NULL;
+	libcreg_value_cursor_t *value_cursor = NULL;
+	const uint8_t *expected_name         = NULL;
+	const uint8_t *name                  = NULL;
+	size_t expected_name_size            = 0;
+	size_t expected_utf16_string_size    = 0;
+	size_t expected_utf8_string_size     = 0;
+	size_t name_size                     = 0;
+	size_t utf16_string_size             = 0;
+	size_t utf8_string_size              = 0;
+	off64_t expected_offset              = 0;
+	off64_t offset                       = 0;
+	int expected_number_of_sub_keys      = 0;
+	int expected_number_of_values        = 0;
+	int number_of_sub_keys               = 0;
+	int number_of_values                 = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_get_offset(
+	          sub_key,
+	          &expected_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_offset(
+	          key_cursor,
+	          &offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) expected_offset );
+
+	result = libcreg_key_get_name_reference(
+	          sub_key,
+	          &expected_name,
+	          &expected_name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_name_reference(
+	          key_cursor,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 expected_name_size );
+
+	if( name_size > 0 )
+	{
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "name",
+		 name );
+
+		result = memory_compare(
+		          name,
+		          expected_name,
+		          name_size );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcreg_key_get_utf8_name_size(
+	          sub_key,
+	          &expected_utf8_string_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_utf8_name_size(
+	          key_cursor,
+	          &utf8_string_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 expected_utf8_string_size );
+
+	if( ( utf8_string_size > 0 )
+	 && ( utf8_string_size <= 256 ) )
+	{
+		result = libcreg_key_get_utf8_name(
+		          sub_key,
+		          expected_utf8_string,
+		          256,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_cursor_get_utf8_name(
+		          key_cursor,
+		          utf8_string,
+		          256,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          utf8_string_size );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcreg_key_get_utf16_name_size(
+	          sub_key,
+	          &expected_utf16_string_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_utf16_name_size(
+	          key_cursor,
+	          &utf16_string_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 expected_utf16_string_size );
+
+	if( ( utf16_string_size > 0 )
+	 && ( utf16_string_size <= 256 ) )
+	{
+		result = libcreg_key_get_utf16_name(
+		          sub_key,
+		          expected_utf16_string,
+		          256,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_cursor_get_utf16_name(
+		          key_cursor,
+		          utf16_string,
+		          256,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf16_string,
+		          expected_utf16_string,
+		          sizeof( uint16_t ) * utf16_string_size );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcreg_key_get_number_of_values(
+	          sub_key,
+	          &expected_number_of_values,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_number_of_values(
+	          key_cursor,
+	          &number_of_values,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 expected_number_of_values );
+
+	result = libcreg_key_get_number_of_sub_keys(
+	          sub_key,
+	          &expected_number_of_sub_keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_cursor_get_number_of_sub_keys(
+	          key_cursor,
+	          &number_of_sub_keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_keys",
+	 number_of_sub_keys,
+	 expected_number_of_sub_keys );
+
+	/* Test retrieving the current sub key
+	 */
+	result = libcreg_key_cursor_get_sub_key(
+	          key_cursor,
+	          &cursor_sub_key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor_sub_key",
+	 cursor_sub_key );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_get_offset(
+	          cursor_sub_key,
+	          &offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) expected_offset );
+
+	result = libcreg_key_free(
+	          &cursor_sub_key,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test iterating the sub keys of the current sub key
+	 */
+	result = libcreg_key_cursor_get_sub_key_cursor(
+	          key_cursor,
+	          &sub_key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_key_cursor",
+	 sub_key_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_sub_keys = 0;
+
+	do
+	{
+		result = libcreg_key_cursor_next(
+		          sub_key_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			number_of_sub_keys++;
+		}
+	}
+	while( ( result != 0 )
+	    && ( number_of_sub_keys <= expected_number_of_sub_keys ) );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_keys",
+	 number_of_sub_keys,
+	 expected_number_of_sub_keys );
+
+	result = libcreg_key_cursor_free(
+	          &sub_key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test iterating the values of the current sub key
+	 */
+	result = libcreg_key_cursor_get_value_cursor(
+	          key_cursor,
+	          &value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_values = 0;
+
+	do
+	{
+		result = libcreg_value_cursor_next(
+		          value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			number_of_values++;
+		}
+	}
+	while( ( result != 0 )
+	    && ( number_of_values <= expected_number_of_values ) );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 expected_number_of_values );
+
+	result = libcreg_value_cursor_free(
+	          &value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_cursor != NULL )
+	{
+		libcreg_value_cursor_free(
+		 &value_cursor,
+		 NULL );
+	}
+	if( sub_key_cursor != NULL )
+	{
+		libcreg_key_cursor_free(
+		 &sub_key_cursor,
+		 NULL );
+	}
+	if( cursor_sub_key != NULL )
+	{
+		libcreg_key_free(
+		 &cursor_sub_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests iterating the sub keys of a key with a key cursor
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_cursor_sub_keys(
+     libcreg_key_t *key )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_key_cursor_t *key_cursor = NULL;
+	libcreg_key_t *sub_key           = NULL;
+	off64_t expected_offset          = 0;
+	off64_t offset                   = 0;
+	int number_of_sub_keys           = 0;
+	int result                       = 0;
+	int sub_key_index                = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_get_number_of_sub_keys(
+	          key,
+	          &number_of_sub_keys,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_get_sub_key_cursor(
+	          key,
+	          &key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_cursor",
+	 key_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the key cursor is not positioned on a sub key
+	 */
+	result = libcreg_key_cursor_get_offset(
+	          key_cursor,
+	          &offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		result = libcreg_key_cursor_next(
+		          key_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_get_sub_key_by_index(
+		          key,
+		          sub_key_index,
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_key",
+		 sub_key );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = creg_test_key_cursor_compare_with_sub_key(
+		          key_cursor,
+		          sub_key );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcreg_key_free(
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_key_cursor_next(
+	          key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test moving to the first sub key after a reset
+	 */
+	result = libcreg_key_cursor_reset(
+	          key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sub_keys > 0 )
+	{
+		result = libcreg_key_cursor_next(
+		          key_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_get_sub_key_by_index(
+		          key,
+		          0,
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_get_offset(
+		          sub_key,
+		          &expected_offset,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_key_cursor_get_offset(
+		          key_cursor,
+		          &offset,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offset );
+
+		result = libcreg_key_free(
+		          &sub_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libcreg_key_cursor_free(
+	          &key_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_cursor",
+	 key_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_key != NULL )
+	{
+		libcreg_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( key_cursor != NULL )
+	{
+		libcreg_key_cursor_free(
+		 &key_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	libcreg_file_t *file       = NULL;
+	libcreg_key_t *root_key    = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = creg_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_key_cursor_initialize",
+	 creg_test_key_cursor_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	CREG_TEST_RUN(
+	 "libcreg_key_cursor_free",
+	 creg_test_key_cursor_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_cursor_next",
+	 creg_test_key_cursor_next );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_cursor_reset",
+	 creg_test_key_cursor_reset );
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = libcreg_file_initialize(
+		          &file,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcreg_file_open_wide(
+		          file,
+		          source,
+		          LIBCREG_OPEN_READ,
+		          &error );
+#else
+		result = libcreg_file_open(
+		          file,
+		          source,
+		          LIBCREG_OPEN_READ,
+		          &error );
+#endif
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_file_get_root_key(
+		          file,
+		          &root_key,
+		          &error );
+
+		CREG_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( root_key != NULL )
+		{
+			CREG_TEST_RUN_WITH_ARGS(
+			 "libcreg_key_cursor_next and libcreg_key_cursor_get_* on the sub keys of the root key",
+			 creg_test_key_cursor_sub_keys,
+			 root_key );
+
+			result = libcreg_key_free(
+			          &root_key,
+			          &error );
+
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libcreg_file_close(
+		          file,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_file_free(
+		          &file,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libcreg_key_free(
+		 &root_key,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcreg_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,759 @@
+/*
+ * Library key_hierarchy_table type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_key_hierarchy_entry.h"
+#include "../libcreg/libcreg_key_hierarchy_table.h"
+
+uint8_t creg_test_key_hierarchy_table_data1[ 88 ] = {
+	0x52, 0x47, 0x4b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x3c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xa3, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_key_hierarchy_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_hierarchy_table_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_hierarchy_table_initialize(
+	          &key_hierarchy_table,
+		          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_hierarchy_table_initialize(
+	          NULL,
+		          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_hierarchy_table = (libcreg_key_hierarchy_table_t *) 0x12345678UL;
+
+	result = libcreg_key_hierarchy_table_initialize(
+	          &key_hierarchy_table,
+		          &error );
+
+	key_hierarchy_table = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_key_hierarchy_table_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_key_hierarchy_table_initialize(
+		          &key_hierarchy_table,
+				          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( key_hierarchy_table != NULL )
+			{
+				libcreg_key_hierarchy_table_free(
+				 &key_hierarchy_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "key_hierarchy_table",
+			 key_hierarchy_table );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_key_hierarchy_table_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_key_hierarchy_table_initialize(
+		          &key_hierarchy_table,
+				          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( key_hierarchy_table != NULL )
+			{
+				libcreg_key_hierarchy_table_free(
+				 &key_hierarchy_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "key_hierarchy_table",
+			 key_hierarchy_table );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_hierarchy_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_hierarchy_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_hierarchy_table_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_hierarchy_table_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_hierarchy_table_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_hierarchy_table_initialize(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_hierarchy_table_read_data(
+	          key_hierarchy_table,
+	          creg_test_key_hierarchy_table_data1,
+	          88,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_hierarchy_table->number_of_entries",
+	 key_hierarchy_table->number_of_entries,
+	 2 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_table->name_hashes[ 0 ]",
+	 key_hierarchy_table->name_hashes[ 0 ],
+	 (uint32_t) 0x0000032cUL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_table->sub_key_offsets[ 0 ]",
+	 key_hierarchy_table->sub_key_offsets[ 0 ],
+	 (uint32_t) 0x0000003cUL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_table->parent_key_offsets[ 1 ]",
+	 key_hierarchy_table->parent_key_offsets[ 1 ],
+	 (uint32_t) 0x00000020UL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT16(
+	 "key_hierarchy_table->key_name_entry_numbers[ 1 ]",
+	 key_hierarchy_table->key_name_entry_numbers[ 1 ],
+	 (uint16_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_hierarchy_table_read_data(
+	          NULL,
+	          creg_test_key_hierarchy_table_data1,
+	          88,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_hierarchy_table_read_data(
+	          key_hierarchy_table,
+	          creg_test_key_hierarchy_table_data1,
+	          88,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcreg_key_hierarchy_table_initialize(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_hierarchy_table_read_data(
+	          key_hierarchy_table,
+	          NULL,
+	          88,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_hierarchy_table_read_data(
+	          key_hierarchy_table,
+	          creg_test_key_hierarchy_table_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_hierarchy_table_get_entry_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_hierarchy_table_get_entry_by_offset(
+     void )
+{
+	libcreg_key_hierarchy_entry_t key_hierarchy_entry;
+
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_hierarchy_table_initialize(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_read_data(
+	          key_hierarchy_table,
+	          creg_test_key_hierarchy_table_data1,
+	          88,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          key_hierarchy_table,
+	          0x3c,
+	          &key_hierarchy_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "key_hierarchy_entry.data_offset",
+	 key_hierarchy_entry.data_offset,
+	 (size_t) 0x3c );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_entry.name_hash",
+	 key_hierarchy_entry.name_hash,
+	 (uint32_t) 0x000002a3UL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_entry.parent_key_offset",
+	 key_hierarchy_entry.parent_key_offset,
+	 (uint32_t) 0x00000020UL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hierarchy_entry.next_key_offset",
+	 key_hierarchy_entry.next_key_offset,
+	 (uint32_t) 0xffffffffUL );
+
+	CREG_TEST_ASSERT_EQUAL_UINT16(
+	 "key_hierarchy_entry.key_name_entry_number",
+	 key_hierarchy_entry.key_name_entry_number,
+	 (uint16_t) 1 );
+
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          key_hierarchy_table,
+	          0x10,
+	          &key_hierarchy_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          key_hierarchy_table,
+	          0x24,
+	          &key_hierarchy_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          key_hierarchy_table,
+	          0x58,
+	          &key_hierarchy_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          NULL,
+	          0x20,
+	          &key_hierarchy_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_hierarchy_table_get_entry_by_offset(
+	          key_hierarchy_table,
+	          0x20,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_key_hierarchy_table_initialize",
+	 creg_test_key_hierarchy_table_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_hierarchy_table_free",
+	 creg_test_key_hierarchy_table_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_hierarchy_table_read_data",
+	 creg_test_key_hierarchy_table_read_data );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_hierarchy_table_get_entry_by_offset",
+	 creg_test_key_hierarchy_table_get_entry_by_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
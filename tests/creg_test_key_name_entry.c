@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,12 +34,25 @@
 #include "creg_test_memory.h"
 #include "creg_test_unused.h"
 
+#include "../libcreg/libcreg_definitions.h"
 #include "../libcreg/libcreg_key_name_entry.h"
 
 uint8_t creg_test_key_name_entry_data1[ 28 ] = {
 	0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65 };
 
+uint8_t creg_test_key_name_entry_data2[ 58 ] = {
+	0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x65, 0x73, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x02, 0x00, 0x61, 0x62, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x04, 0x00, 0x64, 0x77, 0x2a, 0x00, 0x00, 0x00 };
+
+uint8_t creg_test_key_name_entry_error_data1[ 58 ] = {
+	0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x65, 0x73, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x02, 0x00, 0x61, 0x62, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x04, 0x00, 0x64, 0x77, 0x2a, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
 
 /* Tests the libcreg_key_name_entry_initialize function
@@ -52,9 +66,9 @@ int creg_test_key_name_entry_initialize(
 	int result                               = 0;
 
 #if defined( HAVE_CREG_TEST_MEMORY )
-	int number_of_malloc_fail_tests          = 1;
-	int number_of_memset_fail_tests          = 1;
-	int test_number                          = 0;
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
 #endif
 
 	/* Test regular cases
@@ -380,7 +394,7 @@ int creg_test_key_name_entry_read_data(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	/* Test error case where the values cannot be read
 	 */
 	result = libcreg_key_name_entry_free(
 	          &key_name_entry,
@@ -391,46 +405,12 @@ int creg_test_key_name_entry_read_data(
 	 result,
 	 1 );
 
-	CREG_TEST_ASSERT_IS_NULL(
-	 "key_name_entry",
-	 key_name_entry );
-
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( key_name_entry != NULL )
-	{
-		libcreg_key_name_entry_free(
-		 &key_name_entry,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcreg_key_name_entry_get_number_of_entries function
- * Returns 1 if successful or 0 if not
- */
-int creg_test_key_name_entry_get_number_of_entries(
-     libcreg_key_name_entry_t *key_name_entry )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_entries    = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libcreg_key_name_entry_get_number_of_entries(
-	          key_name_entry,
-	          &number_of_entries,
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -442,11 +422,11 @@ int creg_test_key_name_entry_get_number_of_entries(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcreg_key_name_entry_get_number_of_entries(
-	          NULL,
-	          &number_of_entries,
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_key_name_entry_error_data1,
+	          58,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -461,23 +441,38 @@ int creg_test_key_name_entry_get_number_of_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libcreg_key_name_entry_get_number_of_entries(
-	          key_name_entry,
-	          NULL,
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_name_entry->name",
+	 key_name_entry->name );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_name_entry->folded_name",
+	 key_name_entry->folded_name );
+
+	CREG_TEST_ASSERT_EQUAL_UINT16(
+	 "key_name_entry->name_size",
+	 key_name_entry->name_size,
+	 (uint16_t) 0 );
+
+	/* Clean up
+	 */
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CREG_TEST_ASSERT_IS_NOT_NULL(
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -486,25 +481,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( key_name_entry != NULL )
+	{
+		libcreg_key_name_entry_free(
+		 &key_name_entry,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libcreg_key_name_entry_get_entry_by_index function
+/* Tests the libcreg_key_name_entry_read_data function with the reference data flag
  * Returns 1 if successful or 0 if not
  */
-int creg_test_key_name_entry_get_entry_by_index(
-     libcreg_key_name_entry_t *key_name_entry )
+int creg_test_key_name_entry_read_data_reference_data(
+     void )
 {
-	libcerror_error_t *error           = NULL;
-	libcreg_value_entry_t *value_entry = NULL;
-	int number_of_entries              = 0;
-	int result                         = 0;
+	libcerror_error_t *error                 = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	int result                               = 0;
 
 	/* Initialize test
 	 */
-	result = libcreg_key_name_entry_get_number_of_entries(
-	          key_name_entry,
-	          &number_of_entries,
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
@@ -512,114 +511,63 @@ int creg_test_key_name_entry_get_entry_by_index(
 	 result,
 	 1 );
 
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
 	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	if( number_of_entries > 0 )
-	{
-		result = libcreg_key_name_entry_get_entry_by_index(
-		          key_name_entry,
-		          0,
-		          &value_entry,
-		          &error );
-
-		CREG_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CREG_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		CREG_TEST_ASSERT_IS_NOT_NULL(
-		 "value_entry",
-		 value_entry );
-
-		result = libcreg_value_entry_free(
-		          &value_entry,
-		          &error );
-
-		CREG_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	key_name_entry->flags |= LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA;
 
-		CREG_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libcreg_key_name_entry_get_entry_by_index(
-	          NULL,
-	          0,
-	          &value_entry,
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_key_name_entry_data1,
+	          28,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CREG_TEST_ASSERT_IS_NULL(
-	 "value_entry",
-	 value_entry );
-
-	CREG_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcreg_key_name_entry_get_entry_by_index(
-	          key_name_entry,
-	          -1,
-	          &value_entry,
-	          &error );
-
 	CREG_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CREG_TEST_ASSERT_IS_NULL(
-	 "value_entry",
-	 value_entry );
-
-	CREG_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 "key_name_entry->name_size",
+	 (int) key_name_entry->name_size,
+	 8 );
 
-	libcerror_error_free(
-	 &error );
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_name_entry->name == &( creg_test_key_name_entry_data1[ 20 ] )",
+	 (int) ( key_name_entry->name == &( creg_test_key_name_entry_data1[ 20 ] ) ),
+	 1 );
 
-	result = libcreg_key_name_entry_get_entry_by_index(
-	          key_name_entry,
-	          0,
-	          NULL,
+	/* Clean up
+	 */
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
 	          &error );
 
 	CREG_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CREG_TEST_ASSERT_IS_NULL(
-	 "value_entry",
-	 value_entry );
+	 "key_name_entry",
+	 key_name_entry );
 
-	CREG_TEST_ASSERT_IS_NOT_NULL(
+	CREG_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -628,62 +576,27 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( value_entry != NULL )
+	if( key_name_entry != NULL )
 	{
-		libcreg_value_entry_free(
-		 &value_entry,
+		libcreg_key_name_entry_free(
+		 &key_name_entry,
 		 NULL );
 	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libcreg_key_name_entry_read_values_on_demand function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CREG_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CREG_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
-#endif
+int creg_test_key_name_entry_read_values_on_demand(
+     void )
 {
-#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-
 	libcerror_error_t *error                 = NULL;
 	libcreg_key_name_entry_t *key_name_entry = NULL;
+	libcreg_value_entry_t *value_entry       = NULL;
+	int number_of_entries                    = 0;
 	int result                               = 0;
 
-#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
-#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
-
-	CREG_TEST_UNREFERENCED_PARAMETER( argc )
-	CREG_TEST_UNREFERENCED_PARAMETER( argv )
-
-#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
-
-	CREG_TEST_RUN(
-	 "libcreg_key_name_entry_initialize",
-	 creg_test_key_name_entry_initialize );
-
-	CREG_TEST_RUN(
-	 "libcreg_key_name_entry_free",
-	 creg_test_key_name_entry_free );
-
-	/* TODO: add tests for libcreg_key_name_entry_read_entry_size */
-
-	CREG_TEST_RUN(
-	 "libcreg_key_name_entry_read_data",
-	 creg_test_key_name_entry_read_data );
-
-	/* TODO: add tests for libcreg_key_name_entry_read_values */
-
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-
 	/* Initialize test
 	 */
 	result = libcreg_key_name_entry_initialize(
@@ -703,10 +616,12 @@ int main(
 	 "error",
 	 error );
 
+	key_name_entry->flags |= LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA;
+
 	result = libcreg_key_name_entry_read_data(
 	          key_name_entry,
-	          creg_test_key_name_entry_data1,
-	          28,
+	          creg_test_key_name_entry_data2,
+	          58,
 	          LIBCREG_CODEPAGE_WINDOWS_1252,
 	          &error );
 
@@ -719,17 +634,1070 @@ int main(
 	 "error",
 	 error );
 
-	CREG_TEST_RUN_WITH_ARGS(
-	 "libcreg_key_name_entry_get_number_of_entries",
-	 creg_test_key_name_entry_get_number_of_entries,
-	 key_name_entry );
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "key_name_entry->values_read",
+	 key_name_entry->values_read,
+	 (uint8_t) 0 );
 
-	CREG_TEST_RUN_WITH_ARGS(
-	 "creg_test_key_name_entry_get_entry_by_index",
-	 creg_test_key_name_entry_get_entry_by_index,
-	 key_name_entry );
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_name_entry->value_entries_offset",
+	 key_name_entry->value_entries_offset,
+	 (uint32_t) 24 );
 
-	/* TODO: add tests for libcreg_key_name_entry_get_entry_by_index */
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          key_name_entry,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "key_name_entry->values_read",
+	 key_name_entry->values_read,
+	 (uint8_t) 0 );
+
+	result = libcreg_key_name_entry_get_entry_by_index(
+	          key_name_entry,
+	          1,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "key_name_entry->values_read",
+	 key_name_entry->values_read,
+	 (uint8_t) 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "value_entry->offset",
+	 value_entry->offset,
+	 (uint32_t) 40 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "value_entry->name == &( creg_test_key_name_entry_data2[ 52 ] )",
+	 (int) ( value_entry->name == &( creg_test_key_name_entry_data2[ 52 ] ) ),
+	 1 );
+
+	/* Reading the values again is a no-op
+	 */
+	result = libcreg_key_name_entry_read_values_on_demand(
+	          key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          key_name_entry,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_read_values_on_demand(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test corrupt values are reported on first access
+	 */
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_name_entry->flags |= LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA;
+
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_key_name_entry_error_data1,
+	          58,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_get_entry_by_index(
+	          key_name_entry,
+	          0,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "key_name_entry->values_read",
+	 key_name_entry->values_read,
+	 (uint8_t) 0 );
+
+	/* Clean up
+	 */
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_name_entry != NULL )
+	{
+		libcreg_key_name_entry_free(
+		 &key_name_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_get_entry_by_utf8_name function with different codepages
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_get_entry_by_utf8_name_codepage(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libcreg_key_name_entry_t *key_name_entry         = NULL;
+	libcreg_name_hash_table_t *value_name_hash_table = NULL;
+	libcreg_value_entry_t *value_entry               = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key_name_entry->flags |= LIBCREG_KEY_NAME_ENTRY_FLAG_REFERENCE_DATA;
+
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_key_name_entry_data2,
+	          58,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          (uint8_t *) "DW",
+	          2,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "value_entry->name == &( creg_test_key_name_entry_data2[ 52 ] )",
+	 (int) ( value_entry->name == &( creg_test_key_name_entry_data2[ 52 ] ) ),
+	 1 );
+
+	value_name_hash_table = key_name_entry->value_name_hash_table;
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_name_hash_table",
+	 value_name_hash_table );
+
+	/* The value name hash table is not rebuilt for a different codepage
+	 */
+	value_entry = NULL;
+
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          (uint8_t *) "ab",
+	          2,
+	          LIBCREG_CODEPAGE_ISO_8859_1,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "value_entry->name == &( creg_test_key_name_entry_data2[ 36 ] )",
+	 (int) ( value_entry->name == &( creg_test_key_name_entry_data2[ 36 ] ) ),
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_name_entry->value_name_hash_table == value_name_hash_table",
+	 (int) ( key_name_entry->value_name_hash_table == value_name_hash_table ),
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_name_entry->value_name_hash_table_ascii_codepage",
+	 key_name_entry->value_name_hash_table_ascii_codepage,
+	 LIBCREG_CODEPAGE_WINDOWS_1252 );
+
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          (uint8_t *) "missing",
+	          7,
+	          LIBCREG_CODEPAGE_ISO_8859_1,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_name_entry != NULL )
+	{
+		libcreg_key_name_entry_free(
+		 &key_name_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_get_name_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_get_name_reference(
+     libcreg_key_name_entry_t *key_name_entry )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *name      = NULL;
+	size_t name_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_get_name_reference(
+	          key_name_entry,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          name,
+	          "Software",
+	          8 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_get_name_reference(
+	          NULL,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_name_reference(
+	          key_name_entry,
+	          NULL,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_name_reference(
+	          key_name_entry,
+	          &name,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_get_number_of_entries(
+     libcreg_key_name_entry_t *key_name_entry )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          key_name_entry,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          key_name_entry,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_get_entry_by_index(
+     libcreg_key_name_entry_t *key_name_entry )
+{
+	libcerror_error_t *error           = NULL;
+	libcreg_value_entry_t *value_entry = NULL;
+	int number_of_entries              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_name_entry_get_number_of_entries(
+	          key_name_entry,
+	          &number_of_entries,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_entries > 0 )
+	{
+		result = libcreg_key_name_entry_get_entry_by_index(
+		          key_name_entry,
+		          0,
+		          &value_entry,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "value_entry",
+		 value_entry );
+
+		result = libcreg_value_entry_free(
+		          &value_entry,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_get_entry_by_index(
+	          NULL,
+	          0,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_entry_by_index(
+	          key_name_entry,
+	          -1,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_entry_by_index(
+	          key_name_entry,
+	          0,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_entry != NULL )
+	{
+		libcreg_value_entry_free(
+		 &value_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_build_value_name_hash_table function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_build_value_name_hash_table(
+     libcreg_key_name_entry_t *key_name_entry )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_build_value_name_hash_table(
+	          key_name_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry->value_name_hash_table",
+	 key_name_entry->value_name_hash_table );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_build_value_name_hash_table(
+	          NULL,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_name_entry_get_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_name_entry_get_entry_by_utf8_name(
+     libcreg_key_name_entry_t *key_name_entry )
+{
+	uint8_t utf8_string[ 8 ]           = { 'V', 'e', 'r', 's', 'i', 'o', 'n', 0 };
+	libcerror_error_t *error           = NULL;
+	libcreg_value_entry_t *value_entry = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          utf8_string,
+	          7,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          NULL,
+	          utf8_string,
+	          7,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          NULL,
+	          7,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_name_entry_get_entry_by_utf8_name(
+	          key_name_entry,
+	          utf8_string,
+	          7,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	libcerror_error_t *error                 = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	int result                               = 0;
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_initialize",
+	 creg_test_key_name_entry_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_free",
+	 creg_test_key_name_entry_free );
+
+	/* TODO: add tests for libcreg_key_name_entry_read_entry_size */
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_read_data",
+	 creg_test_key_name_entry_read_data );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_read_data",
+	 creg_test_key_name_entry_read_data_reference_data );
+
+	/* TODO: add tests for libcreg_key_name_entry_read_values */
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_read_values_on_demand",
+	 creg_test_key_name_entry_read_values_on_demand );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_name_entry_get_entry_by_utf8_name",
+	 creg_test_key_name_entry_get_entry_by_utf8_name_codepage );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_key_name_entry_data1,
+	          28,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_key_name_entry_get_name_reference",
+	 creg_test_key_name_entry_get_name_reference,
+	 key_name_entry );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_key_name_entry_get_number_of_entries",
+	 creg_test_key_name_entry_get_number_of_entries,
+	 key_name_entry );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "creg_test_key_name_entry_get_entry_by_index",
+	 creg_test_key_name_entry_get_entry_by_index,
+	 key_name_entry );
+
+	/* TODO: add tests for libcreg_key_name_entry_get_entry_by_index */
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_key_name_entry_build_value_name_hash_table",
+	 creg_test_key_name_entry_build_value_name_hash_table,
+	 key_name_entry );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_key_name_entry_get_entry_by_utf8_name",
+	 creg_test_key_name_entry_get_entry_by_utf8_name,
+	 key_name_entry );
 
 	/* TODO: add tests for libcreg_key_name_entry_compare_name_with_utf8_string */
 
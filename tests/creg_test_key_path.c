@@ -0,0 +1,551 @@
+/*
+ * Library key path functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_key_path.h"
+#include "../libcreg/libcreg_libcdata.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_key_path_set_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_path_set_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 10 ] = { '\\', 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+	libcerror_error_t *error  = NULL;
+	libcreg_key_path_t key_path;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_path_set_utf8_string(
+	          &key_path,
+	          utf8_string,
+	          9,
+	          3,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "key_path.utf8_string_length",
+	 key_path.utf8_string_length,
+	 (size_t) 8 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "key_path.path_index",
+	 key_path.path_index,
+	 3 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_path_set_utf8_string(
+	          NULL,
+	          utf8_string,
+	          9,
+	          3,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &key_path,
+	          NULL,
+	          9,
+	          3,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &key_path,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          3,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &key_path,
+	          utf8_string,
+	          9,
+	          -1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_path_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_path_compare(
+     void )
+{
+	uint8_t utf8_string1[ 9 ]        = { 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+	uint8_t utf8_string2[ 14 ]       = { 'S', 'O', 'F', 'T', 'W', 'A', 'R', 'E', '\\', 'T', 'e', 's', 't', 0 };
+	uint8_t utf8_string3[ 7 ]        = { 'S', 'y', 's', 't', 'e', 'm', 0 };
+	libcerror_error_t *error         = NULL;
+	libcreg_key_path_t first_key_path;
+	libcreg_key_path_t second_key_path;
+	libcreg_key_path_t third_key_path;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_path_set_utf8_string(
+	          &first_key_path,
+	          utf8_string1,
+	          8,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &second_key_path,
+	          utf8_string2,
+	          13,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &third_key_path,
+	          utf8_string3,
+	          6,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_path_compare(
+	          &first_key_path,
+	          &second_key_path,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_compare(
+	          &second_key_path,
+	          &first_key_path,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_compare(
+	          &second_key_path,
+	          &third_key_path,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_compare(
+	          &first_key_path,
+	          &first_key_path,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_path_compare(
+	          NULL,
+	          &second_key_path,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_compare(
+	          &first_key_path,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_path_get_common_length function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_path_get_common_length(
+     void )
+{
+	uint8_t utf8_string1[ 9 ]        = { 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0 };
+	uint8_t utf8_string2[ 14 ]       = { 'S', 'O', 'F', 'T', 'W', 'A', 'R', 'E', '\\', 'T', 'e', 's', 't', 0 };
+	uint8_t utf8_string3[ 7 ]        = { 'S', 'y', 's', 't', 'e', 'm', 0 };
+	libcerror_error_t *error         = NULL;
+	libcreg_key_path_t first_key_path;
+	libcreg_key_path_t second_key_path;
+	libcreg_key_path_t third_key_path;
+	size_t common_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_key_path_set_utf8_string(
+	          &first_key_path,
+	          utf8_string1,
+	          8,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &second_key_path,
+	          utf8_string2,
+	          13,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_set_utf8_string(
+	          &third_key_path,
+	          utf8_string3,
+	          6,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_path_get_common_length(
+	          &first_key_path,
+	          &second_key_path,
+	          &common_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "common_length",
+	 common_length,
+	 (size_t) 8 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_path_get_common_length(
+	          &second_key_path,
+	          &third_key_path,
+	          &common_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "common_length",
+	 common_length,
+	 (size_t) 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_path_get_common_length(
+	          NULL,
+	          &second_key_path,
+	          &common_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_get_common_length(
+	          &first_key_path,
+	          NULL,
+	          &common_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_path_get_common_length(
+	          &first_key_path,
+	          &second_key_path,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_key_path_set_utf8_string",
+	 creg_test_key_path_set_utf8_string );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_path_compare",
+	 creg_test_key_path_compare );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_path_get_common_length",
+	 creg_test_key_path_get_common_length );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1516 @@
+/*
+ * Library key_walker type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_definitions.h"
+#include "../libcreg/libcreg_key_hierarchy_table.h"
+#include "../libcreg/libcreg_key_walker.h"
+
+/* The test key hierarchy consists of a root key with 8 sub keys that each have 8 sub keys
+ */
+#define CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS		8
+#define CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS		( 1 + 8 + ( 8 * 8 ) )
+#define CREG_TEST_KEY_WALKER_ENTRY_SIZE			28
+#define CREG_TEST_KEY_WALKER_DATA_SIZE			( 0x20 + ( CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+typedef struct creg_test_key_walker_visits creg_test_key_walker_visits_t;
+
+struct creg_test_key_walker_visits
+{
+	/* The number of times each key was visited
+	 * Every key is visited by a single worker, hence no locking is needed
+	 */
+	int number_of_visits[ CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS ];
+
+	/* The depth at which each key was visited
+	 */
+	int depths[ CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS ];
+
+	/* The result the key callback should return
+	 */
+	int key_callback_result;
+};
+
+uint8_t creg_test_key_walker_data1[ CREG_TEST_KEY_WALKER_DATA_SIZE ];
+
+/* Sets the values of a key hierarchy entry in the test data
+ */
+void creg_test_key_walker_set_entry(
+      int entry_index,
+      uint32_t parent_key_offset,
+      uint32_t sub_key_offset,
+      uint32_t next_key_offset )
+{
+	uint8_t *entry_data = &( creg_test_key_walker_data1[ 0x20 + ( entry_index * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 12 ] ),
+	 parent_key_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 16 ] ),
+	 sub_key_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 20 ] ),
+	 next_key_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( entry_data[ 24 ] ),
+	 (uint16_t) entry_index );
+
+	/* The keys have no key name entry in a data block
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( entry_data[ 26 ] ),
+	 0xffff );
+}
+
+/* Creates a key hierarchy table of the test key hierarchy
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_key_walker_create_key_hierarchy_table(
+     libcreg_key_hierarchy_table_t **key_hierarchy_table,
+     uint8_t with_loop,
+     libcerror_error_t **error )
+{
+	uint32_t next_key_offset = 0;
+	uint32_t sub_key_offset  = 0;
+	int entry_index          = 0;
+	int sub_entry_index      = 0;
+	int sub_key_index        = 0;
+	int sub_sub_key_index    = 0;
+
+	if( memory_set(
+	     creg_test_key_walker_data1,
+	     0,
+	     CREG_TEST_KEY_WALKER_DATA_SIZE ) == NULL )
+	{
+		return( -1 );
+	}
+	creg_test_key_walker_set_entry(
+	 0,
+	 0xffffffffUL,
+	 0x20 + CREG_TEST_KEY_WALKER_ENTRY_SIZE,
+	 0xffffffffUL );
+
+	for( sub_key_index = 0;
+	     sub_key_index < CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS;
+	     sub_key_index++ )
+	{
+		entry_index     = 1 + sub_key_index;
+		sub_entry_index = 1 + CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS + ( sub_key_index * CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS );
+
+		sub_key_offset = (uint32_t) ( 0x20 + ( sub_entry_index * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) );
+
+		if( sub_key_index < ( CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS - 1 ) )
+		{
+			next_key_offset = (uint32_t) ( 0x20 + ( ( entry_index + 1 ) * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) );
+		}
+		else
+		{
+			next_key_offset = 0xffffffffUL;
+		}
+		creg_test_key_walker_set_entry(
+		 entry_index,
+		 0x20,
+		 sub_key_offset,
+		 next_key_offset );
+
+		for( sub_sub_key_index = 0;
+		     sub_sub_key_index < CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS;
+		     sub_sub_key_index++ )
+		{
+			if( sub_sub_key_index < ( CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS - 1 ) )
+			{
+				next_key_offset = (uint32_t) ( 0x20 + ( ( sub_entry_index + sub_sub_key_index + 1 ) * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) );
+			}
+			else if( with_loop != 0 )
+			{
+				/* The last sub key refers back to the first sub key
+				 */
+				next_key_offset = sub_key_offset;
+			}
+			else
+			{
+				next_key_offset = 0xffffffffUL;
+			}
+			creg_test_key_walker_set_entry(
+			 sub_entry_index + sub_sub_key_index,
+			 (uint32_t) ( 0x20 + ( entry_index * CREG_TEST_KEY_WALKER_ENTRY_SIZE ) ),
+			 0xffffffffUL,
+			 next_key_offset );
+		}
+	}
+	if( libcreg_key_hierarchy_table_initialize(
+	     key_hierarchy_table,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcreg_key_hierarchy_table_read_data(
+	     *key_hierarchy_table,
+	     creg_test_key_walker_data1,
+	     CREG_TEST_KEY_WALKER_DATA_SIZE,
+	     0x20,
+	     error ) != 1 )
+	{
+		libcreg_key_hierarchy_table_free(
+		 key_hierarchy_table,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Key callback that records the visited keys
+ * Returns the key callback result of the visits
+ */
+int creg_test_key_walker_key_callback(
+     off64_t key_offset,
+     int depth,
+     const uint8_t *name CREG_TEST_ATTRIBUTE_UNUSED,
+     size_t name_size CREG_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data )
+{
+	creg_test_key_walker_visits_t *visits = NULL;
+	int entry_index                       = 0;
+
+	CREG_TEST_UNREFERENCED_PARAMETER( name )
+	CREG_TEST_UNREFERENCED_PARAMETER( name_size )
+
+	visits = (creg_test_key_walker_visits_t *) callback_data;
+
+	if( ( visits == NULL )
+	 || ( key_offset < 0x20 ) )
+	{
+		return( -1 );
+	}
+	entry_index = (int) ( ( key_offset - 0x20 ) / CREG_TEST_KEY_WALKER_ENTRY_SIZE );
+
+	if( entry_index >= CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS )
+	{
+		return( -1 );
+	}
+	visits->number_of_visits[ entry_index ] += 1;
+	visits->depths[ entry_index ]            = depth;
+
+	return( visits->key_callback_result );
+}
+
+/* Walks the test key hierarchy and checks the visited keys
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_walker_walk_with_workers(
+     libcreg_key_hierarchy_table_t *key_hierarchy_table,
+     int number_of_workers )
+{
+	creg_test_key_walker_visits_t visits;
+	libcreg_walk_callbacks_t callbacks;
+
+	libcerror_error_t *error         = NULL;
+	libcreg_key_walker_t *key_walker = NULL;
+	int entry_index                  = 0;
+	int expected_depth               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &visits,
+	 0,
+	 sizeof( creg_test_key_walker_visits_t ) );
+
+	visits.key_callback_result = 1;
+
+	callbacks.key_callback   = &creg_test_key_walker_key_callback;
+	callbacks.value_callback = NULL;
+	callbacks.callback_data  = (void *) &visits;
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          number_of_workers,
+	          LIBCREG_WALK_FLAG_SKIP_VALUES,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_walker_walk(
+	          key_walker,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS;
+	     entry_index++ )
+	{
+		if( entry_index == 0 )
+		{
+			expected_depth = 0;
+		}
+		else if( entry_index <= CREG_TEST_KEY_WALKER_NUMBER_OF_SUB_KEYS )
+		{
+			expected_depth = 1;
+		}
+		else
+		{
+			expected_depth = 2;
+		}
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "visits.number_of_visits[ entry_index ]",
+		 visits.number_of_visits[ entry_index ],
+		 1 );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "visits.depths[ entry_index ]",
+		 visits.depths[ entry_index ],
+		 expected_depth );
+	}
+	/* Clean up
+	 */
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_walker != NULL )
+	{
+		libcreg_key_walker_free(
+		 &key_walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_walker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_walker_initialize(
+     void )
+{
+	libcreg_walk_callbacks_t callbacks;
+
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	libcreg_key_walker_t *key_walker                   = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	callbacks.key_callback   = NULL;
+	callbacks.value_callback = NULL;
+	callbacks.callback_data  = NULL;
+
+	result = creg_test_key_walker_create_key_hierarchy_table(
+	          &key_hierarchy_table,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_walker_initialize(
+	          NULL,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_walker = (libcreg_key_walker_t *) 0x12345678UL;
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	key_walker = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          -1,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          1,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          0,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          LIBCREG_MAXIMUM_NUMBER_OF_WALK_THREADS + 1,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_key_walker_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_key_walker_initialize(
+		          &key_walker,
+		          NULL,
+		          key_hierarchy_table,
+		          NULL,
+		          0,
+		          LIBCREG_CODEPAGE_WINDOWS_1252,
+		          &callbacks,
+		          1,
+		          0,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( key_walker != NULL )
+			{
+				libcreg_key_walker_free(
+				 &key_walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "key_walker",
+			 key_walker );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_key_walker_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_key_walker_initialize(
+		          &key_walker,
+		          NULL,
+		          key_hierarchy_table,
+		          NULL,
+		          0,
+		          LIBCREG_CODEPAGE_WINDOWS_1252,
+		          &callbacks,
+		          1,
+		          0,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( key_walker != NULL )
+			{
+				libcreg_key_walker_free(
+				 &key_walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "key_walker",
+			 key_walker );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_walker != NULL )
+	{
+		libcreg_key_walker_free(
+		 &key_walker,
+		 NULL );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_walker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_walker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_key_walker_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_walker_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_walker_walk(
+     void )
+{
+	creg_test_key_walker_visits_t visits;
+	libcreg_walk_callbacks_t callbacks;
+
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	libcreg_key_walker_t *key_walker                   = NULL;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = creg_test_key_walker_create_key_hierarchy_table(
+	          &key_hierarchy_table,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = creg_test_key_walker_walk_with_workers(
+	          key_hierarchy_table,
+	          1 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = creg_test_key_walker_walk_with_workers(
+	          key_hierarchy_table,
+	          4 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test walk with the key callback skipping the sub keys
+	 */
+	memory_set(
+	 &visits,
+	 0,
+	 sizeof( creg_test_key_walker_visits_t ) );
+
+	visits.key_callback_result = 0;
+
+	callbacks.key_callback   = &creg_test_key_walker_key_callback;
+	callbacks.value_callback = NULL;
+	callbacks.callback_data  = (void *) &visits;
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          2,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_walk(
+	          key_walker,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "visits.number_of_visits[ 0 ]",
+	 visits.number_of_visits[ 0 ],
+	 1 );
+
+	for( entry_index = 1;
+	     entry_index < CREG_TEST_KEY_WALKER_NUMBER_OF_KEYS;
+	     entry_index++ )
+	{
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "visits.number_of_visits[ entry_index ]",
+		 visits.number_of_visits[ entry_index ],
+		 0 );
+	}
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_walker_walk(
+	          NULL,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test walk with the key callback failing
+	 */
+	memory_set(
+	 &visits,
+	 0,
+	 sizeof( creg_test_key_walker_visits_t ) );
+
+	visits.key_callback_result = -1;
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          2,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_walk(
+	          key_walker,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test walk with a loop in the key hierarchy
+	 */
+	result = creg_test_key_walker_create_key_hierarchy_table(
+	          &key_hierarchy_table,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_hierarchy_table",
+	 key_hierarchy_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	visits.key_callback_result = 1;
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          4,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_walk(
+	          key_walker,
+	          0x20,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_walker != NULL )
+	{
+		libcreg_key_walker_free(
+		 &key_walker,
+		 NULL );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_key_walker_worker_pop_item and libcreg_key_walker_worker_steal_item functions
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_key_walker_worker_pop_item(
+     void )
+{
+	libcreg_key_walker_item_t item;
+	libcreg_walk_callbacks_t callbacks;
+
+	libcerror_error_t *error                           = NULL;
+	libcreg_key_hierarchy_table_t *key_hierarchy_table = NULL;
+	libcreg_key_walker_t *key_walker                   = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	callbacks.key_callback   = NULL;
+	callbacks.value_callback = NULL;
+	callbacks.callback_data  = NULL;
+
+	result = creg_test_key_walker_create_key_hierarchy_table(
+	          &key_hierarchy_table,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_initialize(
+	          &key_walker,
+	          NULL,
+	          key_hierarchy_table,
+	          NULL,
+	          0,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &callbacks,
+	          2,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_walker",
+	 key_walker );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_worker_append_item(
+	          key_walker->workers[ 0 ],
+	          0x20,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_worker_append_item(
+	          key_walker->workers[ 0 ],
+	          0x3c,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	result = libcreg_key_walker_worker_steal_item(
+	          key_walker->workers[ 1 ],
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "item.key_offset",
+	 item.key_offset,
+	 (uint32_t) 0x20 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "item.depth",
+	 item.depth,
+	 0 );
+
+#endif /* defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+
+	result = libcreg_key_walker_worker_pop_item(
+	          key_walker->workers[ 0 ],
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "item.key_offset",
+	 item.key_offset,
+	 (uint32_t) 0x3c );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "item.depth",
+	 item.depth,
+	 1 );
+
+#if !defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT )
+	result = libcreg_key_walker_worker_pop_item(
+	          key_walker->workers[ 0 ],
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( HAVE_LIBCREG_MULTI_THREAD_SUPPORT ) */
+
+	result = libcreg_key_walker_worker_pop_item(
+	          key_walker->workers[ 0 ],
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_walker_worker_steal_item(
+	          key_walker->workers[ 0 ],
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_key_walker_worker_pop_item(
+	          NULL,
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_worker_pop_item(
+	          key_walker->workers[ 0 ],
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_key_walker_worker_steal_item(
+	          NULL,
+	          &item,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_key_walker_free(
+	          &key_walker,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_hierarchy_table_free(
+	          &key_hierarchy_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_walker != NULL )
+	{
+		libcreg_key_walker_free(
+		 &key_walker,
+		 NULL );
+	}
+	if( key_hierarchy_table != NULL )
+	{
+		libcreg_key_hierarchy_table_free(
+		 &key_hierarchy_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_key_walker_initialize",
+	 creg_test_key_walker_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_walker_free",
+	 creg_test_key_walker_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_walker_walk",
+	 creg_test_key_walker_walk );
+
+	CREG_TEST_RUN(
+	 "libcreg_key_walker_worker_pop_item",
+	 creg_test_key_walker_worker_pop_item );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,922 @@
+/*
+ * Library multi-threaded key access test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "creg_test_getopt.h"
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_libcthreads.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+
+/* Define to make creg_test_multi_thread generate verbose output
+#define CREG_TEST_MULTI_THREAD_VERBOSE
+ */
+
+#define CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS	8
+#define CREG_TEST_MULTI_THREAD_NUMBER_OF_ITERATIONS		2048
+#define CREG_TEST_MULTI_THREAD_NUMBER_OF_SEPARATE_KEYS_ITERATIONS	16
+#define CREG_TEST_MULTI_THREAD_MAXIMUM_DEPTH			2
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct creg_test_multi_thread_worker creg_test_multi_thread_worker_t;
+
+struct creg_test_multi_thread_worker
+{
+	/* The file
+	 */
+	libcreg_file_t *file;
+
+	/* The (shared) key
+	 */
+	libcreg_key_t *key;
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Retrieves the current time in nanoseconds
+ * Returns the current time or 0 if not available
+ */
+int64_t creg_test_multi_thread_get_current_time(
+         void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_structure;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (int64_t) time_structure.tv_sec * 1000000000 ) + time_structure.tv_nsec );
+#else
+	return( (int64_t) time( NULL ) * 1000000000 );
+#endif
+}
+
+/* Reads the key name and values of the shared key
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_multi_thread_read_key(
+     libcreg_key_t *key,
+     libcerror_error_t **error )
+{
+	libcreg_value_t *value   = NULL;
+	static char *function    = "creg_test_multi_thread_read_key";
+	size_t utf8_string_size  = 0;
+	int number_of_sub_keys   = 0;
+	int number_of_values     = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	if( libcreg_key_get_utf8_name_size(
+	     key,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_key_get_number_of_values(
+	     key,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libcreg_key_get_value_by_index(
+		     key,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libcreg_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	result = libcreg_key_get_value_by_utf8_name(
+	          key,
+	          (uint8_t *) "CregTestMultiThread",
+	          19,
+	          &value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value by UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libcreg_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcreg_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Looks up the values of the key and its sub keys by their own name
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_multi_thread_read_values_by_name(
+     libcreg_key_t *key,
+     int depth,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcreg_key_t *sub_key  = NULL;
+	libcreg_value_t *value  = NULL;
+	static char *function   = "creg_test_multi_thread_read_values_by_name";
+	size_t utf8_string_size = 0;
+	int number_of_sub_keys  = 0;
+	int number_of_values    = 0;
+	int result              = 0;
+	int sub_key_index       = 0;
+	int value_index         = 0;
+
+	if( libcreg_key_get_number_of_values(
+	     key,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libcreg_key_get_value_by_index(
+		     key,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libcreg_value_get_utf8_name_size(
+		     value,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d UTF-8 name size.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		/* Skip the default value and names that do not fit the buffer
+		 */
+		if( ( utf8_string_size <= 1 )
+		 || ( utf8_string_size > 256 ) )
+		{
+			utf8_string_size = 0;
+		}
+		else if( libcreg_value_get_utf8_name(
+		          value,
+		          utf8_string,
+		          utf8_string_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d UTF-8 name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libcreg_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			continue;
+		}
+		result = libcreg_key_get_value_by_utf8_name(
+		          key,
+		          utf8_string,
+		          utf8_string_size - 1,
+		          &value,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d by UTF-8 name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libcreg_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	if( depth >= CREG_TEST_MULTI_THREAD_MAXIMUM_DEPTH )
+	{
+		return( 1 );
+	}
+	if( libcreg_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( libcreg_key_get_sub_key_by_index(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( creg_test_multi_thread_read_values_by_name(
+		     sub_key,
+		     depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to read values of sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( libcreg_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_key != NULL )
+	{
+		libcreg_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a separate root key from the file and looks up its values by name
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_multi_thread_read_root_key(
+     libcreg_file_t *file,
+     libcerror_error_t **error )
+{
+	libcreg_key_t *root_key = NULL;
+	static char *function   = "creg_test_multi_thread_read_root_key";
+	int result              = 0;
+
+	result = libcreg_file_get_root_key(
+	          file,
+	          &root_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root key.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( creg_test_multi_thread_read_values_by_name(
+	     root_key,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to read values of root key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcreg_key_free(
+	     &root_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root key.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( root_key != NULL )
+	{
+		libcreg_key_free(
+		 &root_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Callback function to read the shared key or separate keys from a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int creg_test_multi_thread_worker_callback(
+     creg_test_multi_thread_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+	int iteration            = 0;
+	int result               = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = 1;
+
+	for( iteration = 0;
+	     iteration < worker->number_of_iterations;
+	     iteration++ )
+	{
+		if( worker->file != NULL )
+		{
+			result = creg_test_multi_thread_read_root_key(
+			          worker->file,
+			          &error );
+		}
+		else
+		{
+			result = creg_test_multi_thread_read_key(
+			          worker->key,
+			          &error );
+		}
+		if( result != 1 )
+		{
+#if defined( CREG_TEST_MULTI_THREAD_VERBOSE )
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+#endif
+			libcerror_error_free(
+			 &error );
+
+			worker->result = -1;
+
+			break;
+		}
+	}
+	return( worker->result );
+}
+
+/* Runs the workers on multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_multi_thread_run_workers(
+     libcreg_file_t *file,
+     libcreg_key_t *key,
+     int number_of_threads,
+     int number_of_iterations )
+{
+	creg_test_multi_thread_worker_t workers[ CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error = NULL;
+	int64_t elapsed_time     = 0;
+	int64_t start_time       = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	memory_set(
+	 threads,
+	 0,
+	 sizeof( libcthreads_thread_t * ) * CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS );
+
+	CREG_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	CREG_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS + 1 );
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		workers[ thread_index ].file                 = file;
+		workers[ thread_index ].key                  = key;
+		workers[ thread_index ].number_of_iterations = number_of_iterations;
+		workers[ thread_index ].result               = 0;
+	}
+	start_time = creg_test_multi_thread_get_current_time();
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &creg_test_multi_thread_worker_callback,
+		          (void *) &( workers[ thread_index ] ),
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	elapsed_time = creg_test_multi_thread_get_current_time() - start_time;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "workers[ thread_index ].result",
+		 workers[ thread_index ].result,
+		 1 );
+	}
+	fprintf(
+	 stdout,
+	 "%d thread(s): %d iterations in %" PRIi64 " us\n",
+	 number_of_threads,
+	 number_of_threads * number_of_iterations,
+	 elapsed_time / 1000 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests reading a shared key from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_multi_thread_read_shared_key(
+     libcreg_key_t *key,
+     int number_of_threads )
+{
+	/* The iterations are divided over the threads so the elapsed time shows the scaling
+	 */
+	return( creg_test_multi_thread_run_workers(
+	         NULL,
+	         key,
+	         number_of_threads,
+	         CREG_TEST_MULTI_THREAD_NUMBER_OF_ITERATIONS / number_of_threads ) );
+}
+
+/* Tests looking up values by name from multiple threads that each use
+ * their own key objects for the same keys
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_multi_thread_read_separate_keys(
+     libcreg_file_t *file,
+     int number_of_threads )
+{
+	return( creg_test_multi_thread_run_workers(
+	         file,
+	         NULL,
+	         number_of_threads,
+	         CREG_TEST_MULTI_THREAD_NUMBER_OF_SEPARATE_KEYS_ITERATIONS ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *error     = NULL;
+	libcreg_file_t *file         = NULL;
+	libcreg_key_t *root_key      = NULL;
+	int number_of_threads        = 0;
+	int result                   = 0;
+#endif
+	system_character_t *source   = NULL;
+	system_integer_t option      = 0;
+
+	while( ( option = creg_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( source == NULL )
+	{
+		return( EXIT_SUCCESS );
+	}
+	result = libcreg_file_initialize(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcreg_file_open_wide(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#else
+	result = libcreg_file_open(
+	          file,
+	          source,
+	          LIBCREG_OPEN_READ,
+	          &error );
+#endif
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	CREG_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( root_key != NULL )
+	{
+		for( number_of_threads = 1;
+		     number_of_threads <= CREG_TEST_MULTI_THREAD_MAXIMUM_NUMBER_OF_THREADS;
+		     number_of_threads *= 2 )
+		{
+			CREG_TEST_RUN_WITH_ARGS(
+			 "libcreg_key read from multiple threads",
+			 creg_test_multi_thread_read_shared_key,
+			 root_key,
+			 number_of_threads );
+		}
+		CREG_TEST_RUN_WITH_ARGS(
+		 "libcreg_key_get_value_by_utf8_name from multiple threads with separate keys",
+		 creg_test_multi_thread_read_separate_keys,
+		 file,
+		 2 );
+
+		result = libcreg_key_free(
+		          &root_key,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_file_close(
+	          file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_file_free(
+	          &file,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_key != NULL )
+	{
+		libcreg_key_free(
+		 &root_key,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcreg_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
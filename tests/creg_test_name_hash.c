@@ -0,0 +1,442 @@
+/*
+ * Library name hash functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_name_hash.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_name_hash_calculate_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_calculate_from_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 10 ] = {
+		'S', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0xe9, 0x80 };
+
+	libcerror_error_t *error  = NULL;
+	uint32_t name_hash        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          byte_stream,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x0000026bUL );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that characters of 0x80 and greater are ignored
+	 */
+	result = libcreg_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          byte_stream,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x0000026bUL );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_calculate_from_byte_stream(
+	          NULL,
+	          byte_stream,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          NULL,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_name_hash_calculate_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_calculate_from_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 10 ] = {
+		'S', 'O', 'F', 'T', 'W', 'A', 'R', 'E', 0xc3, 0xa9 };
+
+	libcerror_error_t *error  = NULL;
+	uint32_t name_hash        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x0000026bUL );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hash cannot be determined for non-ASCII characters
+	 */
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          NULL,
+	          utf8_string,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          NULL,
+	          10,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_name_hash_calculate_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_calculate_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 9 ] = {
+		's', 'o', 'f', 't', 'w', 'a', 'r', 'e', 0x00e9 };
+
+	libcerror_error_t *error   = NULL;
+	uint32_t name_hash         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x0000026bUL );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hash cannot be determined for non-ASCII characters
+	 */
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          NULL,
+	          utf16_string,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          NULL,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_calculate_from_byte_stream",
+	 creg_test_name_hash_calculate_from_byte_stream );
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_calculate_from_utf8_string",
+	 creg_test_name_hash_calculate_from_utf8_string );
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_calculate_from_utf16_string",
+	 creg_test_name_hash_calculate_from_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,717 @@
+/*
+ * Library name_hash_table type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_name_hash_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_name_hash_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_table_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcreg_name_hash_table_t *name_hash_table = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 3;
+	int number_of_memset_fail_tests            = 2;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_name_hash_table_initialize(
+	          &name_hash_table,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_table_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_hash_table = (libcreg_name_hash_table_t *) 0x12345678UL;
+
+	result = libcreg_name_hash_table_initialize(
+	          &name_hash_table,
+	          16,
+	          &error );
+
+	name_hash_table = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_table_initialize(
+	          &name_hash_table,
+	          -1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_name_hash_table_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_name_hash_table_initialize(
+		          &name_hash_table,
+		          16,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libcreg_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_name_hash_table_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_name_hash_table_initialize(
+		          &name_hash_table,
+		          16,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libcreg_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_name_hash_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_table_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_name_hash_table_insert_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_table_insert_entry(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcreg_name_hash_table_t *name_hash_table = NULL;
+	int entry_index                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_name_hash_table_initialize(
+	          &name_hash_table,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libcreg_name_hash_table_insert_entry(
+		          name_hash_table,
+		          0x026bUL,
+		          entry_index,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "name_hash_table->number_of_entries",
+	 name_hash_table->number_of_entries,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libcreg_name_hash_table_insert_entry(
+	          NULL,
+	          0x026bUL,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_table_insert_entry(
+	          name_hash_table,
+	          0x026bUL,
+	          -1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the table is full
+	 */
+	result = libcreg_name_hash_table_insert_entry(
+	          name_hash_table,
+	          0x026bUL,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_name_hash_table_get_next_entry_index function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_name_hash_table_get_next_entry_index(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcreg_name_hash_table_t *name_hash_table = NULL;
+	int entry_index                            = 0;
+	int number_of_matches                      = 0;
+	int probe_index                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_name_hash_table_initialize(
+	          &name_hash_table,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		result = libcreg_name_hash_table_insert_entry(
+		          name_hash_table,
+		          ( ( entry_index % 2 ) == 0 ) ? 0x026bUL : 0x0290UL,
+		          entry_index,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	probe_index = 0;
+
+	do
+	{
+		result = libcreg_name_hash_table_get_next_entry_index(
+		          name_hash_table,
+		          0x026bUL,
+		          &probe_index,
+		          &entry_index,
+		          &error );
+
+		CREG_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "entry_index % 2",
+			 entry_index % 2,
+			 0 );
+
+			number_of_matches++;
+		}
+	}
+	while( result != 0 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 4 );
+
+	probe_index = 0;
+
+	result = libcreg_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          0x0001UL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	probe_index = 0;
+
+	result = libcreg_name_hash_table_get_next_entry_index(
+	          NULL,
+	          0x026bUL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          0x026bUL,
+	          NULL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	probe_index = -1;
+
+	result = libcreg_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          0x026bUL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	probe_index = 0;
+
+	result = libcreg_name_hash_table_get_next_entry_index(
+	          name_hash_table,
+	          0x026bUL,
+	          &probe_index,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libcreg_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_table_initialize",
+	 creg_test_name_hash_table_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_table_free",
+	 creg_test_name_hash_table_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_table_insert_entry",
+	 creg_test_name_hash_table_insert_entry );
+
+	CREG_TEST_RUN(
+	 "libcreg_name_hash_table_get_next_entry_index",
+	 creg_test_name_hash_table_get_next_entry_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,792 @@
+/*
+ * Library offset path cache test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_offset_path_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_offset_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_offset_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libcreg_offset_path_cache_t *offset_path_cache = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_offset_path_cache_initialize(
+	          &offset_path_cache,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_free(
+	          &offset_path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_offset_path_cache_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset_path_cache = (libcreg_offset_path_cache_t *) 0x12345678UL;
+
+	result = libcreg_offset_path_cache_initialize(
+	          &offset_path_cache,
+	          16,
+	          &error );
+
+	offset_path_cache = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_initialize(
+	          &offset_path_cache,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_offset_path_cache_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_offset_path_cache_initialize(
+		          &offset_path_cache,
+		          16,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( offset_path_cache != NULL )
+			{
+				libcreg_offset_path_cache_free(
+				 &offset_path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "offset_path_cache",
+			 offset_path_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_offset_path_cache_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_offset_path_cache_initialize(
+		          &offset_path_cache,
+		          16,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( offset_path_cache != NULL )
+			{
+				libcreg_offset_path_cache_free(
+				 &offset_path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "offset_path_cache",
+			 offset_path_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_path_cache != NULL )
+	{
+		libcreg_offset_path_cache_free(
+		 &offset_path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_offset_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_offset_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_offset_path_cache_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_offset_path_cache_get_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_offset_path_cache_get_utf8_path(
+     void )
+{
+	uint8_t utf8_path1[ 9 ]                        = { '\\', 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e' };
+	uint8_t utf8_path2[ 6 ]                        = { '\\', 'T', 'e', 's', 't', 's' };
+	libcerror_error_t *error                       = NULL;
+	libcreg_offset_path_cache_t *offset_path_cache = NULL;
+	const uint8_t *utf8_path                       = NULL;
+	size_t utf8_path_length                        = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_offset_path_cache_initialize(
+	          &offset_path_cache,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          utf8_path1,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_length",
+	 utf8_path_length,
+	 (size_t) 9 );
+
+	result = memory_compare(
+	          utf8_path,
+	          utf8_path1,
+	          9 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000200UL,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          NULL,
+	          0x00000100UL,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          NULL,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          &utf8_path,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_offset_path_cache_free(
+	          &offset_path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_path_cache != NULL )
+	{
+		libcreg_offset_path_cache_free(
+		 &offset_path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_offset_path_cache_set_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_offset_path_cache_set_utf8_path(
+     void )
+{
+	uint8_t utf8_path1[ 9 ]                        = { '\\', 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e' };
+	uint8_t utf8_path2[ 6 ]                        = { '\\', 'T', 'e', 's', 't', 's' };
+	libcerror_error_t *error                       = NULL;
+	libcreg_offset_path_cache_t *offset_path_cache = NULL;
+	const uint8_t *utf8_path                       = NULL;
+	size_t utf8_path_length                        = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_offset_path_cache_initialize(
+	          &offset_path_cache,
+	          8,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          utf8_path1,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test replacing the path of a key offset
+	 */
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          utf8_path2,
+	          6,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_length",
+	 utf8_path_length,
+	 (size_t) 6 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty path
+	 */
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000020UL,
+	          NULL,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_offset_path_cache_get_utf8_path(
+	          offset_path_cache,
+	          0x00000020UL,
+	          &utf8_path,
+	          &utf8_path_length,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_length",
+	 utf8_path_length,
+	 (size_t) 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          NULL,
+	          0x00000100UL,
+	          utf8_path1,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0,
+	          utf8_path1,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          NULL,
+	          9,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_offset_path_cache_set_utf8_path(
+	          offset_path_cache,
+	          0x00000100UL,
+	          utf8_path1,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_offset_path_cache_free(
+	          &offset_path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "offset_path_cache",
+	 offset_path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_path_cache != NULL )
+	{
+		libcreg_offset_path_cache_free(
+		 &offset_path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_offset_path_cache_initialize",
+	 creg_test_offset_path_cache_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_offset_path_cache_free",
+	 creg_test_offset_path_cache_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_offset_path_cache_get_utf8_path",
+	 creg_test_offset_path_cache_get_utf8_path );
+
+	CREG_TEST_RUN(
+	 "libcreg_offset_path_cache_set_utf8_path",
+	 creg_test_offset_path_cache_set_utf8_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,841 @@
+/*
+ * Library path cache test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_libuna.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_path_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_cache_t *path_cache = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_cache_initialize(
+	          &path_cache,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_cache_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_cache = (libcreg_path_cache_t *) 0x12345678UL;
+
+	result = libcreg_path_cache_initialize(
+	          &path_cache,
+	          16,
+	          &error );
+
+	path_cache = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_initialize(
+	          &path_cache,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_path_cache_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_path_cache_initialize(
+		          &path_cache,
+		          16,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libcreg_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_path_cache_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_path_cache_initialize(
+		          &path_cache,
+		          16,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libcreg_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libcreg_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_path_cache_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_cache_get_key_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_cache_get_key_offset(
+     void )
+{
+	libuna_unicode_character_t path1[ 3 ] = { 'A', 'B', 'C' };
+	libuna_unicode_character_t path2[ 3 ] = { 'A', 'B', 'D' };
+	libcerror_error_t *error         = NULL;
+	libcreg_path_cache_t *path_cache = NULL;
+	uint32_t key_offset              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_cache_initialize(
+	          &path_cache,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          0x00000100UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00000100UL );
+
+	/* Test a path with the same hash but different characters
+	 */
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path2,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_cache_get_key_offset(
+	          NULL,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          NULL,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          0,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libcreg_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_cache_set_key_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_cache_set_key_offset(
+     void )
+{
+	libuna_unicode_character_t path1[ 3 ] = { 'A', 'B', 'C' };
+	libuna_unicode_character_t path2[ 3 ] = { 'A', 'B', 'D' };
+	libuna_unicode_character_t path3[ 1 ] = { 'A' };
+	libcerror_error_t *error         = NULL;
+	libcreg_path_cache_t *path_cache = NULL;
+	uint32_t key_offset              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_cache_initialize(
+	          &path_cache,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          0x00000100UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path2,
+	          3,
+	          0x00000200UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test updating a cached path
+	 */
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          0x00000300UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00000300UL );
+
+	/* Test that the least recently used path is replaced when the cache is full
+	 */
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00000041UL,
+	          path3,
+	          1,
+	          0x00000400UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path2,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00000300UL );
+
+	result = libcreg_path_cache_get_key_offset(
+	          path_cache,
+	          0x00000041UL,
+	          path3,
+	          1,
+	          &key_offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x00000400UL );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_cache_set_key_offset(
+	          NULL,
+	          0x00001234UL,
+	          path1,
+	          3,
+	          0x00000100UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          NULL,
+	          3,
+	          0x00000100UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_cache_set_key_offset(
+	          path_cache,
+	          0x00001234UL,
+	          path1,
+	          0,
+	          0x00000100UL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libcreg_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_path_cache_initialize",
+	 creg_test_path_cache_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_cache_free",
+	 creg_test_path_cache_free );
+
+	/* TODO: add tests for libcreg_path_cache_unlink_entry */
+
+	/* TODO: add tests for libcreg_path_cache_link_entry_as_most_recently_used */
+
+	CREG_TEST_RUN(
+	 "libcreg_path_cache_get_key_offset",
+	 creg_test_path_cache_get_key_offset );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_cache_set_key_offset",
+	 creg_test_path_cache_set_key_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
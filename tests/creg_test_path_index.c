@@ -0,0 +1,1331 @@
+/*
+ * Library path index test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_path_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_path_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_index_t *path_index = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 4;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_index_free(
+	          &path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_index = (libcreg_path_index_t *) 0x12345678UL;
+
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          16,
+	          &error );
+
+	path_index = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_path_index_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_path_index_initialize(
+		          &path_index,
+		          16,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( path_index != NULL )
+			{
+				libcreg_path_index_free(
+				 &path_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "path_index",
+			 path_index );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_path_index_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_path_index_initialize(
+		          &path_index,
+		          16,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( path_index != NULL )
+			{
+				libcreg_path_index_free(
+				 &path_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "path_index",
+			 path_index );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_append_entry(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_index_t *path_index = NULL;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000020UL,
+	          -1,
+	          0,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x0000003cUL,
+	          0,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_append_entry(
+	          NULL,
+	          0x00000058UL,
+	          0,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000058UL,
+	          2,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000058UL,
+	          0,
+	          0x00000d8dUL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_index_free(
+	          &path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_get_entry_index_by_key_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_get_entry_index_by_key_offset(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_index_t *path_index = NULL;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000020UL,
+	          -1,
+	          0,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x0000003cUL,
+	          0,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libcreg_path_index_build_hash_tables(
+	          path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_get_entry_index_by_key_offset(
+	          path_index,
+	          0x0000003cUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libcreg_path_index_get_entry_index_by_key_offset(
+	          path_index,
+	          0x00000058UL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_get_entry_index_by_key_offset(
+	          NULL,
+	          0x0000003cUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_get_entry_index_by_key_offset(
+	          path_index,
+	          0x0000003cUL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_index_free(
+	          &path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_get_next_entry_index_by_path_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_get_next_entry_index_by_path_hash(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_index_t *path_index = NULL;
+	int entry_index                  = 0;
+	int probe_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000020UL,
+	          -1,
+	          0,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x0000003cUL,
+	          0,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libcreg_path_index_build_hash_tables(
+	          path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_get_next_entry_index_by_path_hash(
+	          path_index,
+	          0x00000d8dUL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libcreg_path_index_get_next_entry_index_by_path_hash(
+	          path_index,
+	          0x00000d8dUL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	probe_index = 0;
+
+	result = libcreg_path_index_get_next_entry_index_by_path_hash(
+	          NULL,
+	          0x00000d8dUL,
+	          &probe_index,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_get_next_entry_index_by_path_hash(
+	          path_index,
+	          0x00000d8dUL,
+	          &probe_index,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_index_free(
+	          &path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_get_entry_values function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_get_entry_values(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcreg_path_index_t *path_index = NULL;
+	uint32_t key_offset              = 0;
+	uint32_t path_hash               = 0;
+	int entry_index                  = 0;
+	int parent_entry_index           = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_path_index_initialize(
+	          &path_index,
+	          4,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x00000020UL,
+	          -1,
+	          0,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_path_index_append_entry(
+	          path_index,
+	          0x0000003cUL,
+	          0,
+	          0x00000d8dUL,
+	          &entry_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_get_entry_values(
+	          path_index,
+	          1,
+	          &key_offset,
+	          &parent_entry_index,
+	          &path_hash,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 (uint32_t) 0x0000003cUL );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "parent_entry_index",
+	 parent_entry_index,
+	 0 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0x00000d8dUL );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_get_entry_values(
+	          NULL,
+	          1,
+	          &key_offset,
+	          &parent_entry_index,
+	          &path_hash,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_get_entry_values(
+	          path_index,
+	          2,
+	          &key_offset,
+	          &parent_entry_index,
+	          &path_hash,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_get_entry_values(
+	          path_index,
+	          1,
+	          NULL,
+	          &parent_entry_index,
+	          &path_hash,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_path_index_free(
+	          &path_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libcreg_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_calculate_path_hash_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_calculate_path_hash_from_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 2 ]   = { 'a', 0 };
+	libcerror_error_t *error   = NULL;
+	uint32_t path_hash         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_calculate_path_hash_from_utf8_string(
+	          &path_hash,
+	          0,
+	          utf8_string,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0x00000d8dUL );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_calculate_path_hash_from_utf8_string(
+	          NULL,
+	          0,
+	          utf8_string,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_calculate_path_hash_from_utf8_string(
+	          &path_hash,
+	          0,
+	          NULL,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_calculate_path_hash_from_utf8_string(
+	          &path_hash,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_path_index_calculate_path_hash_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_path_index_calculate_path_hash_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 2 ] = { 'a', 0 };
+	libcerror_error_t *error   = NULL;
+	uint32_t path_hash         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_path_index_calculate_path_hash_from_utf16_string(
+	          &path_hash,
+	          0,
+	          utf16_string,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0x00000d8dUL );
+
+	/* Test error cases
+	 */
+	result = libcreg_path_index_calculate_path_hash_from_utf16_string(
+	          NULL,
+	          0,
+	          utf16_string,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_calculate_path_hash_from_utf16_string(
+	          &path_hash,
+	          0,
+	          NULL,
+	          1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_path_index_calculate_path_hash_from_utf16_string(
+	          &path_hash,
+	          0,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_initialize",
+	 creg_test_path_index_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_free",
+	 creg_test_path_index_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_append_entry",
+	 creg_test_path_index_append_entry );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_get_entry_index_by_key_offset",
+	 creg_test_path_index_get_entry_index_by_key_offset );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_get_next_entry_index_by_path_hash",
+	 creg_test_path_index_get_next_entry_index_by_path_hash );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_get_entry_values",
+	 creg_test_path_index_get_entry_values );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_calculate_path_hash_from_utf8_string",
+	 creg_test_path_index_calculate_path_hash_from_utf8_string );
+
+	CREG_TEST_RUN(
+	 "libcreg_path_index_calculate_path_hash_from_utf16_string",
+	 creg_test_path_index_calculate_path_hash_from_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
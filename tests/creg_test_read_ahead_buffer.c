@@ -0,0 +1,641 @@
+/*
+ * Library read_ahead_buffer type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_functions.h"
+#include "creg_test_libbfio.h"
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_read_ahead_buffer.h"
+
+uint8_t creg_test_read_ahead_buffer_data1[ 64 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_read_ahead_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_read_ahead_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libcreg_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 2;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_read_ahead_buffer_initialize(
+	          &read_ahead_buffer,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead_buffer",
+	 read_ahead_buffer );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_read_ahead_buffer_free(
+	          &read_ahead_buffer,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "read_ahead_buffer",
+	 read_ahead_buffer );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_read_ahead_buffer_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead_buffer = (libcreg_read_ahead_buffer_t *) 0x12345678UL;
+
+	result = libcreg_read_ahead_buffer_initialize(
+	          &read_ahead_buffer,
+	          16,
+	          &error );
+
+	read_ahead_buffer = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_read_ahead_buffer_initialize(
+	          &read_ahead_buffer,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "read_ahead_buffer",
+	 read_ahead_buffer );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_read_ahead_buffer_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_read_ahead_buffer_initialize(
+		          &read_ahead_buffer,
+		          16,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( read_ahead_buffer != NULL )
+			{
+				libcreg_read_ahead_buffer_free(
+				 &read_ahead_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "read_ahead_buffer",
+			 read_ahead_buffer );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_read_ahead_buffer_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_read_ahead_buffer_initialize(
+		          &read_ahead_buffer,
+		          16,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( read_ahead_buffer != NULL )
+			{
+				libcreg_read_ahead_buffer_free(
+				 &read_ahead_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "read_ahead_buffer",
+			 read_ahead_buffer );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead_buffer != NULL )
+	{
+		libcreg_read_ahead_buffer_free(
+		 &read_ahead_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_read_ahead_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_read_ahead_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_read_ahead_buffer_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_read_ahead_buffer_get_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_read_ahead_buffer_get_data_at_offset(
+     void )
+{
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libcreg_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	const uint8_t *data                            = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_read_ahead_buffer_initialize(
+	          &read_ahead_buffer,
+	          16,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead_buffer",
+	 read_ahead_buffer );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = creg_test_open_file_io_handle(
+	          &file_io_handle,
+	          creg_test_read_ahead_buffer_data1,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          0,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 0x00 );
+
+	/* Test retrieving data that is in the read-ahead window
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          8,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead_buffer->data_offset",
+	 (int64_t) read_ahead_buffer->data_offset,
+	 (int64_t) 0 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 0x08 );
+
+	/* Test retrieving data that crosses the end of the read-ahead window
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          12,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead_buffer->data_offset",
+	 (int64_t) read_ahead_buffer->data_offset,
+	 (int64_t) 12 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 7 ]",
+	 data[ 7 ],
+	 (uint8_t) 0x13 );
+
+	/* Test retrieving data that exceeds the read-ahead window
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          0,
+	          32,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          -1,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          0,
+	          8,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving data beyond the end of the file
+	 */
+	result = libcreg_read_ahead_buffer_get_data_at_offset(
+	          read_ahead_buffer,
+	          file_io_handle,
+	          60,
+	          8,
+	          &data,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = creg_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_read_ahead_buffer_free(
+	          &read_ahead_buffer,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "read_ahead_buffer",
+	 read_ahead_buffer );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_ahead_buffer != NULL )
+	{
+		libcreg_read_ahead_buffer_free(
+		 &read_ahead_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_read_ahead_buffer_initialize",
+	 creg_test_read_ahead_buffer_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_read_ahead_buffer_free",
+	 creg_test_read_ahead_buffer_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_read_ahead_buffer_get_data_at_offset",
+	 creg_test_read_ahead_buffer_get_data_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,887 @@
+/*
+ * Library sharded_cache type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_sharded_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_sharded_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_sharded_cache_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcreg_sharded_cache_t *sharded_cache = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 2;
+	int number_of_memset_fail_tests        = 2;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          4,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "sharded_cache->number_of_shards",
+	 sharded_cache->number_of_shards,
+	 4 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "sharded_cache->number_of_shard_bits",
+	 sharded_cache->number_of_shard_bits,
+	 2 );
+
+	result = libcreg_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_sharded_cache_initialize(
+	          NULL,
+	          4,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sharded_cache = (libcreg_sharded_cache_t *) 0x12345678UL;
+
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          4,
+	          64,
+	          &error );
+
+	sharded_cache = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          0,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          3,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          4,
+	          2,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_sharded_cache_initialize with malloc failing
+		 */
+		creg_test_malloc_attempts_before_fail = test_number;
+
+		result = libcreg_sharded_cache_initialize(
+		          &sharded_cache,
+		          4,
+		          64,
+		          &error );
+
+		if( creg_test_malloc_attempts_before_fail != -1 )
+		{
+			creg_test_malloc_attempts_before_fail = -1;
+
+			if( sharded_cache != NULL )
+			{
+				libcreg_sharded_cache_free(
+				 &sharded_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "sharded_cache",
+			 sharded_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcreg_sharded_cache_initialize with memset failing
+		 */
+		creg_test_memset_attempts_before_fail = test_number;
+
+		result = libcreg_sharded_cache_initialize(
+		          &sharded_cache,
+		          4,
+		          64,
+		          &error );
+
+		if( creg_test_memset_attempts_before_fail != -1 )
+		{
+			creg_test_memset_attempts_before_fail = -1;
+
+			if( sharded_cache != NULL )
+			{
+				libcreg_sharded_cache_free(
+				 &sharded_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CREG_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CREG_TEST_ASSERT_IS_NULL(
+			 "sharded_cache",
+			 sharded_cache );
+
+			CREG_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libcreg_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_sharded_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_sharded_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_sharded_cache_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_sharded_cache_get_shard_index function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_sharded_cache_get_shard_index(
+     void )
+{
+	int shard_counts[ 4 ]                  = { 0, 0, 0, 0 };
+
+	libcerror_error_t *error               = NULL;
+	libcreg_sharded_cache_t *sharded_cache = NULL;
+	uint64_t key                           = 0;
+	int result                             = 0;
+	int shard_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          4,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( key = 0;
+	     key < 64;
+	     key++ )
+	{
+		result = libcreg_sharded_cache_get_shard_index(
+		          sharded_cache,
+		          key,
+		          &shard_index,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_GREATER_THAN_INT(
+		 "shard_index",
+		 shard_index,
+		 -1 );
+
+		CREG_TEST_ASSERT_LESS_THAN_INT(
+		 "shard_index",
+		 shard_index,
+		 4 );
+
+		shard_counts[ shard_index ] += 1;
+	}
+	/* Consecutive keys are spread over all shards
+	 */
+	for( shard_index = 0;
+	     shard_index < 4;
+	     shard_index++ )
+	{
+		CREG_TEST_ASSERT_GREATER_THAN_INT(
+		 "shard_counts[ shard_index ]",
+		 shard_counts[ shard_index ],
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcreg_sharded_cache_get_shard_index(
+	          NULL,
+	          0,
+	          &shard_index,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_get_shard_index(
+	          sharded_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libcreg_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_sharded_cache_grab_shard, libcreg_sharded_cache_release_shard
+ * and libcreg_sharded_cache_get_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_sharded_cache_grab_shard(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcreg_sharded_cache_shard_t *shard   = NULL;
+	libcreg_sharded_cache_t *sharded_cache = NULL;
+	uint64_t number_of_hits                = 0;
+	uint64_t number_of_misses              = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_sharded_cache_initialize(
+	          &sharded_cache,
+	          4,
+	          64,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_sharded_cache_grab_shard(
+	          sharded_cache,
+	          2,
+	          &shard,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "shard",
+	 shard );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "shard->cache",
+	 shard->cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	shard->number_of_hits   += 3;
+	shard->number_of_misses += 1;
+
+	result = libcreg_sharded_cache_release_shard(
+	          sharded_cache,
+	          shard,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          sharded_cache,
+	          2,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 3 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          sharded_cache,
+	          0,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	shard = NULL;
+
+	result = libcreg_sharded_cache_grab_shard(
+	          NULL,
+	          0,
+	          &shard,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_grab_shard(
+	          sharded_cache,
+	          4,
+	          &shard,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_grab_shard(
+	          sharded_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_release_shard(
+	          NULL,
+	          &( sharded_cache->shards[ 0 ] ),
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_release_shard(
+	          sharded_cache,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          NULL,
+	          0,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          sharded_cache,
+	          -1,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          sharded_cache,
+	          0,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_sharded_cache_get_statistics(
+	          sharded_cache,
+	          0,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_sharded_cache_free(
+	          &sharded_cache,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "sharded_cache",
+	 sharded_cache );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_cache != NULL )
+	{
+		libcreg_sharded_cache_free(
+		 &sharded_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_sharded_cache_initialize",
+	 creg_test_sharded_cache_initialize );
+
+	CREG_TEST_RUN(
+	 "libcreg_sharded_cache_free",
+	 creg_test_sharded_cache_free );
+
+	CREG_TEST_RUN(
+	 "libcreg_sharded_cache_get_shard_index",
+	 creg_test_sharded_cache_get_shard_index );
+
+	CREG_TEST_RUN(
+	 "libcreg_sharded_cache_grab_shard",
+	 creg_test_sharded_cache_grab_shard );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
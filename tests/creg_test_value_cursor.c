@@ -0,0 +1,1842 @@
+/*
+ * Library value_cursor type test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "creg_test_libcerror.h"
+#include "creg_test_libcreg.h"
+#include "creg_test_macros.h"
+#include "creg_test_memory.h"
+#include "creg_test_unused.h"
+
+#include "../libcreg/libcreg_definitions.h"
+#include "../libcreg/libcreg_io_handle.h"
+#include "../libcreg/libcreg_key_name_entry.h"
+#include "../libcreg/libcreg_value_cursor.h"
+
+/* Key name entry with the values: "ab" (REG_SZ) "x" and "dw" (REG_DWORD) 42
+ */
+uint8_t creg_test_value_cursor_key_name_entry_data1[ 58 ] = {
+	0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x65, 0x73, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x02, 0x00, 0x61, 0x62, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x04, 0x00, 0x64, 0x77, 0x2a, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_value_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcreg_io_handle_t *io_handle       = NULL;
+	libcreg_value_cursor_t *value_cursor = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_cursor_initialize(
+	          &value_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_free(
+	          &value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	value_cursor = (libcreg_value_cursor_t *) 0x12345678UL;
+
+	result = libcreg_value_cursor_initialize(
+	          &value_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	value_cursor = NULL;
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_initialize(
+	          &value_cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CREG_TEST_MEMORY )
+
+	/* Test libcreg_value_cursor_initialize with malloc failing
+	 */
+	creg_test_malloc_attempts_before_fail = 0;
+
+	result = libcreg_value_cursor_initialize(
+	          &value_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	if( creg_test_malloc_attempts_before_fail != -1 )
+	{
+		creg_test_malloc_attempts_before_fail = -1;
+
+		if( value_cursor != NULL )
+		{
+			libcreg_value_cursor_free(
+			 &value_cursor,
+			 NULL );
+		}
+	}
+	else
+	{
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "value_cursor",
+		 value_cursor );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CREG_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcreg_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_cursor != NULL )
+	{
+		libcreg_value_cursor_free(
+		 &value_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libcreg_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* Tests the libcreg_value_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_free(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+/* Tests the libcreg_value_cursor_next function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_next(
+     libcreg_value_cursor_t *value_cursor )
+{
+	libcerror_error_t *error    = NULL;
+	const uint8_t *name         = NULL;
+	const uint8_t *value_data   = NULL;
+	size_t name_size            = 0;
+	size_t value_data_size      = 0;
+	uint32_t value_type         = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_get_name_reference(
+	          value_cursor,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          name,
+	          "ab",
+	          2 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcreg_value_cursor_get_value_type(
+	          value_cursor,
+	          &value_type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 (uint32_t) LIBCREG_VALUE_TYPE_STRING );
+
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_get_value_data_reference(
+	          value_cursor,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	CREG_TEST_ASSERT_EQUAL_UINT8(
+	 "value_data[ 0 ]",
+	 value_data[ 0 ],
+	 (uint8_t) 0x2a );
+
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_value_type(
+	          value_cursor,
+	          &value_type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_next(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_reset(
+     libcreg_value_cursor_t *value_cursor )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *name      = NULL;
+	size_t name_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_get_name_reference(
+	          value_cursor,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_reset(
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_get_offset(
+     libcreg_value_cursor_t *value_cursor )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_value_t *value   = NULL;
+	off64_t expected_offset  = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libcreg_value_cursor_next(
+		          value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value(
+		          value_cursor,
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_get_offset(
+		          value,
+		          &expected_offset,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_offset(
+		          value_cursor,
+		          &offset,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offset );
+
+		result = libcreg_value_free(
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_offset(
+	          value_cursor,
+	          &offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_offset(
+	          value_cursor,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_get_name_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_get_name_reference(
+     libcreg_value_cursor_t *value_cursor )
+{
+	const char *expected_names[ 2 ] = { "ab", "dw" };
+
+	libcerror_error_t *error     = NULL;
+	libcreg_value_t *value       = NULL;
+	const uint8_t *expected_name = NULL;
+	const uint8_t *name          = NULL;
+	size_t expected_name_size    = 0;
+	size_t name_size             = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libcreg_value_cursor_next(
+		          value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value(
+		          value_cursor,
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_get_name_reference(
+		          value,
+		          &expected_name,
+		          &expected_name_size,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_name_reference(
+		          value_cursor,
+		          &name,
+		          &name_size,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_EQUAL_SIZE(
+		 "name_size",
+		 name_size,
+		 expected_name_size );
+
+		CREG_TEST_ASSERT_EQUAL_SIZE(
+		 "name_size",
+		 name_size,
+		 (size_t) 2 );
+
+		result = memory_compare(
+		          name,
+		          expected_name,
+		          name_size );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          name,
+		          expected_names[ value_index ],
+		          2 );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcreg_value_free(
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_name_reference(
+	          value_cursor,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_name_reference(
+	          NULL,
+	          &name,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_name_reference(
+	          value_cursor,
+	          NULL,
+	          &name_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_name_reference(
+	          value_cursor,
+	          &name,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_get_value_type function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_get_value_type(
+     libcreg_value_cursor_t *value_cursor )
+{
+	uint32_t expected_value_types[ 2 ] = { LIBCREG_VALUE_TYPE_STRING, LIBCREG_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN };
+
+	libcerror_error_t *error     = NULL;
+	libcreg_value_t *value       = NULL;
+	uint32_t expected_value_type = 0;
+	uint32_t value_type          = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libcreg_value_cursor_next(
+		          value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value(
+		          value_cursor,
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_get_value_type(
+		          value,
+		          &expected_value_type,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value_type(
+		          value_cursor,
+		          &value_type,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_EQUAL_UINT32(
+		 "value_type",
+		 value_type,
+		 expected_value_type );
+
+		CREG_TEST_ASSERT_EQUAL_UINT32(
+		 "value_type",
+		 value_type,
+		 expected_value_types[ value_index ] );
+
+		result = libcreg_value_free(
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_value_type(
+	          value_cursor,
+	          &value_type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value_type(
+	          NULL,
+	          &value_type,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value_type(
+	          value_cursor,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_get_value_data_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_get_value_data_reference(
+     libcreg_value_cursor_t *value_cursor )
+{
+	size_t expected_value_data_sizes[ 2 ] = { 2, 4 };
+
+	libcerror_error_t *error           = NULL;
+	libcreg_value_t *value             = NULL;
+	const uint8_t *expected_value_data = NULL;
+	const uint8_t *value_data          = NULL;
+	size_t expected_value_data_size    = 0;
+	size_t value_data_size             = 0;
+	int result                         = 0;
+	int value_index                    = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		result = libcreg_value_cursor_next(
+		          value_cursor,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value(
+		          value_cursor,
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_get_value_data_reference(
+		          value,
+		          &expected_value_data,
+		          &expected_value_data_size,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcreg_value_cursor_get_value_data_reference(
+		          value_cursor,
+		          &value_data,
+		          &value_data_size,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CREG_TEST_ASSERT_EQUAL_SIZE(
+		 "value_data_size",
+		 value_data_size,
+		 expected_value_data_size );
+
+		CREG_TEST_ASSERT_EQUAL_SIZE(
+		 "value_data_size",
+		 value_data_size,
+		 expected_value_data_sizes[ value_index ] );
+
+		result = memory_compare(
+		          value_data,
+		          expected_value_data,
+		          value_data_size );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libcreg_value_free(
+		          &value,
+		          &error );
+
+		CREG_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CREG_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_value_data_reference(
+	          value_cursor,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value_data_reference(
+	          NULL,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value_data_reference(
+	          value_cursor,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value_data_reference(
+	          value_cursor,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcreg_value_cursor_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_cursor_get_value(
+     libcreg_value_cursor_t *value_cursor )
+{
+	libcerror_error_t *error = NULL;
+	libcreg_value_t *value   = NULL;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcreg_value_cursor_next(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_get_value(
+	          value_cursor,
+	          &value,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_get_value_32bit(
+	          value,
+	          &value_32bit,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 42 );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_cursor_get_value(
+	          value_cursor,
+	          &value,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_cursor_get_value(
+	          NULL,
+	          &value,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_free(
+	          &value,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_reset(
+	          value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libcreg_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CREG_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CREG_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+	libcerror_error_t *error                 = NULL;
+	libcreg_io_handle_t *io_handle           = NULL;
+	libcreg_key_name_entry_t *key_name_entry = NULL;
+	libcreg_value_cursor_t *value_cursor     = NULL;
+	int result                               = 0;
+#endif
+
+	CREG_TEST_UNREFERENCED_PARAMETER( argc )
+	CREG_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	CREG_TEST_RUN(
+	 "libcreg_value_cursor_initialize",
+	 creg_test_value_cursor_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	CREG_TEST_RUN(
+	 "libcreg_value_cursor_free",
+	 creg_test_value_cursor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+
+	/* Initialize value cursor for tests
+	 */
+	result = libcreg_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_initialize(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "key_name_entry",
+	 key_name_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_read_data(
+	          key_name_entry,
+	          creg_test_value_cursor_key_name_entry_data1,
+	          58,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_value_cursor_initialize(
+	          &value_cursor,
+	          io_handle,
+	          NULL,
+	          key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_next",
+	 creg_test_value_cursor_next,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_reset",
+	 creg_test_value_cursor_reset,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_get_offset",
+	 creg_test_value_cursor_get_offset,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_get_name_reference",
+	 creg_test_value_cursor_get_name_reference,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_get_value_type",
+	 creg_test_value_cursor_get_value_type,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_get_value_data_reference",
+	 creg_test_value_cursor_get_value_data_reference,
+	 value_cursor );
+
+	CREG_TEST_RUN_WITH_ARGS(
+	 "libcreg_value_cursor_get_value",
+	 creg_test_value_cursor_get_value,
+	 value_cursor );
+
+	/* Clean up
+	 */
+	result = libcreg_value_cursor_free(
+	          &value_cursor,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_cursor",
+	 value_cursor );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_key_name_entry_free(
+	          &key_name_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcreg_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_cursor != NULL )
+	{
+		libcreg_value_cursor_free(
+		 &value_cursor,
+		 NULL );
+	}
+	if( key_name_entry != NULL )
+	{
+		libcreg_key_name_entry_free(
+		 &key_name_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libcreg_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
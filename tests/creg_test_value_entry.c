@@ -33,8 +33,12 @@
 #include "creg_test_memory.h"
 #include "creg_test_unused.h"
 
+#include "../libcreg/libcreg_definitions.h"
 #include "../libcreg/libcreg_value_entry.h"
 
+uint8_t creg_test_value_entry_data1[ 14 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x62 };
+
 #if defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT )
 
 /* Tests the libcreg_value_entry_initialize function
@@ -375,6 +379,101 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcreg_value_entry_read_data function with the reference data flag
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_entry_read_data_reference_data(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcreg_value_entry_t *value_entry = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_value_entry_initialize(
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_entry->flags |= LIBCREG_VALUE_ENTRY_FLAG_REFERENCE_DATA;
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_entry_read_data(
+	          value_entry,
+	          creg_test_value_entry_data1,
+	          14,
+	          0,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "value_entry->name_size",
+	 (int) value_entry->name_size,
+	 2 );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "value_entry->name == &( creg_test_value_entry_data1[ 12 ] )",
+	 (int) ( value_entry->name == &( creg_test_value_entry_data1[ 12 ] ) ),
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcreg_value_entry_free(
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_entry != NULL )
+	{
+		libcreg_value_entry_free(
+		 &value_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libcreg_value_entry_get_data_size function
  * Returns 1 if successful or 0 if not
  */
@@ -498,6 +597,146 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcreg_value_entry_calculate_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int creg_test_value_entry_calculate_name_hash(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcreg_value_entry_t *value_entry = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcreg_value_entry_initialize(
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases on a value entry without a name
+	 */
+	result = libcreg_value_entry_calculate_name_hash(
+	          value_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcreg_value_entry_read_data(
+	          value_entry,
+	          creg_test_value_entry_data1,
+	          14,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcreg_value_entry_calculate_name_hash(
+	          value_entry,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CREG_TEST_ASSERT_EQUAL_UINT32(
+	 "value_entry->name_hash",
+	 value_entry->name_hash,
+	 (uint32_t) 0x000009a7UL );
+
+	/* Test error cases
+	 */
+	result = libcreg_value_entry_calculate_name_hash(
+	          NULL,
+	          LIBCREG_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CREG_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcreg_value_entry_free(
+	          &value_entry,
+	          &error );
+
+	CREG_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "value_entry",
+	 value_entry );
+
+	CREG_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_entry != NULL )
+	{
+		libcreg_value_entry_free(
+		 &value_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCREG_DLL_IMPORT ) */
 
 /* The main program
@@ -529,10 +768,18 @@ int main(
 	 "libcreg_value_entry_read_data",
 	 creg_test_value_entry_read_data );
 
+	CREG_TEST_RUN(
+	 "libcreg_value_entry_read_data",
+	 creg_test_value_entry_read_data_reference_data );
+
 	CREG_TEST_RUN(
 	 "libcreg_value_entry_get_data_size",
 	 creg_test_value_entry_get_data_size );
 
+	CREG_TEST_RUN(
+	 "libcreg_value_entry_calculate_name_hash",
+	 creg_test_value_entry_calculate_name_hash );
+
 	/* TODO: add tests for libcreg_value_entry_get_data */
 
 	/* TODO: add tests for libcreg_value_entry_compare_name_with_utf8_string */
@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="data_block data_type error io_handle key key_descriptor key_hierarchy_entry key_name_entry key_navigation notify value value_entry";
-LIBRARY_TESTS_WITH_INPUT="file support";
+LIBRARY_TESTS="checksum data_block data_block_loader data_type error folded_name index_file io_handle key key_descriptor key_hierarchy_entry key_hierarchy_table key_name_entry key_navigation key_path key_walker name_hash name_hash_table notify offset_path_cache path_cache path_index read_ahead_buffer sharded_cache value value_cursor value_entry";
+LIBRARY_TESTS_WITH_INPUT="file key_cursor multi_thread support";
 OPTION_SETS=();
 
 INPUT_GLOB="*";